@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Kernel.h"
+
+namespace open3d {
+namespace core {
+
+enum class EWLayout {
+    Contiguous,  // All operands are contiguous.
+    Scalar,      // rhs is a broadcasted scalar.
+    Strided,     // Operands are transposed views, using per-element indexing.
+};
+
+static Tensor MakeOperand(int64_t num_elements,
+                          EWLayout layout,
+                          const Device& device) {
+    if (layout == EWLayout::Strided) {
+        // {1000, n / 1000} transposed to {n / 1000, 1000}.
+        return Tensor::Ones({1000, num_elements / 1000}, Dtype::Float32, device)
+                .T();
+    } else {
+        return Tensor::Ones({num_elements}, Dtype::Float32, device);
+    }
+}
+
+void BinaryEW(benchmark::State& state,
+              const Device& device,
+              kernel::BinaryEWOpCode op_code,
+              EWLayout layout) {
+    int64_t num_elements = state.range(0);
+    Tensor lhs = MakeOperand(num_elements, layout, device);
+    Tensor rhs = layout == EWLayout::Scalar
+                         ? Tensor::Ones({}, Dtype::Float32, device)
+                         : MakeOperand(num_elements, layout, device);
+    Tensor dst(lhs.GetShape(), Dtype::Float32, device);
+    kernel::BinaryEW(lhs, rhs, dst, op_code);
+    for (auto _ : state) {
+        kernel::BinaryEW(lhs, rhs, dst, op_code);
+    }
+    state.SetBytesProcessed(state.iterations() * num_elements *
+                            Dtype::Float32.ByteSize() * 3);
+}
+
+void UnaryEW(benchmark::State& state,
+             const Device& device,
+             kernel::UnaryEWOpCode op_code,
+             EWLayout layout) {
+    int64_t num_elements = state.range(0);
+    Tensor src = MakeOperand(num_elements, layout, device);
+    Tensor dst(src.GetShape(), Dtype::Float32, device);
+    kernel::UnaryEW(src, dst, op_code);
+    for (auto _ : state) {
+        kernel::UnaryEW(src, dst, op_code);
+    }
+    state.SetBytesProcessed(state.iterations() * num_elements *
+                            Dtype::Float32.ByteSize() * 2);
+}
+
+#define ENUM_EW_BENCHMARK(FUNC, OP, OP_CODE, LAYOUT)                       \
+    BENCHMARK_CAPTURE(FUNC, OP##_##LAYOUT##_CPU, Device("CPU:0"), OP_CODE, \
+                      EWLayout::LAYOUT)                                    \
+            ->RangeMultiplier(10)                                          \
+            ->Range(1000000, 100000000)                                    \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_EW_BENCHMARK(BinaryEW, Add, kernel::BinaryEWOpCode::Add, Contiguous)
+ENUM_EW_BENCHMARK(BinaryEW, Add, kernel::BinaryEWOpCode::Add, Scalar)
+ENUM_EW_BENCHMARK(BinaryEW, Add, kernel::BinaryEWOpCode::Add, Strided)
+ENUM_EW_BENCHMARK(BinaryEW, Mul, kernel::BinaryEWOpCode::Mul, Contiguous)
+ENUM_EW_BENCHMARK(BinaryEW, Mul, kernel::BinaryEWOpCode::Mul, Scalar)
+ENUM_EW_BENCHMARK(BinaryEW, Mul, kernel::BinaryEWOpCode::Mul, Strided)
+ENUM_EW_BENCHMARK(UnaryEW, Sqrt, kernel::UnaryEWOpCode::Sqrt, Contiguous)
+ENUM_EW_BENCHMARK(UnaryEW, Sqrt, kernel::UnaryEWOpCode::Sqrt, Strided)
+
+}  // namespace core
+}  // namespace open3d
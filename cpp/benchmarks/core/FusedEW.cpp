@@ -0,0 +1,74 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/FusedEW.h"
+
+namespace open3d {
+namespace core {
+
+// Computes sqrt(a * b + c), one kernel launch and one temporary per op.
+void EagerEW(benchmark::State& state, const Device& device) {
+    int64_t num_elements = state.range(0);
+    Tensor a = Tensor::Ones({num_elements}, Dtype::Float32, device);
+    Tensor b = Tensor::Ones({num_elements}, Dtype::Float32, device);
+    Tensor c = Tensor::Ones({num_elements}, Dtype::Float32, device);
+    Tensor warm_up = a.Mul(b).Add(c).Sqrt();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = a.Mul(b).Add(c).Sqrt();
+    }
+}
+
+// Computes sqrt(a * b + c) in a single fused pass.
+void FusedEW(benchmark::State& state, const Device& device) {
+    int64_t num_elements = state.range(0);
+    Tensor a = Tensor::Ones({num_elements}, Dtype::Float32, device);
+    Tensor b = Tensor::Ones({num_elements}, Dtype::Float32, device);
+    Tensor c = Tensor::Ones({num_elements}, Dtype::Float32, device);
+    kernel::FusedEWExpr expr = (kernel::FusedEWExpr(a) * b + c).Sqrt();
+    Tensor warm_up = expr.Eval();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = expr.Eval();
+    }
+}
+
+BENCHMARK_CAPTURE(EagerEW, CPU, Device("CPU:0"))
+        ->RangeMultiplier(10)
+        ->Range(1000000, 100000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FusedEW, CPU, Device("CPU:0"))
+        ->RangeMultiplier(10)
+        ->Range(1000000, 100000000)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+// Allocates and frees a fixed mix of buffer sizes, as a pipeline iteration
+// creating a handful of temporaries would.
+void MallocFree(benchmark::State& state, bool cache_enabled) {
+    CPUCachedMemoryManager::SetCacheEnabled(cache_enabled);
+    Device device("CPU:0");
+    const size_t byte_sizes[] = {64, 1200, 12000, 480000, 4800000};
+    void* ptrs[5];
+
+    for (auto _ : state) {
+        for (int i = 0; i < 5; ++i) {
+            ptrs[i] = MemoryManager::Malloc(byte_sizes[i], device);
+            benchmark::DoNotOptimize(ptrs[i]);
+        }
+        for (int i = 0; i < 5; ++i) {
+            MemoryManager::Free(ptrs[i], device);
+        }
+    }
+    CPUCachedMemoryManager::SetCacheEnabled(false);
+}
+
+// Steady-state loop of tensor ops creating temporaries. Small tensors are
+// dominated by allocation overhead, large ones (above the system allocator's
+// mmap threshold) by page faults on freshly mapped memory.
+void TensorTemporaries(benchmark::State& state,
+                       bool cache_enabled,
+                       int64_t num_points) {
+    CPUCachedMemoryManager::SetCacheEnabled(cache_enabled);
+    Device device("CPU:0");
+    Tensor a = Tensor::Ones({num_points, 3}, Dtype::Float32, device);
+    Tensor b = Tensor::Ones({num_points, 3}, Dtype::Float32, device);
+
+    for (auto _ : state) {
+        Tensor c = (a + b) * a - b;
+        benchmark::DoNotOptimize(c.GetDataPtr());
+    }
+    CPUCachedMemoryManager::SetCacheEnabled(false);
+}
+
+BENCHMARK_CAPTURE(MallocFree, System, false);
+BENCHMARK_CAPTURE(MallocFree, Cached, true);
+BENCHMARK_CAPTURE(TensorTemporaries, System_100, false, 100);
+BENCHMARK_CAPTURE(TensorTemporaries, Cached_100, true, 100);
+BENCHMARK_CAPTURE(TensorTemporaries, System_4000000, false, 4000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TensorTemporaries, Cached_4000000, true, 4000000)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace core
+}  // namespace open3d
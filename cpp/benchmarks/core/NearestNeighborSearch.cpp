@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/NearestNeighborSearch.h"
+
+#include <benchmark/benchmark.h>
+#include <tbb/task_arena.h>
+
+#include <random>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+
+namespace open3d {
+namespace core {
+
+// Uniformly distributed points in the unit cube.
+static Tensor RandomPoints(int64_t num_points, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    std::vector<float> values(num_points * 3);
+    for (float& v : values) {
+        v = uniform(rng);
+    }
+    return Tensor(values, {num_points, 3}, Dtype::Float32, Device("CPU:0"));
+}
+
+// Builds the index and searches all points against themselves. With
+// use_radius_index the CPU spatial hash index is used, otherwise the KDTree.
+void FixedRadiusSearch(benchmark::State& state,
+                       bool use_radius_index,
+                       int64_t num_points,
+                       double radius) {
+    Tensor points = RandomPoints(num_points, 0);
+
+    for (auto _ : state) {
+        nns::NearestNeighborSearch nns(points);
+        if (use_radius_index) {
+            nns.FixedRadiusIndex(radius);
+        } else {
+            nns.FixedRadiusIndex();
+        }
+        auto result = nns.FixedRadiusSearch(points, radius);
+        benchmark::DoNotOptimize(std::get<0>(result).GetDataPtr());
+    }
+}
+
+BENCHMARK_CAPTURE(FixedRadiusSearch, KDTree_100000, false, 100000, 0.01)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FixedRadiusSearch, SpatialHash_100000, true, 100000, 0.01)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FixedRadiusSearch, KDTree_1000000, false, 1000000, 0.005)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FixedRadiusSearch, SpatialHash_1000000, true, 1000000, 0.005)
+        ->Unit(benchmark::kMillisecond);
+
+// KDTree knn (hybrid if radius > 0) search of num_queries random points
+// against 100000 points, into preallocated outputs, on num_threads threads.
+void NanoFlannSearch(benchmark::State& state,
+                     int64_t num_queries,
+                     int num_threads,
+                     double radius,
+                     bool sort) {
+    const int knn = 16;
+    nns::NanoFlannIndex index(RandomPoints(100000, 0));
+    Tensor queries = RandomPoints(num_queries, 1);
+    Tensor indices = Tensor::Empty({num_queries, knn}, Dtype::Int64);
+    Tensor distances = Tensor::Empty({num_queries, knn}, Dtype::Float32);
+
+    tbb::task_arena arena(num_threads);
+    for (auto _ : state) {
+        arena.execute([&]() {
+            if (radius > 0) {
+                index.SearchHybrid(queries, radius, knn, indices, distances,
+                                   sort);
+            } else {
+                index.SearchKnn(queries, knn, indices, distances, sort);
+            }
+        });
+        benchmark::DoNotOptimize(indices.GetDataPtr());
+    }
+}
+
+#define ENUM_BM_NANOFLANN(NAME, RADIUS, SORT)                                \
+    BENCHMARK_CAPTURE(NanoFlannSearch, NAME##_100000_1, 100000, 1, RADIUS,   \
+                      SORT)                                                  \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(NanoFlannSearch, NAME##_100000_4, 100000, 4, RADIUS,   \
+                      SORT)                                                  \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(NanoFlannSearch, NAME##_1000000_1, 1000000, 1, RADIUS, \
+                      SORT)                                                  \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(NanoFlannSearch, NAME##_1000000_4, 1000000, 4, RADIUS, \
+                      SORT)                                                  \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BM_NANOFLANN(Knn, 0, true)
+ENUM_BM_NANOFLANN(KnnUnsorted, 0, false)
+ENUM_BM_NANOFLANN(Hybrid, 0.02, true)
+
+}  // namespace core
+}  // namespace open3d
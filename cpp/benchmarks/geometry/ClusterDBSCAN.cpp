@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <unordered_set>
+
+#include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// The kd-tree based DBSCAN that PointCloud::ClusterDBSCAN replaced. It keeps
+// all radius neighbors in memory and expands clusters sequentially.
+static std::vector<int> ClusterDBSCANKDTree(const geometry::PointCloud& pcd,
+                                            double eps,
+                                            size_t min_points) {
+    geometry::KDTreeFlann kdtree(pcd);
+    std::vector<std::vector<int>> nbs(pcd.points_.size());
+#pragma omp parallel for schedule(static)
+    for (int idx = 0; idx < int(pcd.points_.size()); ++idx) {
+        std::vector<double> dists2;
+        kdtree.SearchRadius(pcd.points_[idx], eps, nbs[idx], dists2);
+    }
+
+    std::vector<int> labels(pcd.points_.size(), -2);
+    int cluster_label = 0;
+    for (size_t idx = 0; idx < pcd.points_.size(); ++idx) {
+        if (labels[idx] != -2) continue;
+        if (nbs[idx].size() < min_points) {
+            labels[idx] = -1;
+            continue;
+        }
+        std::unordered_set<int> nbs_next(nbs[idx].begin(), nbs[idx].end());
+        std::unordered_set<int> nbs_visited;
+        nbs_visited.insert(int(idx));
+        labels[idx] = cluster_label;
+        while (!nbs_next.empty()) {
+            int nb = *nbs_next.begin();
+            nbs_next.erase(nbs_next.begin());
+            nbs_visited.insert(nb);
+            if (labels[nb] == -1) labels[nb] = cluster_label;
+            if (labels[nb] != -2) continue;
+            labels[nb] = cluster_label;
+            if (nbs[nb].size() >= min_points) {
+                for (int qnb : nbs[nb]) {
+                    if (nbs_visited.count(qnb) == 0) nbs_next.insert(qnb);
+                }
+            }
+        }
+        cluster_label++;
+    }
+    return labels;
+}
+
+class ClusterDBSCANFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        pcd_ = io::CreatePointCloudFromFile(TEST_DATA_DIR "/fragment.pcd");
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<geometry::PointCloud> pcd_;
+};
+
+// Arguments are eps in millimeters and min_points.
+BENCHMARK_DEFINE_F(ClusterDBSCANFixture, Grid)(benchmark::State& state) {
+    for (auto _ : state) {
+        pcd_->ClusterDBSCAN(state.range(0) * 1e-3, state.range(1));
+    }
+}
+
+BENCHMARK_DEFINE_F(ClusterDBSCANFixture, KDTree)(benchmark::State& state) {
+    for (auto _ : state) {
+        ClusterDBSCANKDTree(*pcd_, state.range(0) * 1e-3, state.range(1));
+    }
+}
+
+BENCHMARK_REGISTER_F(ClusterDBSCANFixture, Grid)
+        ->Args({5, 3})
+        ->Args({20, 10})
+        ->Args({50, 30})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ClusterDBSCANFixture, KDTree)
+        ->Args({5, 3})
+        ->Args({20, 10})
+        ->Args({50, 30})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/Octree.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/LinearOctree.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+
+namespace open3d {
+namespace benchmarks {
+
+class OctreeFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        pcd_ = io::CreatePointCloudFromFile(TEST_DATA_DIR "/fragment.pcd");
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<geometry::PointCloud> pcd_;
+};
+
+BENCHMARK_DEFINE_F(OctreeFixture, ConvertFromPointCloud)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        geometry::Octree octree(state.range(0));
+        octree.ConvertFromPointCloud(*pcd_, 0.01);
+    }
+}
+
+BENCHMARK_DEFINE_F(OctreeFixture, LinearConvertFromPointCloud)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        geometry::LinearOctree octree(state.range(0));
+        octree.ConvertFromPointCloud(*pcd_, 0.01);
+    }
+}
+
+BENCHMARK_DEFINE_F(OctreeFixture, Traverse)(benchmark::State& state) {
+    geometry::Octree octree(state.range(0));
+    octree.ConvertFromPointCloud(*pcd_, 0.01);
+    for (auto _ : state) {
+        size_t num_nodes = 0;
+        auto f_count =
+                [&num_nodes](const std::shared_ptr<geometry::OctreeNode>&,
+                             const std::shared_ptr<geometry::OctreeNodeInfo>&)
+                -> bool {
+            num_nodes++;
+            return false;
+        };
+        octree.Traverse(f_count);
+        benchmark::DoNotOptimize(num_nodes);
+    }
+}
+
+BENCHMARK_DEFINE_F(OctreeFixture, LinearTraverse)(benchmark::State& state) {
+    geometry::LinearOctree octree(state.range(0));
+    octree.ConvertFromPointCloud(*pcd_, 0.01);
+    for (auto _ : state) {
+        size_t num_nodes = 0;
+        octree.Traverse([&num_nodes](size_t, const geometry::OctreeNodeInfo&)
+                                -> bool {
+            num_nodes++;
+            return false;
+        });
+        benchmark::DoNotOptimize(num_nodes);
+    }
+}
+
+BENCHMARK_REGISTER_F(OctreeFixture, ConvertFromPointCloud)
+        ->Arg(6)
+        ->Arg(10)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(OctreeFixture, LinearConvertFromPointCloud)
+        ->Arg(6)
+        ->Arg(10)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(OctreeFixture, Traverse)
+        ->Arg(6)
+        ->Arg(10)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(OctreeFixture, LinearTraverse)
+        ->Arg(6)
+        ->Arg(10)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,130 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/TriangleMeshIO.h"
+
+namespace open3d {
+namespace benchmarks {
+
+class SimplifyFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        auto knot = io::CreateMeshFromFile(TEST_DATA_DIR "/knot.ply");
+        trimesh = knot->SubdivideLoop(3);
+        samples = trimesh->SamplePointsUniformly(100000);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+
+    // Mean and maximum of the symmetric distance between the surfaces, both
+    // estimated from uniformly sampled points.
+    void SetErrorCounters(benchmark::State& state,
+                          geometry::TriangleMesh& simplified) {
+        auto simplified_samples = simplified.SamplePointsUniformly(100000);
+        std::vector<double> dists =
+                samples->ComputePointCloudDistance(*simplified_samples);
+        std::vector<double> dists_back =
+                simplified_samples->ComputePointCloudDistance(*samples);
+        dists.insert(dists.end(), dists_back.begin(), dists_back.end());
+        double sum = 0;
+        double max = 0;
+        for (double dist : dists) {
+            sum += dist;
+            max = std::max(max, dist);
+        }
+        state.counters["MeanDistance"] = sum / double(dists.size());
+        state.counters["HausdorffDistance"] = max;
+        state.counters["Triangles"] = double(simplified.triangles_.size());
+    }
+
+    std::shared_ptr<geometry::TriangleMesh> trimesh;
+    std::shared_ptr<geometry::PointCloud> samples;
+};
+
+BENCHMARK_DEFINE_F(SimplifyFixture, QuadricDecimation)
+(benchmark::State& state) {
+    const int target = int(trimesh->triangles_.size()) / int(state.range(0));
+    std::shared_ptr<geometry::TriangleMesh> simplified;
+    for (auto _ : state) {
+        simplified = trimesh->SimplifyQuadricDecimation(
+                target, std::numeric_limits<double>::infinity(), 1.0);
+    }
+    SetErrorCounters(state, *simplified);
+}
+
+BENCHMARK_REGISTER_F(SimplifyFixture, QuadricDecimation)
+        ->Args({10})
+        ->Args({100})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(SimplifyFixture, QuadricDecimationParallel)
+(benchmark::State& state) {
+    const int target = int(trimesh->triangles_.size()) / int(state.range(0));
+    std::shared_ptr<geometry::TriangleMesh> simplified;
+    for (auto _ : state) {
+        simplified = trimesh->SimplifyQuadricDecimationParallel(
+                target, std::numeric_limits<double>::infinity(), 1.0);
+    }
+    SetErrorCounters(state, *simplified);
+}
+
+BENCHMARK_REGISTER_F(SimplifyFixture, QuadricDecimationParallel)
+        ->Args({10})
+        ->Args({100})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(SimplifyFixture, VertexClustering)
+(benchmark::State& state) {
+    const double voxel_size =
+            (trimesh->GetMaxBound() - trimesh->GetMinBound()).maxCoeff() /
+            double(state.range(0));
+    const auto contraction =
+            state.range(1) == 0
+                    ? geometry::TriangleMesh::SimplificationContraction::Average
+                    : geometry::TriangleMesh::SimplificationContraction::
+                              Quadric;
+    std::shared_ptr<geometry::TriangleMesh> simplified;
+    for (auto _ : state) {
+        simplified = trimesh->SimplifyVertexClustering(voxel_size, contraction);
+    }
+    state.counters["Triangles"] = double(simplified->triangles_.size());
+}
+
+BENCHMARK_REGISTER_F(SimplifyFixture, VertexClustering)
+        ->Args({32, 0})
+        ->Args({128, 0})
+        ->Args({32, 1})
+        ->Args({128, 1})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,91 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/VoxelGrid.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+
+namespace open3d {
+namespace benchmarks {
+
+class VoxelGridFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        pcd_ = io::CreatePointCloudFromFile(TEST_DATA_DIR "/fragment.pcd");
+        voxel_grid_ = geometry::VoxelGrid::CreateFromPointCloud(*pcd_, 0.01);
+        // Jittered copies of the points, about half of them hit a voxel
+        queries_.clear();
+        for (int k = 0; k < 5; ++k) {
+            for (const Eigen::Vector3d& point : pcd_->points_) {
+                queries_.push_back(point + Eigen::Vector3d(0.007, -0.003,
+                                                           0.005) *
+                                                   k);
+            }
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<geometry::PointCloud> pcd_;
+    std::shared_ptr<geometry::VoxelGrid> voxel_grid_;
+    std::vector<Eigen::Vector3d> queries_;
+};
+
+BENCHMARK_DEFINE_F(VoxelGridFixture, CreateFromPointCloud)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        geometry::VoxelGrid::CreateFromPointCloud(*pcd_, 0.01);
+    }
+}
+
+BENCHMARK_DEFINE_F(VoxelGridFixture, CheckIfIncluded)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(voxel_grid_->CheckIfIncluded(queries_));
+    }
+}
+
+BENCHMARK_DEFINE_F(VoxelGridFixture, FlatCheckIfIncluded)
+(benchmark::State& state) {
+    geometry::FlatVoxelGrid flat_voxel_grid(*voxel_grid_);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(flat_voxel_grid.CheckIfIncluded(queries_));
+    }
+}
+
+BENCHMARK_REGISTER_F(VoxelGridFixture, CreateFromPointCloud)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(VoxelGridFixture, CheckIfIncluded)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(VoxelGridFixture, FlatCheckIfIncluded)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
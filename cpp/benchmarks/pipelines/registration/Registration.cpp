@@ -33,6 +33,8 @@
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/pipelines/registration/CorrespondenceChecker.h"
+#include "open3d/pipelines/registration/Feature.h"
 #include "open3d/pipelines/registration/TransformationEstimation.h"
 #include "open3d/utility/Console.h"
 
@@ -131,6 +133,48 @@ BENCHMARK_CAPTURE(BenchmarkRegistrationICPLegacy,
                   TransformationEstimationType::PointToPoint)
         ->Unit(benchmark::kMillisecond);
 
+static void BenchmarkRegistrationRANSACLegacy(benchmark::State& state,
+                                             bool mutual_filter) {
+    geometry::PointCloud source;
+    geometry::PointCloud target;
+
+    std::tie(source, target) = LoadPointCloud(source_pointcloud_filename,
+                                              target_pointcloud_filename,
+                                              voxel_downsampling_factor);
+    const geometry::KDTreeSearchParamHybrid normal_param(
+            voxel_downsampling_factor * 2, 30);
+    source.EstimateNormals(normal_param);
+    target.EstimateNormals(normal_param);
+    const geometry::KDTreeSearchParamHybrid feature_param(
+            voxel_downsampling_factor * 5, 100);
+    auto source_fpfh = ComputeFPFHFeature(source, feature_param);
+    auto target_fpfh = ComputeFPFHFeature(target, feature_param);
+
+    const double distance_threshold = voxel_downsampling_factor * 1.5;
+    CorrespondenceCheckerBasedOnEdgeLength edge_length_checker(0.9);
+    CorrespondenceCheckerBasedOnDistance distance_checker(distance_threshold);
+    std::vector<std::reference_wrapper<const CorrespondenceChecker>> checkers =
+            {edge_length_checker, distance_checker};
+
+    RegistrationResult reg_result;
+    for (auto _ : state) {
+        reg_result = RegistrationRANSACBasedOnFeatureMatching(
+                source, target, *source_fpfh, *target_fpfh, mutual_filter,
+                distance_threshold, TransformationEstimationPointToPoint(false),
+                3, checkers, RANSACConvergenceCriteria(100000, 0.999));
+    }
+
+    utility::LogDebug(" Fitness: {}  Inlier RMSE: {}", reg_result.fitness_,
+                      reg_result.inlier_rmse_);
+}
+
+BENCHMARK_CAPTURE(BenchmarkRegistrationRANSACLegacy, MutualFilter / CPU, true)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkRegistrationRANSACLegacy, NoMutualFilter / CPU,
+                  false)
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
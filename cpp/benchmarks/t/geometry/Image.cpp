@@ -0,0 +1,155 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/Image.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/IPPImage.h"
+#include "open3d/t/geometry/kernel/Image.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+// Compares the native CPU kernels with IPP (when available) on VGA images.
+static core::Tensor MakeRandomImage(const core::Dtype& dtype,
+                                    int64_t channels) {
+    const int64_t rows = 480, cols = 640;
+    std::vector<float> values(rows * cols * channels);
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> dist(0.f, 255.f);
+    for (float& v : values) {
+        v = dist(rng);
+    }
+    return core::Tensor(values, {rows, cols, channels}, core::Dtype::Float32)
+            .To(dtype);
+}
+
+#ifdef WITH_IPPICV
+#define IMAGE_KERNEL_CALL(use_ipp, name, ...)  \
+    if (use_ipp) {                             \
+        ipp::name(__VA_ARGS__);                \
+    } else {                                   \
+        kernel::image::name##CPU(__VA_ARGS__); \
+    }
+#else
+#define IMAGE_KERNEL_CALL(use_ipp, name, ...) \
+    kernel::image::name##CPU(__VA_ARGS__);
+#endif
+
+void RGBToGray(benchmark::State& state,
+               const core::Dtype& dtype,
+               bool use_ipp) {
+    core::Tensor src = MakeRandomImage(dtype, 3);
+    core::Tensor dst({src.GetShape(0), src.GetShape(1), 1}, dtype);
+    for (auto _ : state) {
+        IMAGE_KERNEL_CALL(use_ipp, RGBToGray, src, dst);
+    }
+}
+
+void Resize(benchmark::State& state,
+            const core::Dtype& dtype,
+            Image::InterpType interp_type,
+            bool use_ipp) {
+    core::Tensor src = MakeRandomImage(dtype, 1);
+    core::Tensor dst({src.GetShape(0) / 2, src.GetShape(1) / 2, 1}, dtype);
+    for (auto _ : state) {
+        IMAGE_KERNEL_CALL(use_ipp, Resize, src, dst, interp_type);
+    }
+}
+
+void Dilate(benchmark::State& state, const core::Dtype& dtype, bool use_ipp) {
+    core::Tensor src = MakeRandomImage(dtype, 1);
+    core::Tensor dst = core::Tensor::EmptyLike(src);
+    for (auto _ : state) {
+        IMAGE_KERNEL_CALL(use_ipp, Dilate, src, dst, 5);
+    }
+}
+
+void FilterBox(benchmark::State& state,
+               const core::Dtype& dtype,
+               bool use_ipp) {
+    core::Tensor src = MakeRandomImage(dtype, 1);
+    core::Tensor dst = core::Tensor::EmptyLike(src);
+    core::Tensor kernel =
+            core::Tensor::Full({7, 7}, 1.f / 49, core::Dtype::Float32);
+    for (auto _ : state) {
+        IMAGE_KERNEL_CALL(use_ipp, Filter, src, dst, kernel);
+    }
+}
+
+void FilterGaussian(benchmark::State& state,
+                    const core::Dtype& dtype,
+                    bool use_ipp) {
+    core::Tensor src = MakeRandomImage(dtype, 1);
+    core::Tensor dst = core::Tensor::EmptyLike(src);
+    for (auto _ : state) {
+        IMAGE_KERNEL_CALL(use_ipp, FilterGaussian, src, dst, 5, 1.f);
+    }
+}
+
+void FilterBilateral(benchmark::State& state,
+                     const core::Dtype& dtype,
+                     bool use_ipp) {
+    core::Tensor src = MakeRandomImage(dtype, 1);
+    core::Tensor dst = core::Tensor::EmptyLike(src);
+    for (auto _ : state) {
+        IMAGE_KERNEL_CALL(use_ipp, FilterBilateral, src, dst, 5, 20.f, 10.f);
+    }
+}
+
+#define ENUM_IMAGE_BENCHMARKS(NAME, USE_IPP)                                 \
+    BENCHMARK_CAPTURE(RGBToGray, NAME##_UInt8, core::Dtype::UInt8, USE_IPP)  \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(Resize, NAME##_Linear_Float32, core::Dtype::Float32,   \
+                      Image::InterpType::Linear, USE_IPP)                    \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(Resize, NAME##_Super_UInt8, core::Dtype::UInt8,        \
+                      Image::InterpType::Super, USE_IPP)                     \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(Dilate, NAME##_UInt8, core::Dtype::UInt8, USE_IPP)     \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(FilterBox, NAME##_UInt8, core::Dtype::UInt8, USE_IPP)  \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(FilterGaussian, NAME##_Float32, core::Dtype::Float32,  \
+                      USE_IPP)                                               \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(FilterBilateral, NAME##_Float32, core::Dtype::Float32, \
+                      USE_IPP)                                               \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_IMAGE_BENCHMARKS(Native, false)
+#ifdef WITH_IPPICV
+ENUM_IMAGE_BENCHMARKS(IPP, true)
+#endif
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -357,6 +357,41 @@ void Indexer::ShrinkDim(int64_t dim, int64_t start, int64_t size) {
     }
 }
 
+bool Indexer::IsContiguous() const {
+    for (int64_t i = 0; i < num_inputs_; ++i) {
+        if (!IsContiguousInMasterShape(inputs_[i])) {
+            return false;
+        }
+    }
+    for (int64_t i = 0; i < num_outputs_; ++i) {
+        if (!IsContiguousInMasterShape(outputs_[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Indexer::IsInputScalar(int64_t i) const {
+    const TensorRef& tr = GetInput(i);
+    for (int64_t dim = 0; dim < ndims_; ++dim) {
+        if (master_shape_[dim] > 1 && tr.byte_strides_[dim] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Indexer::IsContiguousInMasterShape(const TensorRef& tr) const {
+    for (int64_t dim = 0; dim < ndims_; ++dim) {
+        if (master_shape_[dim] > 1 &&
+            tr.byte_strides_[dim] !=
+                    master_strides_[dim] * tr.dtype_byte_size_) {
+            return false;
+        }
+    }
+    return true;
+}
+
 int64_t Indexer::NumReductionDims() const {
     // All outputs have the same shape, so  it's okay to use outputs_[0].
     int64_t count = 0;
@@ -386,6 +386,26 @@ public:
         return GetOutput(0);
     }
 
+    /// Returns true if the \p i -th input is packed along the workloads, i.e.
+    /// workload_idx maps to the workload_idx-th element after the input's
+    /// data pointer, without broadcasting or striding.
+    bool IsInputContiguous(int64_t i) const {
+        return IsContiguousInMasterShape(GetInput(i));
+    }
+
+    /// Returns true if the \p i -th output is packed along the workloads.
+    bool IsOutputContiguous(int64_t i = 0) const {
+        return IsContiguousInMasterShape(GetOutput(i));
+    }
+
+    /// Returns true if all inputs and outputs are packed along the workloads,
+    /// such that the op can be computed over raw pointers.
+    bool IsContiguous() const;
+
+    /// Returns true if the \p i -th input holds a single element broadcasted
+    /// to all workloads.
+    bool IsInputScalar(int64_t i) const;
+
     /// Returns true if the \p dim -th dimension is reduced.
     bool IsReductionDim(int64_t dim) const {
         // All outputs have the same shape and reduction dims. Even if they
@@ -429,6 +449,10 @@ protected:
     // thread coalescing.
     void ReorderDimensions(const SizeVector& reduction_dims);
 
+    /// Returns true if \p tr's byte strides are the default strides of
+    /// master_shape_. Dimensions of size 1 are ignored.
+    bool IsContiguousInMasterShape(const TensorRef& tr) const;
+
     /// Update master_strides_ based on master_shape_.
     void UpdateMasterStrides();
 
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <stdexcept>
@@ -88,6 +89,61 @@ public:
                 size_t num_bytes) override;
 };
 
+/// CPU memory manager that caches freed blocks for reuse.
+///
+/// Requests are rounded up to one of a fixed set of size classes (4 per power
+/// of two). Freed blocks of small classes go to a lock-free thread-local free
+/// list first and to a process-wide pool otherwise, so loops that repeatedly
+/// allocate and free the same shapes stop hitting the system allocator.
+/// Blocks larger than 256 MiB are never cached.
+///
+/// This is the CPU memory manager unless Open3D is built with
+/// BUILD_CACHED_CPU_MANAGER=OFF, in which case CPUMemoryManager is used.
+///
+/// Caching is disabled by default, in which case every call goes to the
+/// system allocator. It can be toggled at any time with SetCacheEnabled();
+/// blocks allocated in either mode can be freed in the other.
+class CPUCachedMemoryManager : public DeviceMemoryManager {
+public:
+    /// Allocation counters, accumulated since the last ResetStatistics().
+    struct Statistics {
+        int64_t num_malloc_ = 0;
+        int64_t num_free_ = 0;
+        /// Number of Malloc calls served from the cache.
+        int64_t num_cache_hits_ = 0;
+        /// Number of calls to the system allocator.
+        int64_t num_system_malloc_ = 0;
+        int64_t num_system_free_ = 0;
+        /// Bytes currently handed out, including size class rounding.
+        int64_t in_use_bytes_ = 0;
+        /// Bytes currently held in the cache.
+        int64_t cached_bytes_ = 0;
+    };
+
+public:
+    CPUCachedMemoryManager();
+    void* Malloc(size_t byte_size, const Device& device) override;
+    void Free(void* ptr, const Device& device) override;
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+
+public:
+    /// Enables or disables caching. Disabling also releases the cache.
+    static void SetCacheEnabled(bool enabled);
+    static bool IsCacheEnabled();
+    /// Upper bound of bytes kept in the shared pool, 1 GiB by default. Blocks
+    /// freed beyond the limit are returned to the system.
+    static void SetMaxCachedBytes(size_t max_cached_bytes);
+    /// Returns cached blocks of the shared pool and of the calling thread to
+    /// the system. Other threads hand their small blocks back on exit.
+    static void ReleaseCache();
+    static Statistics GetStatistics();
+    static void ResetStatistics();
+};
+
 #ifdef BUILD_CUDA_MODULE
 class CUDASimpleMemoryManager : public DeviceMemoryManager {
 public:
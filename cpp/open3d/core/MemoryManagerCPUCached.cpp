@@ -0,0 +1,468 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+// Every block handed out by CPUCachedMemoryManager is preceded by a header
+// that records how it was allocated. The header is always written, so that
+// blocks allocated while caching is disabled can still be freed after it is
+// enabled, and vice versa. 64 bytes keeps the user pointer cache-line aligned
+// relative to the system allocation.
+struct CPUBlockHeader {
+    int64_t size_class_;  // -1 for uncached blocks.
+    int64_t byte_size_;   // Bytes usable by the caller.
+};
+static constexpr size_t kHeaderSize = 64;
+static_assert(sizeof(CPUBlockHeader) <= kHeaderSize,
+              "CPUBlockHeader does not fit in the reserved header space.");
+
+// Size classes: everything up to 64 bytes shares class 0, then each power of
+// two (2^k, 2^(k+1)] is divided into 4 equally spaced classes. Rounding up to
+// the class size wastes at most 25% of a block.
+static constexpr size_t kMinBlockSize = 64;
+static constexpr int kMinBlockLog2 = 6;
+static constexpr int kClassesPerOctave = 4;
+// Blocks larger than 256 MiB are not worth caching and go straight to the
+// system allocator.
+static constexpr int kMaxBlockLog2 = 28;
+static constexpr size_t kMaxCachedBlockSize = size_t(1) << kMaxBlockLog2;
+static constexpr int kNumSizeClasses =
+        1 + (kMaxBlockLog2 - kMinBlockLog2) * kClassesPerOctave;
+
+// Classes up to 64 KiB are additionally kept in a per-thread free list that
+// is accessed without locking.
+static constexpr size_t kMaxThreadLocalBlockSize = 65536;
+static constexpr size_t kMaxThreadLocalBlocksPerClass = 4;
+
+static int GetSizeClass(size_t byte_size) {
+    if (byte_size <= kMinBlockSize) {
+        return 0;
+    }
+    int msb = 0;
+    for (size_t v = byte_size - 1; v >>= 1;) {
+        ++msb;
+    }
+    const size_t sub = ((byte_size - 1) - (size_t(1) << msb)) >> (msb - 2);
+    return 1 + (msb - kMinBlockLog2) * kClassesPerOctave +
+           static_cast<int>(sub);
+}
+
+static size_t GetSizeClassBytes(int size_class) {
+    if (size_class == 0) {
+        return kMinBlockSize;
+    }
+    const int msb = kMinBlockLog2 + (size_class - 1) / kClassesPerOctave;
+    const size_t sub = (size_class - 1) % kClassesPerOctave;
+    return (size_t(1) << msb) + (sub + 1) * (size_t(1) << (msb - 2));
+}
+
+static CPUBlockHeader* GetHeader(void* ptr) {
+    return reinterpret_cast<CPUBlockHeader*>(static_cast<char*>(ptr) -
+                                             kHeaderSize);
+}
+
+/// Allocation counters. Each thread owns one set, so that the hot path can
+/// update them with plain relaxed loads and stores instead of locked
+/// read-modify-write instructions. Counters written by several threads are
+/// marked as shared and use atomic additions.
+struct CPUCacheCounters {
+    explicit CPUCacheCounters(bool shared) : shared_(shared) {}
+
+    void Add(std::atomic<int64_t>& counter, int64_t value) {
+        if (shared_) {
+            counter.fetch_add(value, std::memory_order_relaxed);
+        } else {
+            counter.store(counter.load(std::memory_order_relaxed) + value,
+                          std::memory_order_relaxed);
+        }
+    }
+
+    void AddTo(CPUCachedMemoryManager::Statistics& stats) const {
+        stats.num_malloc_ += num_malloc_.load(std::memory_order_relaxed);
+        stats.num_free_ += num_free_.load(std::memory_order_relaxed);
+        stats.num_cache_hits_ +=
+                num_cache_hits_.load(std::memory_order_relaxed);
+        stats.num_system_malloc_ +=
+                num_system_malloc_.load(std::memory_order_relaxed);
+        stats.num_system_free_ +=
+                num_system_free_.load(std::memory_order_relaxed);
+        stats.in_use_bytes_ += in_use_bytes_.load(std::memory_order_relaxed);
+        stats.cached_bytes_ += cached_bytes_.load(std::memory_order_relaxed);
+    }
+
+    const bool shared_;
+    std::atomic<int64_t> num_malloc_{0};
+    std::atomic<int64_t> num_free_{0};
+    std::atomic<int64_t> num_cache_hits_{0};
+    std::atomic<int64_t> num_system_malloc_{0};
+    std::atomic<int64_t> num_system_free_{0};
+    // Byte counts of a single thread may be negative, e.g. for blocks that
+    // are freed by another thread than the one that allocated them.
+    std::atomic<int64_t> in_use_bytes_{0};
+    std::atomic<int64_t> cached_bytes_{0};
+};
+
+static void* SystemMalloc(size_t byte_size,
+                          int64_t size_class,
+                          CPUCacheCounters& counters) {
+    void* raw_ptr = std::malloc(kHeaderSize + byte_size);
+    if (!raw_ptr) {
+        utility::LogError("CPU malloc failed");
+    }
+    counters.Add(counters.num_system_malloc_, 1);
+    void* ptr = static_cast<char*>(raw_ptr) + kHeaderSize;
+    CPUBlockHeader* header = GetHeader(ptr);
+    header->size_class_ = size_class;
+    header->byte_size_ = static_cast<int64_t>(byte_size);
+    return ptr;
+}
+
+static void SystemFree(void* ptr, CPUCacheCounters& counters) {
+    std::free(static_cast<char*>(ptr) - kHeaderSize);
+    counters.Add(counters.num_system_free_, 1);
+}
+
+// Process-wide pool of free blocks, one free list per size class. Shared by
+// all threads and protected by a single mutex; the per-thread caches in front
+// of it absorb most of the small-block traffic.
+//
+// The cacher also keeps track of the counters of all live threads, and
+// accumulates the counters of exited threads in retired_counters_.
+class CPUCacher {
+public:
+    static const std::shared_ptr<CPUCacher>& GetInstance() {
+        static std::shared_ptr<CPUCacher> instance =
+                std::make_shared<CPUCacher>();
+        return instance;
+    }
+
+    CPUCacher() : retired_counters_(true), free_blocks_(kNumSizeClasses) {}
+
+    ~CPUCacher() { ReleaseCache(retired_counters_); }
+
+    /// Returns a cached block of \p size_class, or nullptr.
+    void* Pop(int size_class, CPUCacheCounters& counters) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<void*>& blocks = free_blocks_[size_class];
+        if (blocks.empty()) {
+            return nullptr;
+        }
+        void* ptr = blocks.back();
+        blocks.pop_back();
+        pool_bytes_ -= GetHeader(ptr)->byte_size_;
+        counters.Add(counters.cached_bytes_, -GetHeader(ptr)->byte_size_);
+        return ptr;
+    }
+
+    /// Keeps \p ptr for reuse, or returns it to the system if the pool is
+    /// full.
+    void Push(void* ptr, CPUCacheCounters& counters) {
+        const int64_t byte_size = GetHeader(ptr)->byte_size_;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (pool_bytes_ + byte_size <=
+                max_cached_bytes_.load(std::memory_order_relaxed)) {
+                free_blocks_[GetHeader(ptr)->size_class_].push_back(ptr);
+                pool_bytes_ += byte_size;
+                counters.Add(counters.cached_bytes_, byte_size);
+                return;
+            }
+        }
+        SystemFree(ptr, counters);
+    }
+
+    void ReleaseCache(CPUCacheCounters& counters) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (std::vector<void*>& blocks : free_blocks_) {
+            for (void* ptr : blocks) {
+                counters.Add(counters.cached_bytes_,
+                             -GetHeader(ptr)->byte_size_);
+                SystemFree(ptr, counters);
+            }
+            blocks.clear();
+        }
+        pool_bytes_ = 0;
+    }
+
+    void RegisterCounters(CPUCacheCounters* counters) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        thread_counters_.push_back(counters);
+    }
+
+    void UnregisterCounters(CPUCacheCounters* counters) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        CPUCachedMemoryManager::Statistics stats;
+        counters->AddTo(stats);
+        retired_counters_.Add(retired_counters_.num_malloc_, stats.num_malloc_);
+        retired_counters_.Add(retired_counters_.num_free_, stats.num_free_);
+        retired_counters_.Add(retired_counters_.num_cache_hits_,
+                              stats.num_cache_hits_);
+        retired_counters_.Add(retired_counters_.num_system_malloc_,
+                              stats.num_system_malloc_);
+        retired_counters_.Add(retired_counters_.num_system_free_,
+                              stats.num_system_free_);
+        retired_counters_.Add(retired_counters_.in_use_bytes_,
+                              stats.in_use_bytes_);
+        retired_counters_.Add(retired_counters_.cached_bytes_,
+                              stats.cached_bytes_);
+        thread_counters_.erase(std::remove(thread_counters_.begin(),
+                                           thread_counters_.end(), counters),
+                               thread_counters_.end());
+    }
+
+    /// Counters of all threads since the last ResetStatistics(). Counts of
+    /// other threads may lag behind by the operations they are executing
+    /// concurrently.
+    CPUCachedMemoryManager::Statistics GetStatistics() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        CPUCachedMemoryManager::Statistics stats = GetTotalStatistics();
+        stats.num_malloc_ -= baseline_.num_malloc_;
+        stats.num_free_ -= baseline_.num_free_;
+        stats.num_cache_hits_ -= baseline_.num_cache_hits_;
+        stats.num_system_malloc_ -= baseline_.num_system_malloc_;
+        stats.num_system_free_ -= baseline_.num_system_free_;
+        return stats;
+    }
+
+    void ResetStatistics() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        baseline_ = GetTotalStatistics();
+    }
+
+public:
+    std::atomic<bool> enabled_{false};
+    std::atomic<int64_t> max_cached_bytes_{int64_t(1) << 30};
+    /// Counters of exited threads, and of threads being torn down.
+    CPUCacheCounters retired_counters_;
+
+private:
+    /// Sum of the counters of all threads, mutex_ must be held.
+    CPUCachedMemoryManager::Statistics GetTotalStatistics() const {
+        CPUCachedMemoryManager::Statistics stats;
+        retired_counters_.AddTo(stats);
+        for (const CPUCacheCounters* counters : thread_counters_) {
+            counters->AddTo(stats);
+        }
+        return stats;
+    }
+
+    /// Counts subtracted by GetStatistics(), set by ResetStatistics().
+    CPUCachedMemoryManager::Statistics baseline_;
+    std::mutex mutex_;
+    std::vector<std::vector<void*>> free_blocks_;
+    int64_t pool_bytes_ = 0;
+    std::vector<CPUCacheCounters*> thread_counters_;
+};
+
+static bool IsThreadLocalClass(int size_class) {
+    return GetSizeClassBytes(size_class) <= kMaxThreadLocalBlockSize;
+}
+
+// Lock-free front-end for small blocks, together with the thread's counters.
+// Blocks left in the cache when the thread exits are handed back to the
+// shared pool.
+class CPUThreadCache {
+public:
+    /// Returns the calling thread's cache, or nullptr while the thread is
+    /// being torn down and the cache has already been destroyed.
+    static CPUThreadCache* GetInstance() {
+        static thread_local bool destroyed = false;
+        static thread_local CPUThreadCache instance(&destroyed);
+        return destroyed ? nullptr : &instance;
+    }
+
+    explicit CPUThreadCache(bool* destroyed)
+        : counters_(false),
+          cacher_(CPUCacher::GetInstance()),
+          free_blocks_(GetSizeClass(kMaxThreadLocalBlockSize) + 1),
+          destroyed_(destroyed) {
+        cacher_->RegisterCounters(&counters_);
+    }
+
+    ~CPUThreadCache() {
+        ReleaseCache();
+        cacher_->UnregisterCounters(&counters_);
+        *destroyed_ = true;
+    }
+
+    void* Pop(int size_class) {
+        std::vector<void*>& blocks = free_blocks_[size_class];
+        if (blocks.empty()) {
+            return nullptr;
+        }
+        void* ptr = blocks.back();
+        blocks.pop_back();
+        counters_.Add(counters_.cached_bytes_, -GetHeader(ptr)->byte_size_);
+        return ptr;
+    }
+
+    /// Returns false if the thread-local list for the class is full.
+    bool Push(void* ptr) {
+        const CPUBlockHeader* header = GetHeader(ptr);
+        std::vector<void*>& blocks = free_blocks_[header->size_class_];
+        if (blocks.size() >= kMaxThreadLocalBlocksPerClass) {
+            return false;
+        }
+        blocks.push_back(ptr);
+        counters_.Add(counters_.cached_bytes_, header->byte_size_);
+        return true;
+    }
+
+    /// Moves all blocks to the shared pool.
+    void ReleaseCache() {
+        for (std::vector<void*>& blocks : free_blocks_) {
+            for (void* ptr : blocks) {
+                counters_.Add(counters_.cached_bytes_,
+                              -GetHeader(ptr)->byte_size_);
+                cacher_->Push(ptr, counters_);
+            }
+            blocks.clear();
+        }
+    }
+
+public:
+    CPUCacheCounters counters_;
+
+private:
+    std::shared_ptr<CPUCacher> cacher_;
+    std::vector<std::vector<void*>> free_blocks_;
+    bool* destroyed_;
+};
+
+CPUCachedMemoryManager::CPUCachedMemoryManager() {}
+
+void* CPUCachedMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    const std::shared_ptr<CPUCacher>& cacher = CPUCacher::GetInstance();
+    CPUThreadCache* thread_cache = CPUThreadCache::GetInstance();
+    CPUCacheCounters& counters =
+            thread_cache ? thread_cache->counters_ : cacher->retired_counters_;
+    counters.Add(counters.num_malloc_, 1);
+
+    if (!cacher->enabled_.load(std::memory_order_relaxed) ||
+        byte_size > kMaxCachedBlockSize) {
+        counters.Add(counters.in_use_bytes_, static_cast<int64_t>(byte_size));
+        return SystemMalloc(byte_size, -1, counters);
+    }
+
+    const int size_class = GetSizeClass(byte_size);
+    const size_t block_size = GetSizeClassBytes(size_class);
+    counters.Add(counters.in_use_bytes_, static_cast<int64_t>(block_size));
+
+    void* ptr = nullptr;
+    if (thread_cache && IsThreadLocalClass(size_class)) {
+        ptr = thread_cache->Pop(size_class);
+    }
+    if (!ptr) {
+        ptr = cacher->Pop(size_class, counters);
+    }
+    if (ptr) {
+        counters.Add(counters.num_cache_hits_, 1);
+        return ptr;
+    }
+    return SystemMalloc(block_size, size_class, counters);
+}
+
+void CPUCachedMemoryManager::Free(void* ptr, const Device& device) {
+    if (!ptr) {
+        return;
+    }
+    const std::shared_ptr<CPUCacher>& cacher = CPUCacher::GetInstance();
+    CPUThreadCache* thread_cache = CPUThreadCache::GetInstance();
+    CPUCacheCounters& counters =
+            thread_cache ? thread_cache->counters_ : cacher->retired_counters_;
+    const CPUBlockHeader* header = GetHeader(ptr);
+    counters.Add(counters.num_free_, 1);
+    counters.Add(counters.in_use_bytes_, -header->byte_size_);
+
+    if (header->size_class_ < 0 ||
+        !cacher->enabled_.load(std::memory_order_relaxed)) {
+        SystemFree(ptr, counters);
+        return;
+    }
+    if (thread_cache &&
+        IsThreadLocalClass(static_cast<int>(header->size_class_)) &&
+        thread_cache->Push(ptr)) {
+        return;
+    }
+    cacher->Push(ptr, counters);
+}
+
+void CPUCachedMemoryManager::Memcpy(void* dst_ptr,
+                                    const Device& dst_device,
+                                    const void* src_ptr,
+                                    const Device& src_device,
+                                    size_t num_bytes) {
+    std::memcpy(dst_ptr, src_ptr, num_bytes);
+}
+
+void CPUCachedMemoryManager::SetCacheEnabled(bool enabled) {
+    CPUCacher::GetInstance()->enabled_.store(enabled);
+    if (!enabled) {
+        ReleaseCache();
+    }
+}
+
+bool CPUCachedMemoryManager::IsCacheEnabled() {
+    return CPUCacher::GetInstance()->enabled_.load();
+}
+
+void CPUCachedMemoryManager::SetMaxCachedBytes(size_t max_cached_bytes) {
+    CPUCacher::GetInstance()->max_cached_bytes_.store(
+            static_cast<int64_t>(max_cached_bytes));
+}
+
+void CPUCachedMemoryManager::ReleaseCache() {
+    const std::shared_ptr<CPUCacher>& cacher = CPUCacher::GetInstance();
+    CPUThreadCache* thread_cache = CPUThreadCache::GetInstance();
+    if (thread_cache) {
+        thread_cache->ReleaseCache();
+    }
+    cacher->ReleaseCache(thread_cache ? thread_cache->counters_
+                                      : cacher->retired_counters_);
+}
+
+CPUCachedMemoryManager::Statistics CPUCachedMemoryManager::GetStatistics() {
+    return CPUCacher::GetInstance()->GetStatistics();
+}
+
+void CPUCachedMemoryManager::ResetStatistics() {
+    // Byte counts describe the current state and are not reset.
+    CPUCacher::GetInstance()->ResetStatistics();
+}
+
+}  // namespace core
+}  // namespace open3d
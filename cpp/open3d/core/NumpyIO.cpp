@@ -50,6 +50,9 @@
 
 #include "open3d/core/NumpyIO.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <regex>
@@ -59,6 +62,7 @@
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
 
 namespace open3d {
 namespace core {
@@ -155,19 +159,80 @@ static std::vector<char> CreateNumpyHeader(const SizeVector& shape,
     return std::vector<char>(s.begin(), s.end());
 }
 
+using FilePtr = std::unique_ptr<FILE, int (*)(FILE*)>;
+using utility::filesystem::MappedFile;
+
+static FilePtr OpenFile(const std::string& file_name) {
+    FilePtr fp(fopen(file_name.c_str(), "rb"), fclose);
+    if (!fp) {
+        utility::LogError("NumpyLoad: Unable to open file {}.", file_name);
+    }
+    return fp;
+}
+
+static void ReadBytes(FILE* fp, void* dst, int64_t num_bytes) {
+    size_t nread = fread(dst, 1, static_cast<size_t>(num_bytes), fp);
+    if (nread != static_cast<size_t>(num_bytes)) {
+        utility::LogError("NumpyLoad: failed fread");
+    }
+}
+
+static void SeekTo(FILE* fp, int64_t offset) {
+#ifdef _WIN32
+    int ret = _fseeki64(fp, offset, SEEK_SET);
+#else
+    int ret = fseeko(fp, static_cast<off_t>(offset), SEEK_SET);
+#endif
+    if (ret != 0) {
+        utility::LogError("NumpyLoad: failed to seek to offset {}.", offset);
+    }
+}
+
+static int64_t Tell(FILE* fp) {
+#ifdef _WIN32
+    return static_cast<int64_t>(_ftelli64(fp));
+#else
+    return static_cast<int64_t>(ftello(fp));
+#endif
+}
+
+template <typename T>
+static T FromLittleEndian(const char* data) {
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T); i++) {
+        value |= static_cast<T>(static_cast<unsigned char>(data[i]))
+                 << (8 * i);
+    }
+    return value;
+}
+
+/// Parses the .npy header at the current position of fp, leaving fp at the
+/// beginning of the array data.
 static std::tuple<char, int64_t, SizeVector, bool> ParseNumpyHeader(FILE* fp) {
     char type;
     int64_t word_size;
     SizeVector shape;
     bool fortran_order;
 
-    char buffer[256];
-    size_t res = fread(buffer, sizeof(char), 11, fp);
-    if (res != 11) {
-        utility::LogError("ParseNumpyHeader: failed fread");
+    // Magic string "\x93NUMPY", major and minor version, followed by the
+    // header length: 2 bytes in version 1.0, 4 bytes in version 2.0 and 3.0.
+    char preamble[12];
+    ReadBytes(fp, preamble, 8);
+    if (static_cast<unsigned char>(preamble[0]) != 0x93 ||
+        std::memcmp(preamble + 1, "NUMPY", 5) != 0) {
+        utility::LogError("ParseNumpyHeader: invalid magic string");
     }
-    std::string header = fgets(buffer, 256, fp);
-    if (header[header.size() - 1] != '\n') {
+    int64_t header_size;
+    if (preamble[6] == 1) {
+        ReadBytes(fp, preamble + 8, 2);
+        header_size = FromLittleEndian<uint16_t>(preamble + 8);
+    } else {
+        ReadBytes(fp, preamble + 8, 4);
+        header_size = FromLittleEndian<uint32_t>(preamble + 8);
+    }
+    std::string header(static_cast<size_t>(header_size), '\0');
+    ReadBytes(fp, &header[0], header_size);
+    if (header.empty() || header[header.size() - 1] != '\n') {
         utility::LogError("ParseNumpyHeader: the last char must be '\n'");
     }
 
@@ -199,7 +264,7 @@ static std::tuple<char, int64_t, SizeVector, bool> ParseNumpyHeader(FILE* fp) {
 
     std::string str_shape = header.substr(loc1 + 1, loc2 - loc1 - 1);
     while (std::regex_search(str_shape, sm, num_regex)) {
-        shape.push_back(std::stoi(sm[0].str()));
+        shape.push_back(std::stoll(sm[0].str()));
         str_shape = sm.suffix().str();
     }
 
@@ -243,6 +308,18 @@ NumpyArray::NumpyArray(const SizeVector& shape,
     blob_ = std::make_shared<Blob>(num_elements_ * word_size_, Device("CPU:0"));
 }
 
+NumpyArray::NumpyArray(const SizeVector& shape,
+                       char type,
+                       int64_t word_size,
+                       bool fortran_order,
+                       const std::shared_ptr<Blob>& blob)
+    : blob_(blob),
+      shape_(shape),
+      type_(type),
+      word_size_(word_size),
+      fortran_order_(fortran_order),
+      num_elements_(shape.NumElements()) {}
+
 NumpyArray::NumpyArray(const Tensor& t)
     : shape_(t.GetShape()),
       type_(DtypeToChar(t.GetDtype())),
@@ -284,24 +361,210 @@ Tensor NumpyArray::ToTensor() const {
     return t;
 }
 
-NumpyArray NumpyArray::Load(const std::string& file_name) {
-    FILE* fp = fopen(file_name.c_str(), "rb");
-    if (!fp) {
-        utility::LogError("NumpyLoad: Unable to open file {}.", file_name);
+/// Returns the array data of num_bytes bytes at the current position of fp.
+/// Without a mapping the data is read from fp. Otherwise the returned blob
+/// references the mapped pages and keeps the mapping alive, unless the data
+/// is misaligned for its element type, in which case it is copied.
+static std::shared_ptr<Blob> ReadNumpyData(
+        FILE* fp,
+        int64_t num_bytes,
+        int64_t word_size,
+        const std::shared_ptr<MappedFile>& mapping) {
+    if (!mapping) {
+        auto blob = std::make_shared<Blob>(num_bytes, Device("CPU:0"));
+        ReadBytes(fp, blob->GetDataPtr(), num_bytes);
+        return blob;
     }
+    int64_t offset = Tell(fp);
+    if (offset < 0 || offset + num_bytes > mapping->GetSize()) {
+        utility::LogError("NumpyLoad: file is truncated");
+    }
+    char* data = mapping->GetData() + offset;
+    if (num_bytes == 0 || (word_size > 1 && offset % word_size != 0)) {
+        auto blob = std::make_shared<Blob>(num_bytes, Device("CPU:0"));
+        std::memcpy(blob->GetDataPtr(), data, static_cast<size_t>(num_bytes));
+        return blob;
+    }
+    return std::make_shared<Blob>(Device("CPU:0"), data,
+                                  [mapping](void*) {});
+}
+
+static std::shared_ptr<MappedFile> MapFile(const std::string& file_name,
+                                           NumpyArray::LoadMode mode) {
+    if (mode == NumpyArray::LoadMode::Read) {
+        return nullptr;
+    }
+    auto mapping = std::make_shared<MappedFile>();
+    if (!mapping->Open(file_name,
+                       mode == NumpyArray::LoadMode::MapCopyOnWrite)) {
+        utility::LogError("NumpyLoad: Unable to map file {}: {}", file_name,
+                          mapping->GetError());
+    }
+    return mapping;
+}
+
+NumpyArray NumpyArray::Load(const std::string& file_name, LoadMode mode) {
+    std::shared_ptr<MappedFile> mapping = MapFile(file_name, mode);
+    FilePtr fp = OpenFile(file_name);
     SizeVector shape;
     int64_t word_size;
     bool fortran_order;
     char type;
-    std::tie(type, word_size, shape, fortran_order) = ParseNumpyHeader(fp);
-    NumpyArray arr(shape, type, word_size, fortran_order);
-    size_t nread = fread(arr.GetDataPtr<char>(), 1,
-                         static_cast<size_t>(arr.NumBytes()), fp);
-    if (nread != static_cast<size_t>(arr.NumBytes())) {
-        utility::LogError("LoadTheNumpyFile: failed fread");
+    std::tie(type, word_size, shape, fortran_order) =
+            ParseNumpyHeader(fp.get());
+    std::shared_ptr<Blob> blob = ReadNumpyData(
+            fp.get(), shape.NumElements() * word_size, word_size, mapping);
+    return NumpyArray(shape, type, word_size, fortran_order, blob);
+}
+
+std::unordered_map<std::string, NumpyArray> NumpyArray::LoadNpz(
+        const std::string& file_name, LoadMode mode) {
+    std::shared_ptr<MappedFile> mapping = MapFile(file_name, mode);
+    FilePtr fp = OpenFile(file_name);
+
+    // The end of central directory record (22 bytes and a comment of up to
+    // 64 KiB) is at the end of the archive.
+    if (fseek(fp.get(), 0, SEEK_END) != 0) {
+        utility::LogError("LoadNpz: failed to seek in {}.", file_name);
     }
-    fclose(fp);
-    return arr;
+    const int64_t file_size = Tell(fp.get());
+    const int64_t kEocdSize = 22;
+    int64_t tail_size = std::min<int64_t>(file_size, kEocdSize + 65535);
+    std::vector<char> tail(static_cast<size_t>(tail_size));
+    SeekTo(fp.get(), file_size - tail_size);
+    ReadBytes(fp.get(), tail.data(), tail_size);
+    int64_t eocd = tail_size - kEocdSize;
+    while (eocd >= 0 &&
+           FromLittleEndian<uint32_t>(tail.data() + eocd) != 0x06054b50) {
+        eocd--;
+    }
+    if (eocd < 0) {
+        utility::LogError("LoadNpz: {} is not a zip archive.", file_name);
+    }
+    uint64_t num_entries = FromLittleEndian<uint16_t>(tail.data() + eocd + 10);
+    uint64_t cd_size = FromLittleEndian<uint32_t>(tail.data() + eocd + 12);
+    uint64_t cd_offset = FromLittleEndian<uint32_t>(tail.data() + eocd + 16);
+    if (num_entries == 0xFFFF || cd_size == 0xFFFFFFFF ||
+        cd_offset == 0xFFFFFFFF) {
+        // Zip64: the locator of the zip64 end of central directory record
+        // immediately precedes the regular record.
+        int64_t locator = file_size - tail_size + eocd - 20;
+        char buffer[56];
+        if (locator < 0) {
+            utility::LogError("LoadNpz: invalid zip64 archive {}.", file_name);
+        }
+        SeekTo(fp.get(), locator);
+        ReadBytes(fp.get(), buffer, 20);
+        if (FromLittleEndian<uint32_t>(buffer) != 0x07064b50) {
+            utility::LogError("LoadNpz: invalid zip64 archive {}.", file_name);
+        }
+        SeekTo(fp.get(),
+               static_cast<int64_t>(FromLittleEndian<uint64_t>(buffer + 8)));
+        ReadBytes(fp.get(), buffer, 56);
+        if (FromLittleEndian<uint32_t>(buffer) != 0x06064b50) {
+            utility::LogError("LoadNpz: invalid zip64 archive {}.", file_name);
+        }
+        num_entries = FromLittleEndian<uint64_t>(buffer + 32);
+        cd_size = FromLittleEndian<uint64_t>(buffer + 40);
+        cd_offset = FromLittleEndian<uint64_t>(buffer + 48);
+    }
+    if (cd_offset + cd_size > static_cast<uint64_t>(file_size)) {
+        utility::LogError("LoadNpz: {} is truncated.", file_name);
+    }
+    std::vector<char> cd(static_cast<size_t>(cd_size));
+    SeekTo(fp.get(), static_cast<int64_t>(cd_offset));
+    ReadBytes(fp.get(), cd.data(), static_cast<int64_t>(cd_size));
+
+    std::unordered_map<std::string, NumpyArray> arrays;
+    size_t pos = 0;
+    for (uint64_t i = 0; i < num_entries; i++) {
+        if (pos + 46 > cd.size() ||
+            FromLittleEndian<uint32_t>(cd.data() + pos) != 0x02014b50) {
+            utility::LogError("LoadNpz: invalid central directory in {}.",
+                              file_name);
+        }
+        const char* entry = cd.data() + pos;
+        uint16_t method = FromLittleEndian<uint16_t>(entry + 10);
+        uint64_t compressed_size = FromLittleEndian<uint32_t>(entry + 20);
+        uint64_t size = FromLittleEndian<uint32_t>(entry + 24);
+        size_t name_size = FromLittleEndian<uint16_t>(entry + 28);
+        size_t extra_size = FromLittleEndian<uint16_t>(entry + 30);
+        size_t comment_size = FromLittleEndian<uint16_t>(entry + 32);
+        uint64_t local_offset = FromLittleEndian<uint32_t>(entry + 42);
+        if (pos + 46 + name_size + extra_size > cd.size()) {
+            utility::LogError("LoadNpz: invalid central directory in {}.",
+                              file_name);
+        }
+        std::string name(entry + 46, name_size);
+
+        // Values that overflow 32 bits are stored in the zip64 extra field,
+        // in this order, and only if the regular field is 0xFFFFFFFF.
+        const char* extra = entry + 46 + name_size;
+        for (size_t e = 0; e + 4 <= extra_size;) {
+            uint16_t id = FromLittleEndian<uint16_t>(extra + e);
+            size_t field_size = FromLittleEndian<uint16_t>(extra + e + 2);
+            const char* field = extra + e + 4;
+            const char* field_end = field + field_size;
+            if (e + 4 + field_size > extra_size) {
+                break;
+            }
+            if (id == 0x0001) {
+                for (uint64_t* value : {&size, &compressed_size,
+                                        &local_offset}) {
+                    if (*value == 0xFFFFFFFF && field + 8 <= field_end) {
+                        *value = FromLittleEndian<uint64_t>(field);
+                        field += 8;
+                    }
+                }
+            }
+            e += 4 + field_size;
+        }
+        pos += 46 + name_size + extra_size + comment_size;
+
+        if (method != 0) {
+            utility::LogError(
+                    "LoadNpz: {} in {} is compressed, only archives written "
+                    "without compression (np.savez) are supported.",
+                    name, file_name);
+        }
+
+        char local[30];
+        SeekTo(fp.get(), static_cast<int64_t>(local_offset));
+        ReadBytes(fp.get(), local, 30);
+        if (FromLittleEndian<uint32_t>(local) != 0x04034b50) {
+            utility::LogError("LoadNpz: invalid local header of {} in {}.",
+                              name, file_name);
+        }
+        int64_t data_offset = static_cast<int64_t>(local_offset) + 30 +
+                              FromLittleEndian<uint16_t>(local + 26) +
+                              FromLittleEndian<uint16_t>(local + 28);
+        SeekTo(fp.get(), data_offset);
+
+        SizeVector shape;
+        int64_t word_size;
+        bool fortran_order;
+        char type;
+        std::tie(type, word_size, shape, fortran_order) =
+                ParseNumpyHeader(fp.get());
+        int64_t num_bytes = shape.NumElements() * word_size;
+        if (Tell(fp.get()) - data_offset + num_bytes >
+            static_cast<int64_t>(size)) {
+            utility::LogError("LoadNpz: {} in {} is truncated.", name,
+                              file_name);
+        }
+        std::shared_ptr<Blob> blob =
+                ReadNumpyData(fp.get(), num_bytes, word_size, mapping);
+
+        const std::string suffix = ".npy";
+        if (name.size() >= suffix.size() &&
+            name.compare(name.size() - suffix.size(), suffix.size(),
+                         suffix) == 0) {
+            name.resize(name.size() - suffix.size());
+        }
+        arrays.emplace(name, NumpyArray(shape, type, word_size,
+                                        fortran_order, blob));
+    }
+    return arrays;
 }
 
 void NumpyArray::Save(std::string file_name) const {
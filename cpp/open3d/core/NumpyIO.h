@@ -26,6 +26,9 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_map>
+
 #include "open3d/core/Blob.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
@@ -35,6 +38,19 @@ namespace open3d {
 namespace core {
 
 class NumpyArray {
+public:
+    /// How Load() and LoadNpz() bring the array data into memory.
+    enum class LoadMode {
+        /// Read the data into a newly allocated buffer.
+        Read,
+        /// Map the file read-only. The data is paged in on first access and
+        /// shared with other mappings of the file. Writing to it crashes.
+        MapReadOnly,
+        /// Map the file privately. Writes trigger copy-on-write of the
+        /// touched pages and never reach the file.
+        MapCopyOnWrite,
+    };
+
 public:
     NumpyArray() = delete;
 
@@ -65,10 +81,30 @@ public:
 
     Tensor ToTensor() const;
 
-    static NumpyArray Load(const std::string& file_name);
+    /// Loads a .npy file. With one of the Map modes, the array (and any
+    /// Tensor created from it) references the mapped pages directly, and the
+    /// file is unmapped once the last reference is gone.
+    static NumpyArray Load(const std::string& file_name,
+                           LoadMode mode = LoadMode::Read);
+
+    /// Loads all arrays of an .npz archive, keyed by name without the ".npy"
+    /// suffix. Only archives written without compression (np.savez) are
+    /// supported. With one of the Map modes, all arrays share one mapping of
+    /// the archive. Arrays whose data is not aligned to their element size
+    /// within the archive are copied out of the mapping; note that np.savez
+    /// does not align member data.
+    static std::unordered_map<std::string, NumpyArray> LoadNpz(
+            const std::string& file_name, LoadMode mode = LoadMode::Read);
 
     void Save(std::string file_name) const;
 
+private:
+    NumpyArray(const SizeVector& shape,
+               char type,
+               int64_t word_size,
+               bool fortran_order,
+               const std::shared_ptr<Blob>& blob);
+
 private:
     std::shared_ptr<Blob> blob_ = nullptr;
     SizeVector shape_;
@@ -0,0 +1,570 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/hashmap/CPU/CPUHashmapBufferAccessor.hpp"
+#include "open3d/core/hashmap/DeviceHashmap.h"
+
+namespace open3d {
+namespace core {
+
+/// Lock-free lookup view of an OpenAddressingHashmap's slot array. Cheap to
+/// copy into kernels; valid until the table is rehashed or destroyed.
+///
+/// Each slot is a single 64-bit word: the upper 32 bits hold a tag derived
+/// from the key's hash (never 0), the lower 32 bits the address of the key
+/// value pair in the buffer. Empty slots are 0, erased slots (tombstones) 1.
+template <typename Key, typename Hash>
+class OpenAddressingHashmapImpl {
+public:
+    static constexpr uint64_t kEmptySlot = 0;
+    static constexpr uint64_t kTombstoneSlot = 1;
+    static constexpr uint64_t kAddrMask = 0xFFFFFFFF;
+
+    /// Result of find(), mimicking the iterators of the map containers used
+    /// by other backends, so kernels can use `iter->second` and `end()`.
+    struct Iterator {
+        addr_t second;
+        bool valid_;
+
+        const Iterator* operator->() const { return this; }
+        bool operator==(const Iterator& other) const {
+            return valid_ == other.valid_ &&
+                   (!valid_ || second == other.second);
+        }
+        bool operator!=(const Iterator& other) const {
+            return !(*this == other);
+        }
+    };
+
+    OpenAddressingHashmapImpl()
+        : slots_(nullptr), mask_(0), keys_(nullptr), dsize_key_(0) {}
+    OpenAddressingHashmapImpl(std::atomic<uint64_t>* slots,
+                              int64_t bucket_count,
+                              uint8_t* keys,
+                              int64_t dsize_key)
+        : slots_(slots),
+          mask_(static_cast<uint64_t>(bucket_count - 1)),
+          keys_(keys),
+          dsize_key_(dsize_key) {}
+
+    Iterator find(const Key& key) const {
+        addr_t addr = 0;
+        bool found = Find(key, MixHash(hash_fn_(key)), addr);
+        return Iterator{addr, found};
+    }
+    Iterator end() const { return Iterator{0, false}; }
+
+    /// Looks up \p key with precomputed MixHash(Hash()(key)).
+    bool Find(const Key& key, uint64_t hash, addr_t& addr) const {
+        const uint64_t tag = GetTag(hash);
+        for (uint64_t idx = hash & mask_;; idx = (idx + 1) & mask_) {
+            const uint64_t slot = slots_[idx].load(std::memory_order_acquire);
+            if (slot == kEmptySlot) {
+                return false;
+            }
+            if (IsKeyAt(slot, tag, key)) {
+                addr = static_cast<addr_t>(slot & kAddrMask);
+                return true;
+            }
+        }
+    }
+
+    /// True if \p slot holds \p key. Tombstones never match since their tag
+    /// is 0.
+    bool IsKeyAt(uint64_t slot, uint64_t tag, const Key& key) const {
+        if ((slot & ~kAddrMask) != tag) {
+            return false;
+        }
+        const uint8_t* stored_key = keys_ + (slot & kAddrMask) * dsize_key_;
+        return *reinterpret_cast<const Key*>(stored_key) == key;
+    }
+
+    /// Spreads the entropy of the key hash over all 64 bits, so that both the
+    /// low bits (slot index) and the high bits (tag) are well distributed.
+    static uint64_t MixHash(uint64_t hash) {
+        hash ^= hash >> 33;
+        hash *= UINT64_C(0xff51afd7ed558ccd);
+        hash ^= hash >> 33;
+        hash *= UINT64_C(0xc4ceb9fe1a85ec53);
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    static uint64_t GetTag(uint64_t hash) {
+        return static_cast<uint64_t>(static_cast<uint32_t>(hash >> 32) | 1u)
+               << 32;
+    }
+
+public:
+    Hash hash_fn_;
+
+    std::atomic<uint64_t>* slots_;
+    uint64_t mask_;
+    uint8_t* keys_;
+    int64_t dsize_key_;
+};
+
+/// Flat open-addressing hash table with lock-free linear probing.
+///
+/// Probing compares the tags stored in the slots first and only touches the
+/// key buffer on a tag match, so most probes stay within the slot array, which
+/// is cache-line aligned. Insertion claims an empty slot with a single CAS
+/// after the key and value have been written to the buffer. Erased slots become
+/// tombstones, which are purged by rehashing.
+///
+/// The table has at least twice as many slots as the buffer capacity, so the
+/// live load factor never exceeds 0.5.
+template <typename Key, typename Hash>
+class OpenAddressingHashmap : public DeviceHashmap {
+public:
+    OpenAddressingHashmap(int64_t init_capacity,
+                          int64_t dsize_key,
+                          int64_t dsize_value,
+                          const Device& device);
+    ~OpenAddressingHashmap();
+
+    void Rehash(int64_t buckets) override;
+
+    void Insert(const void* input_keys,
+                const void* input_values,
+                addr_t* output_addrs,
+                bool* output_masks,
+                int64_t count) override;
+
+    void Activate(const void* input_keys,
+                  addr_t* output_addrs,
+                  bool* output_masks,
+                  int64_t count) override;
+
+    void Find(const void* input_keys,
+              addr_t* output_addrs,
+              bool* output_masks,
+              int64_t count) override;
+
+    void Erase(const void* input_keys,
+               bool* output_masks,
+               int64_t count) override;
+
+    int64_t GetActiveIndices(addr_t* output_indices) override;
+
+    void Clear() override;
+
+    int64_t Size() const override;
+    int64_t GetBucketCount() const override;
+    std::vector<int64_t> BucketSizes() const override;
+    float LoadFactor() const override;
+
+    OpenAddressingHashmapImpl<Key, Hash> GetImpl() const { return impl_; }
+
+protected:
+    using Impl = OpenAddressingHashmapImpl<Key, Hash>;
+    static constexpr uint64_t kEmptySlot = Impl::kEmptySlot;
+    static constexpr uint64_t kTombstoneSlot = Impl::kTombstoneSlot;
+    static constexpr uint64_t kAddrMask = Impl::kAddrMask;
+    /// Number of keys whose slots are prefetched before probing.
+    static constexpr int64_t kProbeBatchSize = 16;
+    /// Rehash in place once live entries and tombstones exceed this fraction
+    /// of the slots.
+    static constexpr double kMaxOccupancy = 0.75;
+
+    /// Slots, aligned to a cache line inside slots_storage_.
+    std::unique_ptr<std::atomic<uint64_t>[]> slots_storage_;
+    std::atomic<uint64_t>* slots_;
+    int64_t bucket_count_;
+    Impl impl_;
+
+    std::atomic<int64_t> size_;
+    std::atomic<int64_t> num_tombstones_;
+
+    std::shared_ptr<CPUHashmapBufferAccessor> buffer_ctx_;
+
+    void InsertImpl(const void* input_keys,
+                    const void* input_values,
+                    addr_t* output_addrs,
+                    bool* output_masks,
+                    int64_t count);
+
+    void Allocate(int64_t capacity);
+
+    static void Prefetch(const void* ptr) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(ptr);
+#else
+        (void)ptr;
+#endif
+    }
+};
+
+template <typename Key, typename Hash>
+OpenAddressingHashmap<Key, Hash>::OpenAddressingHashmap(int64_t init_capacity,
+                                                        int64_t dsize_key,
+                                                        int64_t dsize_value,
+                                                        const Device& device)
+    : DeviceHashmap(init_capacity, dsize_key, dsize_value, device) {
+    Allocate(init_capacity);
+}
+
+template <typename Key, typename Hash>
+OpenAddressingHashmap<Key, Hash>::~OpenAddressingHashmap() {}
+
+template <typename Key, typename Hash>
+int64_t OpenAddressingHashmap<Key, Hash>::Size() const {
+    return size_.load();
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Insert(const void* input_keys,
+                                              const void* input_values,
+                                              addr_t* output_addrs,
+                                              bool* output_masks,
+                                              int64_t count) {
+    int64_t new_size = Size() + count;
+    if (new_size > this->capacity_) {
+        int64_t bucket_count = GetBucketCount();
+        float avg_capacity_per_bucket =
+                float(this->capacity_) / float(bucket_count);
+
+        int64_t expected_buckets = std::max(
+                bucket_count * 2,
+                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
+
+        Rehash(expected_buckets);
+    } else if (new_size + num_tombstones_.load() >
+               kMaxOccupancy * bucket_count_) {
+        // Probing only stops at empty slots; purge tombstones to keep probe
+        // sequences short and guarantee termination.
+        Rehash(GetBucketCount());
+    }
+    InsertImpl(input_keys, input_values, output_addrs, output_masks, count);
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Activate(const void* input_keys,
+                                                addr_t* output_addrs,
+                                                bool* output_masks,
+                                                int64_t count) {
+    Insert(input_keys, nullptr, output_addrs, output_masks, count);
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Find(const void* input_keys,
+                                            addr_t* output_addrs,
+                                            bool* output_masks,
+                                            int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    const uint64_t mask = impl_.mask_;
+    Hash hash_fn;
+
+#pragma omp parallel for schedule(static)
+    for (int64_t batch = 0; batch < count; batch += kProbeBatchSize) {
+        const int64_t batch_end = std::min(batch + kProbeBatchSize, count);
+        uint64_t hashes[kProbeBatchSize];
+        for (int64_t i = batch; i < batch_end; ++i) {
+            hashes[i - batch] =
+                    Impl::MixHash(hash_fn(input_keys_templated[i]));
+            Prefetch(&slots_[hashes[i - batch] & mask]);
+        }
+
+        for (int64_t i = batch; i < batch_end; ++i) {
+            output_addrs[i] = 0;
+            output_masks[i] = impl_.Find(input_keys_templated[i],
+                                         hashes[i - batch], output_addrs[i]);
+        }
+    }
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Erase(const void* input_keys,
+                                             bool* output_masks,
+                                             int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    const uint64_t mask = impl_.mask_;
+    Hash hash_fn;
+
+#pragma omp parallel
+    {
+        // The buffer heap is not safe for concurrent frees, so addresses are
+        // collected per thread and released after the parallel loop.
+        std::vector<addr_t> erased_addrs;
+
+#pragma omp for schedule(static)
+        for (int64_t i = 0; i < count; ++i) {
+            const Key& key = input_keys_templated[i];
+            const uint64_t hash = Impl::MixHash(hash_fn(key));
+            const uint64_t tag = Impl::GetTag(hash);
+
+            output_masks[i] = false;
+            for (uint64_t idx = hash & mask;; idx = (idx + 1) & mask) {
+                uint64_t slot = slots_[idx].load(std::memory_order_acquire);
+                if (slot == kEmptySlot) {
+                    break;
+                }
+                if (impl_.IsKeyAt(slot, tag, key)) {
+                    // Only one of several duplicate keys in the batch wins.
+                    if (slots_[idx].compare_exchange_strong(slot,
+                                                            kTombstoneSlot)) {
+                        erased_addrs.push_back(
+                                static_cast<addr_t>(slot & kAddrMask));
+                        output_masks[i] = true;
+                    }
+                    break;
+                }
+            }
+        }
+
+#pragma omp critical
+        {
+            for (addr_t addr : erased_addrs) {
+                buffer_ctx_->DeviceFree(addr);
+            }
+            size_ -= static_cast<int64_t>(erased_addrs.size());
+            num_tombstones_ += static_cast<int64_t>(erased_addrs.size());
+        }
+    }
+}
+
+template <typename Key, typename Hash>
+int64_t OpenAddressingHashmap<Key, Hash>::GetActiveIndices(
+        addr_t* output_indices) {
+    int64_t count = 0;
+    for (int64_t i = 0; i < bucket_count_; ++i) {
+        const uint64_t slot = slots_[i].load(std::memory_order_relaxed);
+        if (slot != kEmptySlot && slot != kTombstoneSlot) {
+            output_indices[count++] = static_cast<addr_t>(slot & kAddrMask);
+        }
+    }
+    return count;
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Clear() {
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < bucket_count_; ++i) {
+        slots_[i].store(kEmptySlot, std::memory_order_relaxed);
+    }
+    size_ = 0;
+    num_tombstones_ = 0;
+    buffer_ctx_->Reset();
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Rehash(int64_t buckets) {
+    int64_t iterator_count = Size();
+
+    Tensor active_keys;
+    Tensor active_values;
+
+    if (iterator_count > 0) {
+        Tensor active_addrs({iterator_count}, Dtype::Int32, this->device_);
+        GetActiveIndices(static_cast<addr_t*>(active_addrs.GetDataPtr()));
+
+        Tensor active_indices = active_addrs.To(Dtype::Int64);
+        active_keys = this->GetKeyBuffer().IndexGet({active_indices});
+        active_values = this->GetValueBuffer().IndexGet({active_indices});
+    }
+
+    float avg_capacity_per_bucket =
+            float(this->capacity_) / float(GetBucketCount());
+    int64_t new_capacity =
+            int64_t(std::ceil(buckets * avg_capacity_per_bucket));
+
+    Allocate(new_capacity);
+
+    if (iterator_count > 0) {
+        Tensor output_addrs({iterator_count}, Dtype::Int32, this->device_);
+        Tensor output_masks({iterator_count}, Dtype::Bool, this->device_);
+
+        InsertImpl(active_keys.GetDataPtr(), active_values.GetDataPtr(),
+                   static_cast<addr_t*>(output_addrs.GetDataPtr()),
+                   output_masks.GetDataPtr<bool>(), iterator_count);
+    }
+}
+
+template <typename Key, typename Hash>
+int64_t OpenAddressingHashmap<Key, Hash>::GetBucketCount() const {
+    return bucket_count_;
+}
+
+template <typename Key, typename Hash>
+std::vector<int64_t> OpenAddressingHashmap<Key, Hash>::BucketSizes() const {
+    // Every slot is a bucket holding at most one entry.
+    std::vector<int64_t> ret(bucket_count_);
+    for (int64_t i = 0; i < bucket_count_; ++i) {
+        const uint64_t slot = slots_[i].load(std::memory_order_relaxed);
+        ret[i] = (slot != kEmptySlot && slot != kTombstoneSlot) ? 1 : 0;
+    }
+    return ret;
+}
+
+template <typename Key, typename Hash>
+float OpenAddressingHashmap<Key, Hash>::LoadFactor() const {
+    return float(Size()) / float(bucket_count_);
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::InsertImpl(const void* input_keys,
+                                                  const void* input_values,
+                                                  addr_t* output_addrs,
+                                                  bool* output_masks,
+                                                  int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    const uint64_t mask = impl_.mask_;
+    Hash hash_fn;
+
+#pragma omp parallel
+    {
+        // A thread may allocate a buffer entry, then lose the race for the
+        // slot to a duplicate key. The buffer heap is not safe for concurrent
+        // frees, so such entries are released after the parallel loop.
+        std::vector<addr_t> unused_addrs;
+        int64_t num_inserted = 0;
+
+#pragma omp for schedule(static)
+        for (int64_t batch = 0; batch < count; batch += kProbeBatchSize) {
+            const int64_t batch_end = std::min(batch + kProbeBatchSize, count);
+            uint64_t hashes[kProbeBatchSize];
+            for (int64_t i = batch; i < batch_end; ++i) {
+                hashes[i - batch] =
+                        Impl::MixHash(hash_fn(input_keys_templated[i]));
+                Prefetch(&slots_[hashes[i - batch] & mask]);
+            }
+
+            for (int64_t i = batch; i < batch_end; ++i) {
+                const Key& key = input_keys_templated[i];
+                const uint64_t tag = Impl::GetTag(hashes[i - batch]);
+
+                output_addrs[i] = 0;
+                output_masks[i] = false;
+
+                bool allocated = false;
+                addr_t dst_kv_addr = 0;
+                for (uint64_t idx = hashes[i - batch] & mask;;
+                     idx = (idx + 1) & mask) {
+                    uint64_t slot = slots_[idx].load(std::memory_order_acquire);
+                    if (slot == kEmptySlot) {
+                        // Lazily copy the key value pair to the buffer before
+                        // publishing it, so that readers of the slot always
+                        // see a complete entry.
+                        if (!allocated) {
+                            dst_kv_addr = buffer_ctx_->DeviceAllocate();
+                            auto dst_kv_iter =
+                                    buffer_ctx_->ExtractIterator(dst_kv_addr);
+                            *static_cast<Key*>(dst_kv_iter.first) = key;
+
+                            uint8_t* dst_value =
+                                    static_cast<uint8_t*>(dst_kv_iter.second);
+                            if (input_values != nullptr) {
+                                const uint8_t* src_value =
+                                        static_cast<const uint8_t*>(
+                                                input_values) +
+                                        this->dsize_value_ * i;
+                                std::memcpy(dst_value, src_value,
+                                            this->dsize_value_);
+                            } else {
+                                std::memset(dst_value, 0, this->dsize_value_);
+                            }
+                            allocated = true;
+                        }
+
+                        if (slots_[idx].compare_exchange_strong(
+                                    slot, tag | dst_kv_addr,
+                                    std::memory_order_acq_rel,
+                                    std::memory_order_acquire)) {
+                            output_addrs[i] = dst_kv_addr;
+                            output_masks[i] = true;
+                            ++num_inserted;
+                            break;
+                        }
+                        // Lost the race, slot now holds the winner's entry.
+                    }
+                    if (impl_.IsKeyAt(slot, tag, key)) {
+                        if (allocated) {
+                            unused_addrs.push_back(dst_kv_addr);
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+
+#pragma omp critical
+        {
+            for (addr_t addr : unused_addrs) {
+                buffer_ctx_->DeviceFree(addr);
+            }
+            size_ += num_inserted;
+        }
+    }
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Allocate(int64_t capacity) {
+    this->capacity_ = capacity;
+
+    this->buffer_ =
+            std::make_shared<HashmapBuffer>(this->capacity_, this->dsize_key_,
+                                            this->dsize_value_, this->device_);
+
+    buffer_ctx_ = std::make_shared<CPUHashmapBufferAccessor>(
+            this->capacity_, this->dsize_key_, this->dsize_value_,
+            this->buffer_->GetKeyBuffer(), this->buffer_->GetValueBuffer(),
+            this->buffer_->GetHeap());
+    buffer_ctx_->Reset();
+
+    // Power of two no smaller than one cache line, with at least twice as
+    // many slots as entries.
+    constexpr int64_t kSlotsPerCacheLine = 64 / sizeof(uint64_t);
+    bucket_count_ = kSlotsPerCacheLine;
+    while (bucket_count_ < 2 * capacity) {
+        bucket_count_ *= 2;
+    }
+
+    slots_storage_.reset(
+            new std::atomic<uint64_t>[bucket_count_ + kSlotsPerCacheLine - 1]);
+    const uintptr_t offset = reinterpret_cast<uintptr_t>(slots_storage_.get()) %
+                             64 / sizeof(uint64_t);
+    slots_ = slots_storage_.get() +
+             (offset == 0 ? 0 : kSlotsPerCacheLine - offset);
+    impl_ = Impl(slots_, bucket_count_, buffer_ctx_->keys_, this->dsize_key_);
+
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < bucket_count_; ++i) {
+        slots_[i].store(kEmptySlot, std::memory_order_relaxed);
+    }
+    size_ = 0;
+    num_tombstones_ = 0;
+}
+
+}  // namespace core
+}  // namespace open3d
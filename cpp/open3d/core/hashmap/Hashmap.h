@@ -35,7 +35,7 @@ namespace core {
 
 class DeviceHashmap;
 
-enum class HashmapBackend { Slab, StdGPU, TBB, Default };
+enum class HashmapBackend { Slab, StdGPU, TBB, OpenAddressing, Default };
 
 class Hashmap {
 public:
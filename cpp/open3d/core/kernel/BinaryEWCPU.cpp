@@ -38,134 +38,98 @@ namespace core {
 namespace kernel {
 
 template <typename scalar_t>
-static void CPUAddElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<scalar_t*>(dst) = *static_cast<const scalar_t*>(lhs) +
-                                   *static_cast<const scalar_t*>(rhs);
-}
-
-template <typename scalar_t>
-static void CPUSubElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<scalar_t*>(dst) = *static_cast<const scalar_t*>(lhs) -
-                                   *static_cast<const scalar_t*>(rhs);
-}
-
-template <typename scalar_t>
-static void CPUMulElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<scalar_t*>(dst) = *static_cast<const scalar_t*>(lhs) *
-                                   *static_cast<const scalar_t*>(rhs);
-}
-
-template <typename scalar_t>
-static void CPUDivElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<scalar_t*>(dst) = *static_cast<const scalar_t*>(lhs) /
-                                   *static_cast<const scalar_t*>(rhs);
-}
-
-template <typename src_t, typename dst_t>
-static void CPULogicalAndElementKernel(const void* lhs,
-                                       const void* rhs,
-                                       void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            static_cast<bool>(*static_cast<const src_t*>(lhs)) &&
-            static_cast<bool>(*static_cast<const src_t*>(rhs)));
-}
-
-template <typename src_t, typename dst_t>
-static void CPULogicalOrElementKernel(const void* lhs,
-                                      const void* rhs,
-                                      void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            static_cast<bool>(*static_cast<const src_t*>(lhs)) ||
-            static_cast<bool>(*static_cast<const src_t*>(rhs)));
-}
-
-template <typename src_t, typename dst_t>
-static void CPULogicalXorElementKernel(const void* lhs,
-                                       const void* rhs,
-                                       void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            static_cast<bool>(*static_cast<const src_t*>(lhs)) !=
-            static_cast<bool>(*static_cast<const src_t*>(rhs)));
-}
-
-template <typename src_t, typename dst_t>
-static void CPUGtElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) > *static_cast<const src_t*>(rhs));
-}
-
-template <typename src_t, typename dst_t>
-static void CPULtElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) < *static_cast<const src_t*>(rhs));
-}
-
-template <typename src_t, typename dst_t>
-static void CPUGeqElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) >= *static_cast<const src_t*>(rhs));
-}
-
-template <typename src_t, typename dst_t>
-static void CPULeqElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) <= *static_cast<const src_t*>(rhs));
-}
-
-template <typename src_t, typename dst_t>
-static void CPUEqElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) == *static_cast<const src_t*>(rhs));
-}
-
-template <typename src_t, typename dst_t>
-static void CPUNeqElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) != *static_cast<const src_t*>(rhs));
+static void LaunchArithmeticBinaryEWCPUKernel(BinaryEWOpCode op_code,
+                                              const Indexer& indexer) {
+    switch (op_code) {
+        case BinaryEWOpCode::Add:
+            CPULauncher::LaunchBinaryEWVectorizedKernel<scalar_t, scalar_t>(
+                    indexer, [](scalar_t lhs, scalar_t rhs) {
+                        return static_cast<scalar_t>(lhs + rhs);
+                    });
+            break;
+        case BinaryEWOpCode::Sub:
+            CPULauncher::LaunchBinaryEWVectorizedKernel<scalar_t, scalar_t>(
+                    indexer, [](scalar_t lhs, scalar_t rhs) {
+                        return static_cast<scalar_t>(lhs - rhs);
+                    });
+            break;
+        case BinaryEWOpCode::Mul:
+            CPULauncher::LaunchBinaryEWVectorizedKernel<scalar_t, scalar_t>(
+                    indexer, [](scalar_t lhs, scalar_t rhs) {
+                        return static_cast<scalar_t>(lhs * rhs);
+                    });
+            break;
+        case BinaryEWOpCode::Div:
+            CPULauncher::LaunchBinaryEWVectorizedKernel<scalar_t, scalar_t>(
+                    indexer, [](scalar_t lhs, scalar_t rhs) {
+                        return static_cast<scalar_t>(lhs / rhs);
+                    });
+            break;
+        default:
+            break;
+    }
 }
 
 template <typename src_t, typename dst_t>
-static void LaunchBoolBinaryEWCPUKernel(const Tensor& lhs,
-                                        const Tensor& rhs,
-                                        Tensor& dst,
-                                        BinaryEWOpCode op_code,
+static void LaunchBoolBinaryEWCPUKernel(BinaryEWOpCode op_code,
                                         const Indexer& indexer) {
     switch (op_code) {
         case BinaryEWOpCode::LogicalAnd:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPULogicalAndElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWVectorizedKernel<src_t, dst_t>(
+                    indexer, [](src_t lhs, src_t rhs) {
+                        return static_cast<dst_t>(static_cast<bool>(lhs) &&
+                                                  static_cast<bool>(rhs));
+                    });
             break;
         case BinaryEWOpCode::LogicalOr:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPULogicalOrElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWVectorizedKernel<src_t, dst_t>(
+                    indexer, [](src_t lhs, src_t rhs) {
+                        return static_cast<dst_t>(static_cast<bool>(lhs) ||
+                                                  static_cast<bool>(rhs));
+                    });
             break;
         case BinaryEWOpCode::LogicalXor:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPULogicalXorElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWVectorizedKernel<src_t, dst_t>(
+                    indexer, [](src_t lhs, src_t rhs) {
+                        return static_cast<dst_t>(static_cast<bool>(lhs) !=
+                                                  static_cast<bool>(rhs));
+                    });
             break;
         case BinaryEWOpCode::Gt:
-            CPULauncher::LaunchBinaryEWKernel(indexer,
-                                              CPUGtElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWVectorizedKernel<src_t, dst_t>(
+                    indexer, [](src_t lhs, src_t rhs) {
+                        return static_cast<dst_t>(lhs > rhs);
+                    });
             break;
         case BinaryEWOpCode::Lt:
-            CPULauncher::LaunchBinaryEWKernel(indexer,
-                                              CPULtElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWVectorizedKernel<src_t, dst_t>(
+                    indexer, [](src_t lhs, src_t rhs) {
+                        return static_cast<dst_t>(lhs < rhs);
+                    });
             break;
         case BinaryEWOpCode::Ge:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPUGeqElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWVectorizedKernel<src_t, dst_t>(
+                    indexer, [](src_t lhs, src_t rhs) {
+                        return static_cast<dst_t>(lhs >= rhs);
+                    });
             break;
         case BinaryEWOpCode::Le:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPULeqElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWVectorizedKernel<src_t, dst_t>(
+                    indexer, [](src_t lhs, src_t rhs) {
+                        return static_cast<dst_t>(lhs <= rhs);
+                    });
             break;
         case BinaryEWOpCode::Eq:
-            CPULauncher::LaunchBinaryEWKernel(indexer,
-                                              CPUEqElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWVectorizedKernel<src_t, dst_t>(
+                    indexer, [](src_t lhs, src_t rhs) {
+                        return static_cast<dst_t>(lhs == rhs);
+                    });
             break;
         case BinaryEWOpCode::Ne:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPUNeqElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWVectorizedKernel<src_t, dst_t>(
+                    indexer, [](src_t lhs, src_t rhs) {
+                        return static_cast<dst_t>(lhs != rhs);
+                    });
             break;
         default:
             break;
@@ -187,14 +151,13 @@ void BinaryEWCPU(const Tensor& lhs,
                 // input. e.g. np.logical_and(a, b, out=a), where a, b are
                 // floats.
                 Indexer indexer({lhs, rhs}, dst, DtypePolicy::ALL_SAME);
-                LaunchBoolBinaryEWCPUKernel<scalar_t, scalar_t>(
-                        lhs, rhs, dst, op_code, indexer);
+                LaunchBoolBinaryEWCPUKernel<scalar_t, scalar_t>(op_code,
+                                                                indexer);
             } else if (dst_dtype == Dtype::Bool) {
                 // By default, output is boolean type.
                 Indexer indexer({lhs, rhs}, dst,
                                 DtypePolicy::INPUT_SAME_OUTPUT_BOOL);
-                LaunchBoolBinaryEWCPUKernel<scalar_t, bool>(lhs, rhs, dst,
-                                                            op_code, indexer);
+                LaunchBoolBinaryEWCPUKernel<scalar_t, bool>(op_code, indexer);
             } else {
                 utility::LogError(
                         "Boolean op's output type must be boolean or the "
@@ -204,26 +167,7 @@ void BinaryEWCPU(const Tensor& lhs,
     } else {
         Indexer indexer({lhs, rhs}, dst, DtypePolicy::ALL_SAME);
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
-            switch (op_code) {
-                case BinaryEWOpCode::Add:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUAddElementKernel<scalar_t>);
-                    break;
-                case BinaryEWOpCode::Sub:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUSubElementKernel<scalar_t>);
-                    break;
-                case BinaryEWOpCode::Mul:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUMulElementKernel<scalar_t>);
-                    break;
-                case BinaryEWOpCode::Div:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUDivElementKernel<scalar_t>);
-                    break;
-                default:
-                    break;
-            }
+            LaunchArithmeticBinaryEWCPUKernel<scalar_t>(op_code, indexer);
         });
     }
 }
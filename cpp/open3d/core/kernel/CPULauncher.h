@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
@@ -81,6 +82,97 @@ public:
         }
     }
 
+    /// Vectorization-friendly variant of LaunchUnaryEWKernel.
+    ///
+    /// \param indexer The indexer with one input of type src_t and one output
+    /// of type dst_t.
+    /// \param element_kernel A function that takes an input value and returns
+    /// the output value, e.g. `[](float x) { return std::sqrt(x); }`. If the
+    /// input and output are contiguous, it is applied in a plain loop over raw
+    /// pointers, which the compiler can auto-vectorize. Otherwise, each
+    /// element is located through the indexer.
+    template <typename src_t, typename dst_t, typename func_t>
+    static void LaunchUnaryEWVectorizedKernel(const Indexer& indexer,
+                                              func_t element_kernel) {
+        const int64_t num_workloads = indexer.NumWorkloads();
+        if (indexer.IsContiguous()) {
+            const src_t* src =
+                    reinterpret_cast<const src_t*>(indexer.GetInputPtr(0, 0));
+            dst_t* dst = reinterpret_cast<dst_t*>(indexer.GetOutputPtr(0));
+            LaunchRangeKernel(num_workloads, [&](int64_t start, int64_t end) {
+                for (int64_t i = start; i < end; ++i) {
+                    dst[i] = element_kernel(src[i]);
+                }
+            });
+        } else {
+            LaunchUnaryEWKernel(indexer, [&](const void* src_ptr,
+                                             void* dst_ptr) {
+                *static_cast<dst_t*>(dst_ptr) =
+                        element_kernel(*static_cast<const src_t*>(src_ptr));
+            });
+        }
+    }
+
+    /// Vectorization-friendly variant of LaunchBinaryEWKernel.
+    ///
+    /// \param indexer The indexer with two inputs of type src_t and one output
+    /// of type dst_t.
+    /// \param element_kernel A function that takes the lhs and rhs values and
+    /// returns the output value. Contiguous operands, and contiguous operands
+    /// mixed with a single broadcasted scalar operand, are computed in plain
+    /// loops over raw pointers. Otherwise, each element is located through
+    /// the indexer.
+    template <typename src_t, typename dst_t, typename func_t>
+    static void LaunchBinaryEWVectorizedKernel(const Indexer& indexer,
+                                               func_t element_kernel) {
+        const int64_t num_workloads = indexer.NumWorkloads();
+        const src_t* lhs =
+                reinterpret_cast<const src_t*>(indexer.GetInputPtr(0, 0));
+        const src_t* rhs =
+                reinterpret_cast<const src_t*>(indexer.GetInputPtr(1, 0));
+        dst_t* dst = reinterpret_cast<dst_t*>(indexer.GetOutputPtr(0));
+        if (indexer.IsOutputContiguous()) {
+            const bool lhs_contiguous = indexer.IsInputContiguous(0);
+            const bool rhs_contiguous = indexer.IsInputContiguous(1);
+            if (lhs_contiguous && rhs_contiguous) {
+                LaunchRangeKernel(num_workloads,
+                                  [&](int64_t start, int64_t end) {
+                                      for (int64_t i = start; i < end; ++i) {
+                                          dst[i] = element_kernel(lhs[i],
+                                                                  rhs[i]);
+                                      }
+                                  });
+                return;
+            } else if (lhs_contiguous && indexer.IsInputScalar(1)) {
+                const src_t rhs_value = *rhs;
+                LaunchRangeKernel(num_workloads,
+                                  [&](int64_t start, int64_t end) {
+                                      for (int64_t i = start; i < end; ++i) {
+                                          dst[i] = element_kernel(lhs[i],
+                                                                  rhs_value);
+                                      }
+                                  });
+                return;
+            } else if (indexer.IsInputScalar(0) && rhs_contiguous) {
+                const src_t lhs_value = *lhs;
+                LaunchRangeKernel(num_workloads,
+                                  [&](int64_t start, int64_t end) {
+                                      for (int64_t i = start; i < end; ++i) {
+                                          dst[i] = element_kernel(lhs_value,
+                                                                  rhs[i]);
+                                      }
+                                  });
+                return;
+            }
+        }
+        LaunchBinaryEWKernel(indexer, [&](const void* lhs_ptr,
+                                          const void* rhs_ptr, void* dst_ptr) {
+            *static_cast<dst_t*>(dst_ptr) =
+                    element_kernel(*static_cast<const src_t*>(lhs_ptr),
+                                   *static_cast<const src_t*>(rhs_ptr));
+        });
+    }
+
     template <typename func_t>
     static void LaunchAdvancedIndexerKernel(const AdvancedIndexer& indexer,
                                             func_t element_kernel) {
@@ -171,6 +263,30 @@ public:
         }
     }
 
+    /// Splits [0, n) into one contiguous range per thread and calls
+    /// range_kernel(start, end) on each range. Small workloads run on the
+    /// calling thread.
+    template <typename func_t>
+    static void LaunchRangeKernel(int64_t n, func_t range_kernel) {
+        // Minimum number of elements per range, to amortize threading cost.
+        constexpr int64_t min_range_size = 32768;
+        const int64_t num_ranges = std::max<int64_t>(
+                1, std::min<int64_t>(GetMaxThreads(), n / min_range_size));
+        if (num_ranges == 1 || InParallel()) {
+            range_kernel(0, n);
+            return;
+        }
+        const int64_t range_size = (n + num_ranges - 1) / num_ranges;
+#pragma omp parallel for schedule(static)
+        for (int64_t range_idx = 0; range_idx < num_ranges; ++range_idx) {
+            const int64_t start = range_idx * range_size;
+            const int64_t end = std::min(start + range_size, n);
+            if (start < end) {
+                range_kernel(start, end);
+            }
+        }
+    }
+
     /// General kernels with non-conventional indexers
     template <typename func_t>
     static void LaunchGeneralKernel(int64_t n, func_t element_kernel) {
@@ -0,0 +1,342 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/FusedEW.h"
+
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+struct FusedEWExpr::Node {
+    enum class NodeType { Tensor, Scalar, Unary, Binary };
+
+    NodeType node_type_;
+    Tensor tensor_;
+    Scalar scalar_ = 0;
+    UnaryEWOpCode unary_op_code_ = UnaryEWOpCode::Neg;
+    BinaryEWOpCode binary_op_code_ = BinaryEWOpCode::Add;
+    std::shared_ptr<const Node> lhs_;
+    std::shared_ptr<const Node> rhs_;
+};
+
+FusedEWExpr::FusedEWExpr(const Tensor& tensor)
+    : shape_(tensor.GetShape()),
+      dtype_(tensor.GetDtype()),
+      device_(tensor.GetDevice()) {
+    if (dtype_ == Dtype::Bool || dtype_.IsObject()) {
+        utility::LogError("FusedEWExpr does not support dtype {}.",
+                          dtype_.ToString());
+    }
+    auto node = std::make_shared<Node>();
+    node->node_type_ = Node::NodeType::Tensor;
+    node->tensor_ = tensor;
+    node_ = node;
+}
+
+FusedEWExpr FusedEWExpr::Unary(UnaryEWOpCode op_code) const {
+    if (op_code == UnaryEWOpCode::IsNan || op_code == UnaryEWOpCode::IsInf ||
+        op_code == UnaryEWOpCode::IsFinite ||
+        op_code == UnaryEWOpCode::LogicalNot) {
+        utility::LogError("FusedEWExpr only supports dtype-preserving ops.");
+    }
+    if ((op_code == UnaryEWOpCode::Sqrt || op_code == UnaryEWOpCode::Sin ||
+         op_code == UnaryEWOpCode::Cos || op_code == UnaryEWOpCode::Exp) &&
+        dtype_ != Dtype::Float32 && dtype_ != Dtype::Float64) {
+        utility::LogError("Only supports Float32 and Float64, but {} is used.",
+                          dtype_.ToString());
+    }
+    auto node = std::make_shared<Node>();
+    node->node_type_ = Node::NodeType::Unary;
+    node->unary_op_code_ = op_code;
+    node->lhs_ = node_;
+    return FusedEWExpr(node, shape_, dtype_, device_);
+}
+
+FusedEWExpr FusedEWExpr::Binary(const FusedEWExpr& value,
+                                BinaryEWOpCode op_code) const {
+    if (s_boolean_binary_ew_op_codes.count(op_code)) {
+        utility::LogError("FusedEWExpr only supports arithmetic binary ops.");
+    }
+    if (dtype_ != value.dtype_) {
+        utility::LogError("Dtype mismatch {} != {}.", dtype_.ToString(),
+                          value.dtype_.ToString());
+    }
+    if (device_ != value.device_) {
+        utility::LogError("Device mismatch {} != {}.", device_.ToString(),
+                          value.device_.ToString());
+    }
+    auto node = std::make_shared<Node>();
+    node->node_type_ = Node::NodeType::Binary;
+    node->binary_op_code_ = op_code;
+    node->lhs_ = node_;
+    node->rhs_ = value.node_;
+    return FusedEWExpr(node,
+                       shape_util::BroadcastedShape(shape_, value.shape_),
+                       dtype_, device_);
+}
+
+FusedEWExpr FusedEWExpr::Binary(Scalar value, BinaryEWOpCode op_code) const {
+    if (s_boolean_binary_ew_op_codes.count(op_code)) {
+        utility::LogError("FusedEWExpr only supports arithmetic binary ops.");
+    }
+    auto scalar_node = std::make_shared<Node>();
+    scalar_node->node_type_ = Node::NodeType::Scalar;
+    scalar_node->scalar_ = value;
+
+    auto node = std::make_shared<Node>();
+    node->node_type_ = Node::NodeType::Binary;
+    node->binary_op_code_ = op_code;
+    node->lhs_ = node_;
+    node->rhs_ = scalar_node;
+    return FusedEWExpr(node, shape_, dtype_, device_);
+}
+
+FusedEWExpr FusedEWExpr::Add(const FusedEWExpr& value) const {
+    return Binary(value, BinaryEWOpCode::Add);
+}
+FusedEWExpr FusedEWExpr::Add(Scalar value) const {
+    return Binary(value, BinaryEWOpCode::Add);
+}
+FusedEWExpr FusedEWExpr::Sub(const FusedEWExpr& value) const {
+    return Binary(value, BinaryEWOpCode::Sub);
+}
+FusedEWExpr FusedEWExpr::Sub(Scalar value) const {
+    return Binary(value, BinaryEWOpCode::Sub);
+}
+FusedEWExpr FusedEWExpr::Mul(const FusedEWExpr& value) const {
+    return Binary(value, BinaryEWOpCode::Mul);
+}
+FusedEWExpr FusedEWExpr::Mul(Scalar value) const {
+    return Binary(value, BinaryEWOpCode::Mul);
+}
+FusedEWExpr FusedEWExpr::Div(const FusedEWExpr& value) const {
+    return Binary(value, BinaryEWOpCode::Div);
+}
+FusedEWExpr FusedEWExpr::Div(Scalar value) const {
+    return Binary(value, BinaryEWOpCode::Div);
+}
+
+FusedEWExpr FusedEWExpr::Sqrt() const { return Unary(UnaryEWOpCode::Sqrt); }
+FusedEWExpr FusedEWExpr::Sin() const { return Unary(UnaryEWOpCode::Sin); }
+FusedEWExpr FusedEWExpr::Cos() const { return Unary(UnaryEWOpCode::Cos); }
+FusedEWExpr FusedEWExpr::Neg() const { return Unary(UnaryEWOpCode::Neg); }
+FusedEWExpr FusedEWExpr::Exp() const { return Unary(UnaryEWOpCode::Exp); }
+FusedEWExpr FusedEWExpr::Abs() const { return Unary(UnaryEWOpCode::Abs); }
+FusedEWExpr FusedEWExpr::Floor() const { return Unary(UnaryEWOpCode::Floor); }
+FusedEWExpr FusedEWExpr::Ceil() const { return Unary(UnaryEWOpCode::Ceil); }
+FusedEWExpr FusedEWExpr::Round() const { return Unary(UnaryEWOpCode::Round); }
+FusedEWExpr FusedEWExpr::Trunc() const { return Unary(UnaryEWOpCode::Trunc); }
+
+FusedEWProgram FusedEWExpr::Compile() const {
+    FusedEWProgram program;
+
+    // Post-order traversal. Sub-expressions shared by several parents are
+    // visited once.
+    std::vector<const Node*> leaves;
+    std::vector<const Node*> ops;
+    std::unordered_map<const Node*, bool> visited;
+    std::function<void(const Node*)> visit = [&](const Node* node) {
+        if (visited.count(node)) {
+            return;
+        }
+        visited[node] = true;
+        if (node->lhs_) {
+            visit(node->lhs_.get());
+        }
+        if (node->rhs_) {
+            visit(node->rhs_.get());
+        }
+        if (node->node_type_ == Node::NodeType::Tensor ||
+            node->node_type_ == Node::NodeType::Scalar) {
+            leaves.push_back(node);
+        } else {
+            ops.push_back(node);
+        }
+    };
+    visit(node_.get());
+
+    // Inputs and constants get fixed registers, in this order.
+    std::unordered_map<const Node*, int64_t> node_to_register;
+    for (const Node* leaf : leaves) {
+        if (leaf->node_type_ == Node::NodeType::Tensor) {
+            node_to_register[leaf] =
+                    static_cast<int64_t>(program.inputs_.size());
+            program.inputs_.push_back(leaf->tensor_);
+        }
+    }
+    const int64_t num_inputs = static_cast<int64_t>(program.inputs_.size());
+    for (const Node* leaf : leaves) {
+        if (leaf->node_type_ == Node::NodeType::Scalar) {
+            int64_t constant_idx =
+                    static_cast<int64_t>(program.constants_.size());
+            node_to_register[leaf] = num_inputs + constant_idx;
+            program.constants_.push_back(leaf->scalar_);
+        }
+    }
+    const int64_t num_fixed_registers =
+            num_inputs + static_cast<int64_t>(program.constants_.size());
+    program.num_registers_ = num_fixed_registers;
+
+    // Index of the last instruction reading each node. The root is read by
+    // the final store, so it is never recycled.
+    std::unordered_map<const Node*, int64_t> last_use;
+    for (int64_t i = 0; i < static_cast<int64_t>(ops.size()); ++i) {
+        last_use[ops[i]->lhs_.get()] = i;
+        if (ops[i]->rhs_) {
+            last_use[ops[i]->rhs_.get()] = i;
+        }
+    }
+    last_use[node_.get()] = static_cast<int64_t>(ops.size());
+
+    // Linear-scan register allocation for intermediate results.
+    std::vector<int64_t> free_registers;
+    for (int64_t i = 0; i < static_cast<int64_t>(ops.size()); ++i) {
+        const Node* op = ops[i];
+        FusedEWInstruction instruction;
+        instruction.lhs_ = node_to_register.at(op->lhs_.get());
+        if (op->node_type_ == Node::NodeType::Unary) {
+            instruction.op_type_ = FusedEWInstruction::OpType::Unary;
+            instruction.unary_op_code_ = op->unary_op_code_;
+        } else {
+            instruction.op_type_ = FusedEWInstruction::OpType::Binary;
+            instruction.binary_op_code_ = op->binary_op_code_;
+            instruction.rhs_ = node_to_register.at(op->rhs_.get());
+        }
+
+        // Operands read for the last time can be overwritten by this
+        // instruction, since all kernels are elementwise.
+        for (const Node* operand : {op->lhs_.get(), op->rhs_.get()}) {
+            if (operand == nullptr || last_use.at(operand) != i) {
+                continue;
+            }
+            int64_t reg = node_to_register.at(operand);
+            if (reg >= num_fixed_registers &&
+                std::find(free_registers.begin(), free_registers.end(),
+                          reg) == free_registers.end()) {
+                free_registers.push_back(reg);
+            }
+        }
+        if (free_registers.empty()) {
+            instruction.dst_ = program.num_registers_++;
+        } else {
+            instruction.dst_ = free_registers.back();
+            free_registers.pop_back();
+        }
+        node_to_register[op] = instruction.dst_;
+        program.instructions_.push_back(instruction);
+    }
+    program.output_register_ = node_to_register.at(node_.get());
+
+    return program;
+}
+
+/// Evaluates \p program op by op with the regular kernels. Used for devices
+/// without a fused kernel and for programs exceeding the Indexer's input
+/// limit.
+static void FusedEWEager(const FusedEWProgram& program, Tensor& dst) {
+    const int64_t num_inputs = static_cast<int64_t>(program.inputs_.size());
+    const Dtype dtype = dst.GetDtype();
+    const Device device = dst.GetDevice();
+
+    std::vector<Tensor> registers(program.num_registers_);
+    for (int64_t i = 0; i < num_inputs; ++i) {
+        registers[i] = program.inputs_[i];
+    }
+    for (size_t i = 0; i < program.constants_.size(); ++i) {
+        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+            registers[num_inputs + i] =
+                    Tensor::Full({}, program.constants_[i].To<scalar_t>(),
+                                 dtype, device);
+        });
+    }
+
+    for (const FusedEWInstruction& instruction : program.instructions_) {
+        const Tensor& lhs = registers[instruction.lhs_];
+        if (instruction.op_type_ == FusedEWInstruction::OpType::Unary) {
+            Tensor result = Tensor::Empty(lhs.GetShape(), dtype, device);
+            UnaryEW(lhs, result, instruction.unary_op_code_);
+            registers[instruction.dst_] = result;
+        } else {
+            const Tensor& rhs = registers[instruction.rhs_];
+            Tensor result = Tensor::Empty(
+                    shape_util::BroadcastedShape(lhs.GetShape(),
+                                                 rhs.GetShape()),
+                    dtype, device);
+            BinaryEW(lhs, rhs, result, instruction.binary_op_code_);
+            registers[instruction.dst_] = result;
+        }
+    }
+    Copy(registers[program.output_register_], dst);
+}
+
+Tensor FusedEWExpr::Eval() const {
+    Tensor dst = Tensor::Empty(shape_, dtype_, device_);
+    EvalTo(dst);
+    return dst;
+}
+
+void FusedEWExpr::EvalTo(Tensor& dst) const {
+    if (dst.GetShape() != shape_) {
+        utility::LogError(
+                "The broadcasted input shape {} does not match the output "
+                "shape {}.",
+                shape_, dst.GetShape());
+    }
+    if (dst.GetDtype() != dtype_) {
+        utility::LogError("Dtype mismatch {} != {}.", dtype_.ToString(),
+                          dst.GetDtype().ToString());
+    }
+    if (dst.GetDevice() != device_) {
+        utility::LogError("Device mismatch {} != {}.", device_.ToString(),
+                          dst.GetDevice().ToString());
+    }
+
+    FusedEWProgram program = Compile();
+    if (device_.GetType() == Device::DeviceType::CPU &&
+        static_cast<int64_t>(program.inputs_.size()) <= MAX_INPUTS) {
+        FusedEWCPU(program, dst);
+    } else {
+        utility::LogDebug(
+                "FusedEWExpr: evaluating {} ops eagerly on {} with {} "
+                "inputs.",
+                program.instructions_.size(), device_.ToString(),
+                program.inputs_.size());
+        FusedEWEager(program, dst);
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,206 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Scalar.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/BinaryEW.h"
+#include "open3d/core/kernel/UnaryEW.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// One step of a compiled FusedEWProgram. Registers are indices into the
+/// program's per-thread register file, see FusedEWProgram.
+struct FusedEWInstruction {
+    enum class OpType { Unary, Binary };
+
+    OpType op_type_;
+    UnaryEWOpCode unary_op_code_ = UnaryEWOpCode::Neg;
+    BinaryEWOpCode binary_op_code_ = BinaryEWOpCode::Add;
+    int64_t dst_ = 0;
+    int64_t lhs_ = 0;
+    int64_t rhs_ = 0;
+};
+
+/// A linearized FusedEWExpr, ready to be executed by a device kernel.
+///
+/// Register layout:
+/// - [0, inputs_.size()): loaded from inputs_ for every block of elements.
+/// - [inputs_.size(), inputs_.size() + constants_.size()): constants, filled
+///   once per thread.
+/// - The remaining registers hold intermediate results. They are recycled
+///   once their value is no longer needed, so the register file stays small
+///   and cache-resident even for long chains.
+struct FusedEWProgram {
+    std::vector<Tensor> inputs_;
+    std::vector<Scalar> constants_;
+    std::vector<FusedEWInstruction> instructions_;
+    int64_t num_registers_ = 0;
+    int64_t output_register_ = 0;
+};
+
+/// \class FusedEWExpr
+///
+/// Lazily recorded chain of elementwise Tensor ops.
+///
+/// Eager Tensor expressions such as `a.Mul(b).Add(c).Sqrt()` allocate a
+/// temporary Tensor and run one pass over memory per op. A FusedEWExpr only
+/// records the ops; Eval() then computes the whole chain in a single pass,
+/// reading each input once and writing the output once. On CPU, elements are
+/// processed in small cache-resident blocks, so no full-size intermediate is
+/// ever materialized.
+///
+/// Example:
+///
+/// ```cpp
+/// using core::kernel::FusedEWExpr;
+/// Tensor d = (FusedEWExpr(a) * b + c).Sqrt().Eval();
+/// // In-place, equivalent to t.Add_(a.Mul(2.0)).
+/// (FusedEWExpr(t) + FusedEWExpr(a) * 2.0).EvalTo(t);
+/// ```
+///
+/// Supported ops are the arithmetic BinaryEWOpCode (Add, Sub, Mul, Div) and
+/// the dtype-preserving UnaryEWOpCode (all except IsNan, IsInf, IsFinite and
+/// LogicalNot). All Tensor operands must have the same dtype and device, and
+/// their shapes must be broadcastable. Non-CPU devices fall back to eager
+/// evaluation.
+class FusedEWExpr {
+public:
+    /// Leaf expression referencing \p tensor. The tensor's memory is read at
+    /// evaluation time, not at construction time.
+    FusedEWExpr(const Tensor& tensor);
+
+    FusedEWExpr Add(const FusedEWExpr& value) const;
+    FusedEWExpr Add(Scalar value) const;
+    FusedEWExpr Sub(const FusedEWExpr& value) const;
+    FusedEWExpr Sub(Scalar value) const;
+    FusedEWExpr Mul(const FusedEWExpr& value) const;
+    FusedEWExpr Mul(Scalar value) const;
+    FusedEWExpr Div(const FusedEWExpr& value) const;
+    FusedEWExpr Div(Scalar value) const;
+
+    FusedEWExpr Sqrt() const;
+    FusedEWExpr Sin() const;
+    FusedEWExpr Cos() const;
+    FusedEWExpr Neg() const;
+    FusedEWExpr Exp() const;
+    FusedEWExpr Abs() const;
+    FusedEWExpr Floor() const;
+    FusedEWExpr Ceil() const;
+    FusedEWExpr Round() const;
+    FusedEWExpr Trunc() const;
+
+    /// Evaluates the expression into a newly allocated Tensor.
+    Tensor Eval() const;
+
+    /// Evaluates the expression into \p dst. \p dst must have the broadcasted
+    /// shape, dtype and device of the expression. \p dst may be one of the
+    /// leaf tensors (e.g. for in-place accumulation), as long as that leaf is
+    /// not broadcasted.
+    void EvalTo(Tensor& dst) const;
+
+    /// Returns the broadcasted shape of all Tensor leaves.
+    SizeVector GetShape() const { return shape_; }
+
+    Dtype GetDtype() const { return dtype_; }
+
+    Device GetDevice() const { return device_; }
+
+    /// Linearizes the recorded expression into a FusedEWProgram.
+    FusedEWProgram Compile() const;
+
+protected:
+    struct Node;
+
+    FusedEWExpr(const std::shared_ptr<const Node>& node,
+                const SizeVector& shape,
+                const Dtype& dtype,
+                const Device& device)
+        : node_(node), shape_(shape), dtype_(dtype), device_(device) {}
+
+    FusedEWExpr Unary(UnaryEWOpCode op_code) const;
+    FusedEWExpr Binary(const FusedEWExpr& value,
+                       BinaryEWOpCode op_code) const;
+    FusedEWExpr Binary(Scalar value, BinaryEWOpCode op_code) const;
+
+    std::shared_ptr<const Node> node_;
+    SizeVector shape_;
+    Dtype dtype_;
+    Device device_;
+};
+
+inline FusedEWExpr operator+(const FusedEWExpr& lhs, const FusedEWExpr& rhs) {
+    return lhs.Add(rhs);
+}
+inline FusedEWExpr operator+(const FusedEWExpr& lhs, Scalar rhs) {
+    return lhs.Add(rhs);
+}
+inline FusedEWExpr operator-(const FusedEWExpr& lhs, const FusedEWExpr& rhs) {
+    return lhs.Sub(rhs);
+}
+inline FusedEWExpr operator-(const FusedEWExpr& lhs, Scalar rhs) {
+    return lhs.Sub(rhs);
+}
+inline FusedEWExpr operator*(const FusedEWExpr& lhs, const FusedEWExpr& rhs) {
+    return lhs.Mul(rhs);
+}
+inline FusedEWExpr operator*(const FusedEWExpr& lhs, Scalar rhs) {
+    return lhs.Mul(rhs);
+}
+inline FusedEWExpr operator/(const FusedEWExpr& lhs, const FusedEWExpr& rhs) {
+    return lhs.Div(rhs);
+}
+inline FusedEWExpr operator/(const FusedEWExpr& lhs, Scalar rhs) {
+    return lhs.Div(rhs);
+}
+// Tensor operands need their own overloads, otherwise the templated scalar
+// operators in Tensor.h would be a better match.
+inline FusedEWExpr operator+(const FusedEWExpr& lhs, const Tensor& rhs) {
+    return lhs.Add(rhs);
+}
+inline FusedEWExpr operator-(const FusedEWExpr& lhs, const Tensor& rhs) {
+    return lhs.Sub(rhs);
+}
+inline FusedEWExpr operator*(const FusedEWExpr& lhs, const Tensor& rhs) {
+    return lhs.Mul(rhs);
+}
+inline FusedEWExpr operator/(const FusedEWExpr& lhs, const Tensor& rhs) {
+    return lhs.Div(rhs);
+}
+inline FusedEWExpr operator-(const FusedEWExpr& expr) { return expr.Neg(); }
+
+/// Runs \p program on CPU, writing the result to \p dst.
+void FusedEWCPU(const FusedEWProgram& program, Tensor& dst);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,237 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Number of elements processed per block. With 8-byte dtypes, a register
+/// takes 4KB, so a typical register file stays within L1/L2.
+static constexpr int64_t FUSED_EW_BLOCK_SIZE = 512;
+
+template <typename scalar_t>
+static void CPUFusedUnaryKernel(UnaryEWOpCode op_code,
+                                const scalar_t* src,
+                                scalar_t* dst,
+                                int64_t n) {
+    switch (op_code) {
+        case UnaryEWOpCode::Sqrt:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(std::sqrt(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Sin:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(std::sin(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Cos:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(std::cos(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Neg:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(-src[i]);
+            }
+            break;
+        case UnaryEWOpCode::Exp:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(std::exp(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Abs:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::abs(static_cast<double>(src[i])));
+            }
+            break;
+        case UnaryEWOpCode::Floor:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::floor(static_cast<double>(src[i])));
+            }
+            break;
+        case UnaryEWOpCode::Ceil:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::ceil(static_cast<double>(src[i])));
+            }
+            break;
+        case UnaryEWOpCode::Round:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::round(static_cast<double>(src[i])));
+            }
+            break;
+        case UnaryEWOpCode::Trunc:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::trunc(static_cast<double>(src[i])));
+            }
+            break;
+        default:
+            utility::LogError("Unsupported op code in fused kernel.");
+            break;
+    }
+}
+
+template <typename scalar_t>
+static void CPUFusedBinaryKernel(BinaryEWOpCode op_code,
+                                 const scalar_t* lhs,
+                                 const scalar_t* rhs,
+                                 scalar_t* dst,
+                                 int64_t n) {
+    switch (op_code) {
+        case BinaryEWOpCode::Add:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = lhs[i] + rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Sub:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = lhs[i] - rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Mul:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = lhs[i] * rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Div:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = lhs[i] / rhs[i];
+            }
+            break;
+        default:
+            utility::LogError("Unsupported op code in fused kernel.");
+            break;
+    }
+}
+
+template <typename scalar_t>
+static void LaunchFusedEWCPUKernel(const FusedEWProgram& program,
+                                   const Indexer& indexer) {
+    const int64_t num_workloads = indexer.NumWorkloads();
+    const int64_t num_blocks =
+            (num_workloads + FUSED_EW_BLOCK_SIZE - 1) / FUSED_EW_BLOCK_SIZE;
+    const int64_t num_inputs = indexer.NumInputs();
+    const int64_t num_registers = program.num_registers_;
+
+    std::vector<bool> input_packed(num_inputs);
+    for (int64_t i = 0; i < num_inputs; ++i) {
+        input_packed[i] = indexer.IsInputContiguous(i);
+    }
+    const bool output_packed = indexer.IsOutputContiguous();
+
+#pragma omp parallel
+    {
+        // Per-thread register file. Packed inputs are read in place, all
+        // other registers point into the buffer.
+        std::vector<scalar_t> buffer(num_registers * FUSED_EW_BLOCK_SIZE);
+        std::vector<const scalar_t*> src_ptrs(num_registers);
+        for (int64_t r = 0; r < num_registers; ++r) {
+            src_ptrs[r] = buffer.data() + r * FUSED_EW_BLOCK_SIZE;
+        }
+        for (size_t c = 0; c < program.constants_.size(); ++c) {
+            scalar_t* reg =
+                    buffer.data() + (num_inputs + c) * FUSED_EW_BLOCK_SIZE;
+            std::fill(reg, reg + FUSED_EW_BLOCK_SIZE,
+                      program.constants_[c].To<scalar_t>());
+        }
+
+#pragma omp for schedule(static)
+        for (int64_t block_idx = 0; block_idx < num_blocks; ++block_idx) {
+            const int64_t start = block_idx * FUSED_EW_BLOCK_SIZE;
+            const int64_t count =
+                    std::min(FUSED_EW_BLOCK_SIZE, num_workloads - start);
+
+            for (int64_t i = 0; i < num_inputs; ++i) {
+                if (input_packed[i]) {
+                    src_ptrs[i] = reinterpret_cast<const scalar_t*>(
+                            indexer.GetInputPtr(i, start));
+                } else {
+                    scalar_t* reg = buffer.data() + i * FUSED_EW_BLOCK_SIZE;
+                    for (int64_t j = 0; j < count; ++j) {
+                        reg[j] = *reinterpret_cast<const scalar_t*>(
+                                indexer.GetInputPtr(i, start + j));
+                    }
+                    src_ptrs[i] = reg;
+                }
+            }
+
+            for (const FusedEWInstruction& instruction :
+                 program.instructions_) {
+                scalar_t* dst =
+                        buffer.data() + instruction.dst_ * FUSED_EW_BLOCK_SIZE;
+                if (instruction.op_type_ ==
+                    FusedEWInstruction::OpType::Unary) {
+                    CPUFusedUnaryKernel(instruction.unary_op_code_,
+                                        src_ptrs[instruction.lhs_], dst, count);
+                } else {
+                    CPUFusedBinaryKernel(instruction.binary_op_code_,
+                                         src_ptrs[instruction.lhs_],
+                                         src_ptrs[instruction.rhs_], dst,
+                                         count);
+                }
+            }
+
+            const scalar_t* result = src_ptrs[program.output_register_];
+            if (output_packed) {
+                char* out_ptr = indexer.GetOutputPtr(start);
+                if (reinterpret_cast<const char*>(result) != out_ptr) {
+                    std::memcpy(out_ptr, result, count * sizeof(scalar_t));
+                }
+            } else {
+                for (int64_t j = 0; j < count; ++j) {
+                    *reinterpret_cast<scalar_t*>(
+                            indexer.GetOutputPtr(start + j)) = result[j];
+                }
+            }
+        }
+    }
+}
+
+void FusedEWCPU(const FusedEWProgram& program, Tensor& dst) {
+    Indexer indexer(program.inputs_, dst, DtypePolicy::ALL_SAME);
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        LaunchFusedEWCPUKernel<scalar_t>(program, indexer);
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
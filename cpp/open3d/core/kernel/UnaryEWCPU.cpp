@@ -54,42 +54,6 @@ static void CPUCopyObjectElementKernel(const void* src,
     memcpy(dst_bytes, src_bytes, object_byte_size);
 }
 
-template <typename scalar_t>
-static void CPUSqrtElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(
-            std::sqrt(*static_cast<const scalar_t*>(src)));
-}
-
-template <typename scalar_t>
-static void CPUSinElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) =
-            static_cast<scalar_t>(std::sin(*static_cast<const scalar_t*>(src)));
-}
-
-template <typename scalar_t>
-static void CPUCosElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) =
-            static_cast<scalar_t>(std::cos(*static_cast<const scalar_t*>(src)));
-}
-
-template <typename scalar_t>
-static void CPUNegElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) =
-            static_cast<scalar_t>(-*static_cast<const scalar_t*>(src));
-}
-
-template <typename scalar_t>
-static void CPUExpElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) =
-            static_cast<scalar_t>(std::exp(*static_cast<const scalar_t*>(src)));
-}
-
-template <typename scalar_t>
-static void CPUAbsElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(
-            std::abs(static_cast<double>(*static_cast<const scalar_t*>(src))));
-}
-
 template <typename scalar_t>
 static void CPUIsNanElementKernel(const void* src, void* dst) {
     *static_cast<bool*>(dst) =
@@ -108,36 +72,87 @@ static void CPUIsFiniteElementKernel(const void* src, void* dst) {
             static_cast<float>(*static_cast<const scalar_t*>(src)));
 }
 
-template <typename scalar_t>
-static void CPUFloorElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(std::floor(
-            static_cast<double>(*static_cast<const scalar_t*>(src))));
-}
-
-template <typename scalar_t>
-static void CPUCeilElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(
-            std::ceil(static_cast<double>(*static_cast<const scalar_t*>(src))));
-}
-
-template <typename scalar_t>
-static void CPURoundElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(std::round(
-            static_cast<double>(*static_cast<const scalar_t*>(src))));
-}
-
-template <typename scalar_t>
-static void CPUTruncElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(std::trunc(
-            static_cast<double>(*static_cast<const scalar_t*>(src))));
-}
-
 template <typename src_t, typename dst_t>
 static void CPULogicalNotElementKernel(const void* src, void* dst) {
     *static_cast<dst_t*>(dst) = static_cast<dst_t>(
             !static_cast<bool>(*static_cast<const src_t*>(src)));
 }
 
+template <typename scalar_t>
+static void LaunchArithmeticUnaryEWCPUKernel(UnaryEWOpCode op_code,
+                                             const Indexer& indexer) {
+    switch (op_code) {
+        case UnaryEWOpCode::Sqrt:
+            CPULauncher::LaunchUnaryEWVectorizedKernel<scalar_t, scalar_t>(
+                    indexer, [](scalar_t src) {
+                        return static_cast<scalar_t>(std::sqrt(src));
+                    });
+            break;
+        case UnaryEWOpCode::Sin:
+            CPULauncher::LaunchUnaryEWVectorizedKernel<scalar_t, scalar_t>(
+                    indexer, [](scalar_t src) {
+                        return static_cast<scalar_t>(std::sin(src));
+                    });
+            break;
+        case UnaryEWOpCode::Cos:
+            CPULauncher::LaunchUnaryEWVectorizedKernel<scalar_t, scalar_t>(
+                    indexer, [](scalar_t src) {
+                        return static_cast<scalar_t>(std::cos(src));
+                    });
+            break;
+        case UnaryEWOpCode::Neg:
+            CPULauncher::LaunchUnaryEWVectorizedKernel<scalar_t, scalar_t>(
+                    indexer, [](scalar_t src) {
+                        return static_cast<scalar_t>(-src);
+                    });
+            break;
+        case UnaryEWOpCode::Exp:
+            CPULauncher::LaunchUnaryEWVectorizedKernel<scalar_t, scalar_t>(
+                    indexer, [](scalar_t src) {
+                        return static_cast<scalar_t>(std::exp(src));
+                    });
+            break;
+        case UnaryEWOpCode::Abs:
+            CPULauncher::LaunchUnaryEWVectorizedKernel<scalar_t, scalar_t>(
+                    indexer, [](scalar_t src) {
+                        return static_cast<scalar_t>(
+                                std::abs(static_cast<double>(src)));
+                    });
+            break;
+        case UnaryEWOpCode::Floor:
+            CPULauncher::LaunchUnaryEWVectorizedKernel<scalar_t, scalar_t>(
+                    indexer, [](scalar_t src) {
+                        return static_cast<scalar_t>(
+                                std::floor(static_cast<double>(src)));
+                    });
+            break;
+        case UnaryEWOpCode::Ceil:
+            CPULauncher::LaunchUnaryEWVectorizedKernel<scalar_t, scalar_t>(
+                    indexer, [](scalar_t src) {
+                        return static_cast<scalar_t>(
+                                std::ceil(static_cast<double>(src)));
+                    });
+            break;
+        case UnaryEWOpCode::Round:
+            CPULauncher::LaunchUnaryEWVectorizedKernel<scalar_t, scalar_t>(
+                    indexer, [](scalar_t src) {
+                        return static_cast<scalar_t>(
+                                std::round(static_cast<double>(src)));
+                    });
+            break;
+        case UnaryEWOpCode::Trunc:
+            CPULauncher::LaunchUnaryEWVectorizedKernel<scalar_t, scalar_t>(
+                    indexer, [](scalar_t src) {
+                        return static_cast<scalar_t>(
+                                std::trunc(static_cast<double>(src)));
+                    });
+            break;
+        default:
+            utility::LogError("Unimplemented op_code for UnaryEWCPU");
+            break;
+    }
+}
+
 void CopyCPU(const Tensor& src, Tensor& dst) {
     // src and dst have been checked to have the same shape, dtype, device
     SizeVector shape = src.GetShape();
@@ -232,57 +247,13 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
             }
         });
     } else {
+        if (op_code == UnaryEWOpCode::Sqrt || op_code == UnaryEWOpCode::Sin ||
+            op_code == UnaryEWOpCode::Cos || op_code == UnaryEWOpCode::Exp) {
+            assert_dtype_is_float(src_dtype);
+        }
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
-            switch (op_code) {
-                case UnaryEWOpCode::Sqrt:
-                    assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUSqrtElementKernel<scalar_t>);
-                    break;
-                case UnaryEWOpCode::Sin:
-                    assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUSinElementKernel<scalar_t>);
-                    break;
-                case UnaryEWOpCode::Cos:
-                    assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUCosElementKernel<scalar_t>);
-                    break;
-                case UnaryEWOpCode::Neg:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUNegElementKernel<scalar_t>);
-                    break;
-                case UnaryEWOpCode::Exp:
-                    assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUExpElementKernel<scalar_t>);
-                    break;
-                case UnaryEWOpCode::Abs:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUAbsElementKernel<scalar_t>);
-                    break;
-                case UnaryEWOpCode::Floor:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUFloorElementKernel<scalar_t>);
-                    break;
-                case UnaryEWOpCode::Ceil:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUCeilElementKernel<scalar_t>);
-                    break;
-                case UnaryEWOpCode::Round:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPURoundElementKernel<scalar_t>);
-                    break;
-                case UnaryEWOpCode::Trunc:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUTruncElementKernel<scalar_t>);
-                    break;
-                default:
-                    utility::LogError("Unimplemented op_code for UnaryEWCPU");
-                    break;
-            }
+            LaunchArithmeticUnaryEWCPUKernel<scalar_t>(op_code, indexer);
         });
     }
 }
@@ -26,11 +26,8 @@
 
 #include "open3d/core/nns/FixedRadiusIndex.h"
 
-#ifdef BUILD_CUDA_MODULE
-#include "open3d/core/nns/FixedRadiusSearch.h"
-#endif
-
 #include "open3d/core/Dispatch.h"
+#include "open3d/core/nns/FixedRadiusSearch.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -48,23 +45,29 @@ FixedRadiusIndex::~FixedRadiusIndex(){};
 
 bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
                                      double radius) {
-#ifdef BUILD_CUDA_MODULE
-    if (dataset_points.GetDevice().GetType() != Device::DeviceType::CUDA) {
+#ifndef BUILD_CUDA_MODULE
+    if (dataset_points.GetDevice().GetType() == Device::DeviceType::CUDA) {
         utility::LogError(
-                "[FixedRadiusIndex::SetTensorData] dataset_points should be "
-                "GPU Tensor.");
+                "FixedRadiusIndex::SetTensorData BUILD_CUDA_MODULE is OFF. "
+                "Please compile Open3d with BUILD_CUDA_MODULE=ON.");
     }
+#endif
     if (radius <= 0) {
         utility::LogError(
                 "[FixedRadiusIndex::SetTensorData] radius should be positive.");
     }
+    dataset_points.AssertShapeCompatible({utility::nullopt, 3});
     dataset_points_ = dataset_points.Contiguous();
+    radius_ = radius;
     Device device = GetDevice();
     Dtype dtype = GetDtype();
 
     int64_t num_dataset_points = GetDatasetSize();
+    const double size_factor = device.GetType() == Device::DeviceType::CPU
+                                       ? cpu_hash_table_size_factor
+                                       : hash_table_size_factor;
     int64_t hash_table_size = std::min<int64_t>(
-            std::max<int64_t>(hash_table_size_factor * num_dataset_points, 1),
+            std::max<int64_t>(size_factor * num_dataset_points, 1),
             max_hash_tabls_size);
     points_row_splits_ = std::vector<int64_t>({0, num_dataset_points});
     hash_table_splits_ = std::vector<int64_t>({0, hash_table_size});
@@ -74,6 +77,23 @@ bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
     hash_table_cell_splits_ = Tensor::Empty({hash_table_splits_.back() + 1},
                                             Dtype::Int64, device);
 
+    if (device.GetType() == Device::DeviceType::CPU) {
+        hash_table_points_ =
+                Tensor::Empty({num_dataset_points, 3}, dtype, device);
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+            BuildSpatialHashTableCPU(
+                    num_dataset_points, dataset_points_.GetDataPtr<scalar_t>(),
+                    scalar_t(radius), points_row_splits_.size(),
+                    points_row_splits_.data(), hash_table_splits_.data(),
+                    hash_table_cell_splits_.GetShape()[0],
+                    hash_table_cell_splits_.GetDataPtr<int64_t>(),
+                    hash_table_index_.GetDataPtr<int64_t>(),
+                    hash_table_points_.GetDataPtr<scalar_t>());
+        });
+        return true;
+    }
+
+#ifdef BUILD_CUDA_MODULE
     void *temp_ptr = nullptr;
     size_t temp_size = 0;
 
@@ -101,17 +121,12 @@ bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
                                   hash_table_cell_splits_.GetDataPtr<int64_t>(),
                                   hash_table_index_.GetDataPtr<int64_t>());
     });
-    return true;
-#else
-    utility::LogError(
-            "FixedRadiusIndex::SetTensorData BUILD_CUDA_MODULE is OFF. Please "
-            "compile Open3d with BUILD_CUDA_MODULE=ON.");
 #endif
+    return true;
 };
 
 std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
         const Tensor &query_points, double radius, bool sort) const {
-#ifdef BUILD_CUDA_MODULE
     Dtype dtype = GetDtype();
     Device device = GetDevice();
     int64_t num_dataset_points = GetDatasetSize();
@@ -134,14 +149,44 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
     int64_t num_query_points = query_points_.GetShape()[0];
     std::vector<int64_t> queries_row_splits({0, num_query_points});
 
-    void *temp_ptr = nullptr;
-    size_t temp_size = 0;
-
     Tensor neighbors_index;
     Tensor neighbors_distance;
     Tensor neighbors_row_splits =
             Tensor({num_query_points + 1}, Dtype::Int64, device);
 
+    if (device.GetType() == Device::DeviceType::CPU) {
+        if (radius > radius_) {
+            utility::LogError(
+                    "[FixedRadiusIndex::SearchRadius] radius {} is larger "
+                    "than the radius {} of the index.",
+                    radius, radius_);
+        }
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+            NeighborSearchAllocator<scalar_t> output_allocator(device);
+            FixedRadiusSearchCPU(
+                    neighbors_row_splits.GetDataPtr<int64_t>(),
+                    num_dataset_points, dataset_points_.GetDataPtr<scalar_t>(),
+                    num_query_points, query_points_.GetDataPtr<scalar_t>(),
+                    scalar_t(radius), scalar_t(radius_),
+                    points_row_splits_.size(), points_row_splits_.data(),
+                    queries_row_splits.size(), queries_row_splits.data(),
+                    hash_table_splits_.data(),
+                    hash_table_cell_splits_.GetShape()[0],
+                    hash_table_cell_splits_.GetDataPtr<int64_t>(),
+                    hash_table_index_.GetDataPtr<int64_t>(),
+                    hash_table_points_.GetDataPtr<scalar_t>(), sort,
+                    output_allocator);
+            neighbors_index = output_allocator.NeighborsIndex();
+            neighbors_distance = output_allocator.NeighborsDistance();
+        });
+        return std::make_tuple(neighbors_index, neighbors_distance,
+                               neighbors_row_splits);
+    }
+
+#ifdef BUILD_CUDA_MODULE
+    void *temp_ptr = nullptr;
+    size_t temp_size = 0;
+
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
         NeighborSearchAllocator<scalar_t> output_allocator(device);
         // Determine temp_size.
@@ -224,7 +269,6 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
 
 std::pair<Tensor, Tensor> FixedRadiusIndex::SearchHybrid(
         const Tensor &query_points, double radius, int max_knn) const {
-#ifdef BUILD_CUDA_MODULE
     Dtype dtype = GetDtype();
     Device device = GetDevice();
     int64_t num_dataset_points = GetDatasetSize();
@@ -249,6 +293,36 @@ std::pair<Tensor, Tensor> FixedRadiusIndex::SearchHybrid(
 
     Tensor neighbors_index, neighbors_distance;
 
+    if (device.GetType() == Device::DeviceType::CPU) {
+        if (radius > radius_) {
+            utility::LogError(
+                    "[FixedRadiusIndex::SearchHybrid] radius {} is larger "
+                    "than the radius {} of the index.",
+                    radius, radius_);
+        }
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+            NeighborSearchAllocator<scalar_t> output_allocator(device);
+            HybridSearchCPU(
+                    num_dataset_points, dataset_points_.GetDataPtr<scalar_t>(),
+                    num_query_points, query_points_.GetDataPtr<scalar_t>(),
+                    scalar_t(radius), scalar_t(radius_), max_knn,
+                    points_row_splits_.size(), points_row_splits_.data(),
+                    queries_row_splits.size(), queries_row_splits.data(),
+                    hash_table_splits_.data(),
+                    hash_table_cell_splits_.GetShape()[0],
+                    hash_table_cell_splits_.GetDataPtr<int64_t>(),
+                    hash_table_index_.GetDataPtr<int64_t>(),
+                    hash_table_points_.GetDataPtr<scalar_t>(),
+                    output_allocator);
+            neighbors_index = output_allocator.NeighborsIndex();
+            neighbors_distance = output_allocator.NeighborsDistance();
+        });
+        return std::make_pair(
+                neighbors_index.View({num_query_points, max_knn}),
+                neighbors_distance.View({num_query_points, max_knn}));
+    }
+
+#ifdef BUILD_CUDA_MODULE
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
         NeighborSearchAllocator<scalar_t> output_allocator(device);
         // Determine temp_size.
@@ -86,13 +86,21 @@ public:
                                            int max_knn) const override;
 
     const double hash_table_size_factor = 1.0 / 32;
+    /// The CPU search is bound by memory latency rather than by the number of
+    /// candidates, so it uses a larger table with fewer collisions per cell.
+    const double cpu_hash_table_size_factor = 1.0;
     const int64_t max_hash_tabls_size = 33554432;
 
 protected:
+    /// Radius the spatial hash table was built for. CPU searches use it for
+    /// the cell size and accept any search radius up to it.
+    double radius_ = 0;
     std::vector<int64_t> points_row_splits_;
     std::vector<int64_t> hash_table_splits_;
     Tensor hash_table_cell_splits_;
     Tensor hash_table_index_;
+    /// CPU only. The dataset points in the order of hash_table_index_.
+    Tensor hash_table_points_;
 };
 
 template <class T>
@@ -310,6 +310,157 @@ void SortPairs(void* temp,
                int64_t* indices_sorted,
                T* distances_sorted);
 
+/// Builds a spatial hash table for a fixed radius search of 3D points on the
+/// CPU. The points are binned into the cells in parallel with OpenMP.
+///
+/// All pointer arguments point to host memory.
+///
+/// \param num_points    The number of points.
+///
+/// \param points    The array of 3D points.
+///
+/// \param radius    The radius that will be used for searching. The cells of
+///        the hash table are cubes with an edge length of 2 * radius.
+///
+/// \param points_row_splits_size    The size of the points_row_splits array.
+///        The size of the array is batch_size+1.
+///
+/// \param points_row_splits    Defines the start and end of the points in
+///        each batch item. The size of the array is batch_size+1. If there is
+///        only 1 batch item then this array is [0, num_points]
+///
+/// \param hash_table_splits    Array defining the start and end the hash table
+///        for each batch item. This is [0, number of cells] if there is only
+///        1 batch item or [0, hash_table_cell_splits_size-1] which is the same.
+///
+/// \param hash_table_cell_splits_size    This is the length of the
+///        hash_table_cell_splits array.
+///
+/// \param hash_table_cell_splits    This is an output array storing the start
+///        of each hash table entry. The size of this array defines the size of
+///        the hash table.
+///        The hash table size is hash_table_cell_splits_size - 1.
+///
+/// \param hash_table_index    This is an output array storing the values of the
+///        hash table, which are the indices to the points. The size of the
+///        array must be equal to the number of points.
+///
+/// \param hash_table_points    This is an output array storing the point
+///        coordinates in the order of \p hash_table_index, so that the points
+///        of a cell can be read contiguously. The size of the array must be
+///        3 * num_points.
+///
+template <class T>
+void BuildSpatialHashTableCPU(const size_t num_points,
+                              const T* const points,
+                              const T radius,
+                              const size_t points_row_splits_size,
+                              const int64_t* points_row_splits,
+                              const int64_t* hash_table_splits,
+                              const size_t hash_table_cell_splits_size,
+                              int64_t* hash_table_cell_splits,
+                              int64_t* hash_table_index,
+                              T* hash_table_points);
+
+/// Fixed radius search on the CPU. Computes the neighbor indices and the
+/// squared L2 distances for each query point in the same row splits format as
+/// FixedRadiusSearchCUDA. Chunks of query points are processed in parallel with
+/// OpenMP and the neighbors are gathered in a single pass.
+///
+/// All pointer arguments point to host memory.
+///
+/// \param query_neighbors_row_splits    This is the output pointer for the
+///        prefix sum. The length of this array is \p num_queries + 1.
+///
+/// \param num_points    The number of points.
+///
+/// \param points    Array with the 3D point positions. This must be the array
+///        that was used for building the spatial hash table.
+///
+/// \param num_queries    The number of query points.
+///
+/// \param queries    Array with the 3D query positions. This may be the same
+///        array as \p points.
+///
+/// \param radius    The search radius. Must not be larger than
+///        \p build_radius.
+///
+/// \param build_radius    The radius that was passed to
+///        BuildSpatialHashTableCPU.
+///
+/// \param points_row_splits_size    The size of the points_row_splits array.
+///
+/// \param points_row_splits    Defines the start and end of the points in each
+///        batch item.
+///
+/// \param queries_row_splits_size    The size of the queries_row_splits array.
+///
+/// \param queries_row_splits    Defines the start and end of the queries in
+///        each batch item.
+///
+/// \param hash_table_splits    Array defining the start and end the hash table
+///        for each batch item.
+///
+/// \param hash_table_cell_splits_size    This is the length of the
+///        hash_table_cell_splits array.
+///
+/// \param hash_table_cell_splits    This is an output of the function
+///        BuildSpatialHashTableCPU.
+///
+/// \param hash_table_index    This is an output of the function
+///        BuildSpatialHashTableCPU.
+///
+/// \param hash_table_points    This is an output of the function
+///        BuildSpatialHashTableCPU.
+///
+/// \param sort    If true, the neighbors of each query point are sorted by
+///        distance, with ties broken by index.
+///
+/// \param output_allocator    The allocator for the indices and distances.
+///
+template <class T>
+void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
+                          size_t num_points,
+                          const T* const points,
+                          size_t num_queries,
+                          const T* const queries,
+                          const T radius,
+                          const T build_radius,
+                          const size_t points_row_splits_size,
+                          const int64_t* const points_row_splits,
+                          const size_t queries_row_splits_size,
+                          const int64_t* const queries_row_splits,
+                          const int64_t* const hash_table_splits,
+                          size_t hash_table_cell_splits_size,
+                          const int64_t* const hash_table_cell_splits,
+                          const int64_t* const hash_table_index,
+                          const T* const hash_table_points,
+                          const bool sort,
+                          NeighborSearchAllocator<T>& output_allocator);
+
+/// Hybrid search on the CPU. Returns at most \p max_knn nearest neighbors
+/// within \p radius for each query point, sorted by distance. The outputs
+/// have num_queries * max_knn entries; unused entries have index -1 and
+/// distance 0. The arguments are the same as for FixedRadiusSearchCPU.
+template <class T>
+void HybridSearchCPU(size_t num_points,
+                     const T* const points,
+                     size_t num_queries,
+                     const T* const queries,
+                     const T radius,
+                     const T build_radius,
+                     const int max_knn,
+                     const size_t points_row_splits_size,
+                     const int64_t* const points_row_splits,
+                     const size_t queries_row_splits_size,
+                     const int64_t* const queries_row_splits,
+                     const int64_t* const hash_table_splits,
+                     size_t hash_table_cell_splits_size,
+                     const int64_t* const hash_table_cell_splits,
+                     const int64_t* const hash_table_index,
+                     const T* const hash_table_points,
+                     NeighborSearchAllocator<T>& output_allocator);
+
 }  // namespace nns
 }  // namespace core
 }  // namespace open3d
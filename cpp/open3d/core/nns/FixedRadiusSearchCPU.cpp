@@ -0,0 +1,465 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Atomic.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/core/nns/FixedRadiusSearch.h"
+#include "open3d/utility/MiniVec.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+namespace {
+
+template <class T>
+using Vec3 = utility::MiniVec<T, 3>;
+
+/// Collects the unique hash table cells that may contain neighbors within
+/// \p radius of \p pos. The cells have an edge length of 2 * build_radius, so
+/// the 8 corners of the query box cover all candidates as long as radius does
+/// not exceed build_radius. Returns the number of cells written to \p bins.
+template <class T>
+inline int FindBinsToVisit(int64_t* bins,
+                           const Vec3<T>& pos,
+                           const T radius,
+                           const T inv_voxel_size,
+                           const size_t hash_table_size,
+                           const size_t first_cell_idx) {
+    int num_bins = 0;
+    for (int dz = -1; dz <= 1; dz += 2) {
+        for (int dy = -1; dy <= 1; dy += 2) {
+            for (int dx = -1; dx <= 1; dx += 2) {
+                Vec3<T> p = pos + radius * Vec3<T>(T(dx), T(dy), T(dz));
+                int64_t bin =
+                        first_cell_idx +
+                        SpatialHash(ComputeVoxelIndex(p, inv_voxel_size)) %
+                                hash_table_size;
+                if (std::find(bins, bins + num_bins, bin) == bins + num_bins) {
+                    bins[num_bins++] = bin;
+                }
+            }
+        }
+    }
+    return num_bins;
+}
+
+/// Calls \p func(index, squared_distance) for every point within \p radius of
+/// the query point \p pos. The candidates of a cell are read from the
+/// contiguous copy \p hash_table_points.
+template <class T, class Func>
+inline void ForEachNeighbor(const Vec3<T>& pos,
+                            const T radius,
+                            const T inv_voxel_size,
+                            const size_t hash_table_size,
+                            const size_t first_cell_idx,
+                            const int64_t* const hash_table_cell_splits,
+                            const int64_t* const hash_table_index,
+                            const T* const hash_table_points,
+                            Func func) {
+    const T threshold = radius * radius;
+    int64_t bins[8];
+    const int num_bins = FindBinsToVisit(bins, pos, radius, inv_voxel_size,
+                                         hash_table_size, first_cell_idx);
+    for (int b = 0; b < num_bins; ++b) {
+        const int64_t begin_idx = hash_table_cell_splits[bins[b]];
+        const int64_t end_idx = hash_table_cell_splits[bins[b] + 1];
+        for (int64_t j = begin_idx; j < end_idx; ++j) {
+            const T* p = hash_table_points + 3 * j;
+            const T dx = p[0] - pos[0];
+            const T dy = p[1] - pos[1];
+            const T dz = p[2] - pos[2];
+            const T dist = dx * dx + dy * dy + dz * dz;
+            if (dist <= threshold) {
+                func(hash_table_index[j], dist);
+            }
+        }
+    }
+}
+
+template <class T>
+inline bool CompareNeighbors(const std::pair<T, int64_t>& a,
+                             const std::pair<T, int64_t>& b) {
+    return a.first < b.first || (a.first == b.first && a.second < b.second);
+}
+
+/// A contiguous range of query points of one batch item.
+struct QueryChunk {
+    int batch_idx;
+    int64_t begin;
+    int64_t end;
+};
+
+/// Splits the queries of all batch items into chunks for dynamic scheduling.
+inline std::vector<QueryChunk> MakeQueryChunks(
+        const size_t queries_row_splits_size,
+        const int64_t* const queries_row_splits) {
+    const int64_t num_queries =
+            queries_row_splits[queries_row_splits_size - 1];
+    const int64_t chunk_size = std::max<int64_t>(
+            256, num_queries / (16 * kernel::GetMaxThreads()));
+    std::vector<QueryChunk> chunks;
+    for (size_t i = 0; i + 1 < queries_row_splits_size; ++i) {
+        for (int64_t q = queries_row_splits[i]; q < queries_row_splits[i + 1];
+             q += chunk_size) {
+            chunks.push_back({int(i), q,
+                              std::min(q + chunk_size,
+                                       queries_row_splits[i + 1])});
+        }
+    }
+    return chunks;
+}
+
+}  // namespace
+
+template <class T>
+void BuildSpatialHashTableCPU(const size_t num_points,
+                              const T* const points,
+                              const T radius,
+                              const size_t points_row_splits_size,
+                              const int64_t* points_row_splits,
+                              const int64_t* hash_table_splits,
+                              const size_t hash_table_cell_splits_size,
+                              int64_t* hash_table_cell_splits,
+                              int64_t* hash_table_index,
+                              T* hash_table_points) {
+    const int batch_size = points_row_splits_size - 1;
+    const T inv_voxel_size = 1 / (2 * radius);
+
+    // Count the points of each cell. The counts are stored one slot to the
+    // right so that the prefix sum turns them into row splits in place.
+    std::vector<int64_t> point_cells(num_points);
+    std::memset(hash_table_cell_splits, 0,
+                sizeof(int64_t) * hash_table_cell_splits_size);
+    for (int i = 0; i < batch_size; ++i) {
+        const size_t hash_table_size =
+                hash_table_splits[i + 1] - hash_table_splits[i];
+        const size_t first_cell_idx = hash_table_splits[i];
+#pragma omp parallel for schedule(static)
+        for (int64_t p = points_row_splits[i]; p < points_row_splits[i + 1];
+             ++p) {
+            Vec3<T> pos(points + 3 * p);
+            const int64_t cell =
+                    first_cell_idx +
+                    SpatialHash(ComputeVoxelIndex(pos, inv_voxel_size)) %
+                            hash_table_size;
+            point_cells[p] = cell;
+            AtomicFetchAddRelaxed(
+                    reinterpret_cast<uint64_t*>(
+                            &hash_table_cell_splits[cell + 1]),
+                    1);
+        }
+    }
+    for (size_t c = 1; c < hash_table_cell_splits_size; ++c) {
+        hash_table_cell_splits[c] += hash_table_cell_splits[c - 1];
+    }
+
+    // Scatter the point indices and coordinates into their cells.
+    std::vector<int64_t> cell_fill(hash_table_cell_splits,
+                                   hash_table_cell_splits +
+                                           hash_table_cell_splits_size - 1);
+#pragma omp parallel for schedule(static)
+    for (int64_t p = 0; p < int64_t(num_points); ++p) {
+        const int64_t slot = AtomicFetchAddRelaxed(
+                reinterpret_cast<uint64_t*>(&cell_fill[point_cells[p]]), 1);
+        hash_table_index[slot] = p;
+        hash_table_points[3 * slot + 0] = points[3 * p + 0];
+        hash_table_points[3 * slot + 1] = points[3 * p + 1];
+        hash_table_points[3 * slot + 2] = points[3 * p + 2];
+    }
+}
+
+template <class T>
+void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
+                          size_t num_points,
+                          const T* const points,
+                          size_t num_queries,
+                          const T* const queries,
+                          const T radius,
+                          const T build_radius,
+                          const size_t points_row_splits_size,
+                          const int64_t* const points_row_splits,
+                          const size_t queries_row_splits_size,
+                          const int64_t* const queries_row_splits,
+                          const int64_t* const hash_table_splits,
+                          size_t hash_table_cell_splits_size,
+                          const int64_t* const hash_table_cell_splits,
+                          const int64_t* const hash_table_index,
+                          const T* const hash_table_points,
+                          const bool sort,
+                          NeighborSearchAllocator<T>& output_allocator) {
+    // Return empty output arrays if there are no points.
+    if (0 == num_points || 0 == num_queries) {
+        std::fill(query_neighbors_row_splits,
+                  query_neighbors_row_splits + num_queries + 1, 0);
+        int64_t* indices_ptr;
+        output_allocator.AllocIndices(&indices_ptr, 0);
+
+        T* distances_ptr;
+        output_allocator.AllocDistances(&distances_ptr, 0);
+
+        return;
+    }
+
+    const T inv_voxel_size = 1 / (2 * build_radius);
+
+    // The neighbors are gathered in a single pass into per-chunk buffers,
+    // which are concatenated once the total count is known.
+    const std::vector<QueryChunk> chunks =
+            MakeQueryChunks(queries_row_splits_size, queries_row_splits);
+    const int64_t num_chunks = chunks.size();
+    std::vector<std::vector<int64_t>> chunk_indices(num_chunks);
+    std::vector<std::vector<T>> chunk_distances(num_chunks);
+
+#pragma omp parallel
+    {
+        std::vector<std::pair<T, int64_t>> neighbors;
+#pragma omp for schedule(dynamic, 1)
+        for (int64_t c = 0; c < num_chunks; ++c) {
+            const QueryChunk& chunk = chunks[c];
+            const size_t hash_table_size =
+                    hash_table_splits[chunk.batch_idx + 1] -
+                    hash_table_splits[chunk.batch_idx];
+            const size_t first_cell_idx = hash_table_splits[chunk.batch_idx];
+            std::vector<int64_t>& indices = chunk_indices[c];
+            std::vector<T>& distances = chunk_distances[c];
+            for (int64_t q = chunk.begin; q < chunk.end; ++q) {
+                neighbors.clear();
+                ForEachNeighbor(Vec3<T>(queries + 3 * q), radius,
+                                inv_voxel_size, hash_table_size,
+                                first_cell_idx, hash_table_cell_splits,
+                                hash_table_index, hash_table_points,
+                                [&](int64_t idx, T dist) {
+                                    neighbors.emplace_back(dist, idx);
+                                });
+                if (sort) {
+                    std::sort(neighbors.begin(), neighbors.end(),
+                              CompareNeighbors<T>);
+                }
+                for (const auto& neighbor : neighbors) {
+                    distances.push_back(neighbor.first);
+                    indices.push_back(neighbor.second);
+                }
+                query_neighbors_row_splits[q + 1] = neighbors.size();
+            }
+        }
+    }
+
+    query_neighbors_row_splits[0] = 0;
+    for (size_t q = 1; q <= num_queries; ++q) {
+        query_neighbors_row_splits[q] += query_neighbors_row_splits[q - 1];
+    }
+
+    const size_t num_indices = query_neighbors_row_splits[num_queries];
+    int64_t* indices_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices);
+    T* distances_ptr;
+    output_allocator.AllocDistances(&distances_ptr, num_indices);
+
+#pragma omp parallel for schedule(static)
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        const int64_t offset = query_neighbors_row_splits[chunks[c].begin];
+        std::copy(chunk_indices[c].begin(), chunk_indices[c].end(),
+                  indices_ptr + offset);
+        std::copy(chunk_distances[c].begin(), chunk_distances[c].end(),
+                  distances_ptr + offset);
+    }
+}
+
+template <class T>
+void HybridSearchCPU(size_t num_points,
+                     const T* const points,
+                     size_t num_queries,
+                     const T* const queries,
+                     const T radius,
+                     const T build_radius,
+                     const int max_knn,
+                     const size_t points_row_splits_size,
+                     const int64_t* const points_row_splits,
+                     const size_t queries_row_splits_size,
+                     const int64_t* const queries_row_splits,
+                     const int64_t* const hash_table_splits,
+                     size_t hash_table_cell_splits_size,
+                     const int64_t* const hash_table_cell_splits,
+                     const int64_t* const hash_table_index,
+                     const T* const hash_table_points,
+                     NeighborSearchAllocator<T>& output_allocator) {
+    const T inv_voxel_size = 1 / (2 * build_radius);
+
+    const size_t num_indices = num_queries * max_knn;
+    int64_t* indices_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices, -1);
+    T* distances_ptr;
+    output_allocator.AllocDistances(&distances_ptr, num_indices, 0);
+
+    const std::vector<QueryChunk> chunks =
+            MakeQueryChunks(queries_row_splits_size, queries_row_splits);
+    const int64_t num_chunks = chunks.size();
+
+#pragma omp parallel
+    {
+        std::vector<std::pair<T, int64_t>> neighbors;
+#pragma omp for schedule(dynamic, 1)
+        for (int64_t c = 0; c < num_chunks; ++c) {
+            const QueryChunk& chunk = chunks[c];
+            const size_t hash_table_size =
+                    hash_table_splits[chunk.batch_idx + 1] -
+                    hash_table_splits[chunk.batch_idx];
+            const size_t first_cell_idx = hash_table_splits[chunk.batch_idx];
+            for (int64_t q = chunk.begin; q < chunk.end; ++q) {
+                neighbors.clear();
+                ForEachNeighbor(Vec3<T>(queries + 3 * q), radius,
+                                inv_voxel_size, hash_table_size,
+                                first_cell_idx, hash_table_cell_splits,
+                                hash_table_index, hash_table_points,
+                                [&](int64_t idx, T dist) {
+                                    neighbors.emplace_back(dist, idx);
+                                });
+                const size_t count =
+                        std::min(neighbors.size(), size_t(max_knn));
+                std::partial_sort(neighbors.begin(),
+                                  neighbors.begin() + count, neighbors.end(),
+                                  CompareNeighbors<T>);
+                const int64_t offset = q * max_knn;
+                for (size_t k = 0; k < count; ++k) {
+                    indices_ptr[offset + k] = neighbors[k].second;
+                    distances_ptr[offset + k] = neighbors[k].first;
+                }
+            }
+        }
+    }
+}
+
+template void BuildSpatialHashTableCPU(
+        const size_t num_points,
+        const float* const points,
+        const float radius,
+        const size_t points_row_splits_size,
+        const int64_t* points_row_splits,
+        const int64_t* hash_table_splits,
+        const size_t hash_table_cell_splits_size,
+        int64_t* hash_table_cell_splits,
+        int64_t* hash_table_index,
+        float* hash_table_points);
+
+template void FixedRadiusSearchCPU(
+        int64_t* query_neighbors_row_splits,
+        size_t num_points,
+        const float* const points,
+        size_t num_queries,
+        const float* const queries,
+        const float radius,
+        const float build_radius,
+        const size_t points_row_splits_size,
+        const int64_t* const points_row_splits,
+        const size_t queries_row_splits_size,
+        const int64_t* const queries_row_splits,
+        const int64_t* const hash_table_splits,
+        size_t hash_table_cell_splits_size,
+        const int64_t* const hash_table_cell_splits,
+        const int64_t* const hash_table_index,
+        const float* const hash_table_points,
+        const bool sort,
+        NeighborSearchAllocator<float>& output_allocator);
+
+template void HybridSearchCPU(
+        size_t num_points,
+        const float* const points,
+        size_t num_queries,
+        const float* const queries,
+        const float radius,
+        const float build_radius,
+        const int max_knn,
+        const size_t points_row_splits_size,
+        const int64_t* const points_row_splits,
+        const size_t queries_row_splits_size,
+        const int64_t* const queries_row_splits,
+        const int64_t* const hash_table_splits,
+        size_t hash_table_cell_splits_size,
+        const int64_t* const hash_table_cell_splits,
+        const int64_t* const hash_table_index,
+        const float* const hash_table_points,
+        NeighborSearchAllocator<float>& output_allocator);
+
+template void BuildSpatialHashTableCPU(
+        const size_t num_points,
+        const double* const points,
+        const double radius,
+        const size_t points_row_splits_size,
+        const int64_t* points_row_splits,
+        const int64_t* hash_table_splits,
+        const size_t hash_table_cell_splits_size,
+        int64_t* hash_table_cell_splits,
+        int64_t* hash_table_index,
+        double* hash_table_points);
+
+template void FixedRadiusSearchCPU(
+        int64_t* query_neighbors_row_splits,
+        size_t num_points,
+        const double* const points,
+        size_t num_queries,
+        const double* const queries,
+        const double radius,
+        const double build_radius,
+        const size_t points_row_splits_size,
+        const int64_t* const points_row_splits,
+        const size_t queries_row_splits_size,
+        const int64_t* const queries_row_splits,
+        const int64_t* const hash_table_splits,
+        size_t hash_table_cell_splits_size,
+        const int64_t* const hash_table_cell_splits,
+        const int64_t* const hash_table_index,
+        const double* const hash_table_points,
+        const bool sort,
+        NeighborSearchAllocator<double>& output_allocator);
+
+template void HybridSearchCPU(
+        size_t num_points,
+        const double* const points,
+        size_t num_queries,
+        const double* const queries,
+        const double radius,
+        const double build_radius,
+        const int max_knn,
+        const size_t points_row_splits_size,
+        const int64_t* const points_row_splits,
+        const size_t queries_row_splits_size,
+        const int64_t* const queries_row_splits,
+        const int64_t* const hash_table_splits,
+        size_t hash_table_cell_splits_size,
+        const int64_t* const hash_table_cell_splits,
+        const int64_t* const hash_table_index,
+        const double* const hash_table_points,
+        NeighborSearchAllocator<double>& output_allocator);
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
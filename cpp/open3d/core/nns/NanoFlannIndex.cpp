@@ -29,6 +29,7 @@
 #include <tbb/blocked_range2d.h>
 #include <tbb/parallel_for.h>
 
+#include <limits>
 #include <nanoflann.hpp>
 
 #include "open3d/core/Dispatch.h"
@@ -39,6 +40,121 @@ namespace open3d {
 namespace core {
 namespace nns {
 
+namespace {
+
+/// Result set for nanoflann that keeps the k nearest neighbors within a
+/// squared radius as a max-heap in caller provided arrays. Insertion is
+/// O(log k), and the radius bound prunes the tree traversal from the start.
+template <class T>
+class BoundedKnnResultSet {
+public:
+    BoundedKnnResultSet(int64_t *indices,
+                        T *distances,
+                        int64_t capacity,
+                        T max_distance)
+        : indices_(indices),
+          distances_(distances),
+          capacity_(capacity),
+          max_distance_(max_distance) {}
+
+    size_t size() const { return count_; }
+
+    bool full() const { return count_ == capacity_; }
+
+    T worstDist() const { return full() ? distances_[0] : max_distance_; }
+
+    bool addPoint(T dist, int64_t index) {
+        if (count_ < capacity_) {
+            // Sift up.
+            int64_t i = count_++;
+            while (i > 0) {
+                int64_t parent = (i - 1) / 2;
+                if (distances_[parent] >= dist) break;
+                distances_[i] = distances_[parent];
+                indices_[i] = indices_[parent];
+                i = parent;
+            }
+            distances_[i] = dist;
+            indices_[i] = index;
+        } else if (dist < distances_[0]) {
+            SiftDown(0, count_, dist, index);
+        }
+        return true;
+    }
+
+    /// Sorts the neighbors by ascending distance if sort is true, and pads
+    /// the remaining entries with index -1 and distance 0.
+    void Finalize(bool sort) {
+        if (sort) {
+            for (int64_t end = count_ - 1; end > 0; --end) {
+                const T dist = distances_[end];
+                const int64_t index = indices_[end];
+                distances_[end] = distances_[0];
+                indices_[end] = indices_[0];
+                SiftDown(0, end, dist, index);
+            }
+        }
+        for (int64_t i = count_; i < capacity_; ++i) {
+            indices_[i] = -1;
+            distances_[i] = 0;
+        }
+    }
+
+private:
+    /// Places (dist, index) at position i of the heap of the given size.
+    void SiftDown(int64_t i, int64_t size, T dist, int64_t index) {
+        while (true) {
+            int64_t child = 2 * i + 1;
+            if (child >= size) break;
+            if (child + 1 < size && distances_[child + 1] > distances_[child]) {
+                ++child;
+            }
+            if (distances_[child] <= dist) break;
+            distances_[i] = distances_[child];
+            indices_[i] = indices_[child];
+            i = child;
+        }
+        distances_[i] = dist;
+        indices_[i] = index;
+    }
+
+    int64_t *indices_;
+    T *distances_;
+    int64_t capacity_;
+    int64_t count_ = 0;
+    T max_distance_;
+};
+
+/// Runs a bounded knn search for every query point in parallel chunks and
+/// writes the results into rows of the output arrays.
+template <class T>
+void BoundedKnnSearch(const NanoFlannIndexHolder<L2, T> *holder,
+                      const T *query_ptr,
+                      int64_t num_query_points,
+                      int dimension,
+                      int64_t knn,
+                      T max_distance,
+                      bool sort,
+                      int64_t chunk_size,
+                      int64_t *indices_ptr,
+                      T *distances_ptr) {
+    nanoflann::SearchParams params;
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_query_points, chunk_size),
+            [&](const tbb::blocked_range<int64_t> &r) {
+                for (int64_t i = r.begin(); i != r.end(); ++i) {
+                    BoundedKnnResultSet<T> result_set(indices_ptr + i * knn,
+                                                      distances_ptr + i * knn,
+                                                      knn, max_distance);
+                    holder->index_->findNeighbors(
+                            result_set, query_ptr + i * dimension, params);
+                    result_set.Finalize(sort);
+                }
+            });
+}
+
+}  // namespace
+
 NanoFlannIndex::NanoFlannIndex(){};
 
 NanoFlannIndex::NanoFlannIndex(const Tensor &dataset_points) {
@@ -69,6 +185,25 @@ bool NanoFlannIndex::SetTensorData(const Tensor &dataset_points) {
 
 std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
                                                     int knn) const {
+    if (knn <= 0) {
+        utility::LogError(
+                "[NanoFlannIndex::SearchKnn] knn should be larger than 0.");
+    }
+
+    // Only return as many neighbors as there are points in the dataset.
+    knn = std::min<int64_t>(knn, GetDatasetSize());
+    int64_t num_query_points = query_points.GetShape()[0];
+    Tensor indices = Tensor::Empty({num_query_points, knn}, Dtype::Int64);
+    Tensor distances = Tensor::Empty({num_query_points, knn}, GetDtype());
+    SearchKnn(query_points, knn, indices, distances);
+    return std::make_pair(indices, distances);
+};
+
+void NanoFlannIndex::SearchKnn(const Tensor &query_points,
+                               int knn,
+                               Tensor &indices,
+                               Tensor &distances,
+                               bool sort) const {
     // Check dtype.
     query_points.AssertDtype(GetDtype());
 
@@ -81,53 +216,20 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
     }
 
     int64_t num_query_points = query_points.GetShape()[0];
-    Dtype dtype = GetDtype();
+    AssertOutputTensors(indices, distances, num_query_points, knn);
 
-    Tensor indices;
-    Tensor distances;
+    Dtype dtype = GetDtype();
+    Tensor query_points_contiguous = query_points.Contiguous();
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        Tensor batch_indices =
-                Tensor::Full({num_query_points, knn}, -1, Dtype::Int64);
-        Tensor batch_distances =
-                Tensor::Full({num_query_points, knn}, -1, dtype);
-
         auto holder = static_cast<NanoFlannIndexHolder<L2, scalar_t> *>(
                 holder_.get());
-
-        // Parallel search.
-        tbb::parallel_for(
-                tbb::blocked_range<size_t>(0, num_query_points),
-                [&](const tbb::blocked_range<size_t> &r) {
-                    for (size_t i = r.begin(); i != r.end(); ++i) {
-                        auto single_indices = static_cast<int64_t *>(
-                                batch_indices[i].GetDataPtr());
-                        auto single_distances = static_cast<scalar_t *>(
-                                batch_distances[i].GetDataPtr());
-
-                        // search
-                        holder->index_->knnSearch(
-                                static_cast<scalar_t *>(
-                                        query_points[i].GetDataPtr()),
-                                static_cast<size_t>(knn), single_indices,
-                                single_distances);
-                    }
-                });
-        // Check if the number of neighbors are same.
-        Tensor check_valid =
-                batch_indices.Ge(0).To(Dtype::Int64).Sum({-1}, false);
-        int64_t num_neighbors = check_valid[0].Item<int64_t>();
-        if (check_valid.Ne(num_neighbors).Any()) {
-            utility::LogError(
-                    "[NanoFlannIndex::SearchKnn] The number of neighbors are "
-                    "different. Something went wrong.");
-        }
-        // Slice non-zero items.
-        indices = batch_indices.Slice(1, 0, num_neighbors)
-                          .View({num_query_points, num_neighbors});
-        distances = batch_distances.Slice(1, 0, num_neighbors)
-                            .View({num_query_points, num_neighbors});
+        BoundedKnnSearch(holder,
+                         query_points_contiguous.GetDataPtr<scalar_t>(),
+                         num_query_points, GetDimension(), knn,
+                         std::numeric_limits<scalar_t>::max(), sort,
+                         search_chunk_size, indices.GetDataPtr<int64_t>(),
+                         distances.GetDataPtr<scalar_t>());
     });
-    return std::make_pair(indices, distances);
 };
 
 std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
@@ -234,6 +336,25 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
 
 std::pair<Tensor, Tensor> NanoFlannIndex::SearchHybrid(
         const Tensor &query_points, double radius, int max_knn) const {
+    if (max_knn <= 0) {
+        utility::LogError(
+                "[NanoFlannIndex::SearchHybrid] max_knn should be larger than "
+                "0.");
+    }
+
+    int64_t num_query_points = query_points.GetShape()[0];
+    Tensor indices = Tensor::Empty({num_query_points, max_knn}, Dtype::Int64);
+    Tensor distances = Tensor::Empty({num_query_points, max_knn}, GetDtype());
+    SearchHybrid(query_points, radius, max_knn, indices, distances);
+    return std::make_pair(indices, distances);
+}
+
+void NanoFlannIndex::SearchHybrid(const Tensor &query_points,
+                                  double radius,
+                                  int max_knn,
+                                  Tensor &indices,
+                                  Tensor &distances,
+                                  bool sort) const {
     query_points.AssertDtype(GetDtype());
     query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
 
@@ -248,56 +369,70 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchHybrid(
                 "0.");
     }
 
-    double radius_squared = radius * radius;
     int64_t num_query_points = query_points.GetShape()[0];
-    Tensor indices, distances;
-    Dtype dtype = GetDtype();
+    AssertOutputTensors(indices, distances, num_query_points, max_knn);
 
+    Dtype dtype = GetDtype();
+    Tensor query_points_contiguous = query_points.Contiguous();
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        indices = Tensor::Empty({num_query_points, max_knn}, Dtype::Int64);
-        auto indices_ptr = indices.GetDataPtr<int64_t>();
-        distances = Tensor::Empty({num_query_points, max_knn}, dtype);
-        auto distances_ptr = distances.GetDataPtr<scalar_t>();
-
         auto holder = static_cast<NanoFlannIndexHolder<L2, scalar_t> *>(
                 holder_.get());
+        BoundedKnnSearch(holder,
+                         query_points_contiguous.GetDataPtr<scalar_t>(),
+                         num_query_points, GetDimension(), max_knn,
+                         static_cast<scalar_t>(radius * radius), sort,
+                         search_chunk_size, indices.GetDataPtr<int64_t>(),
+                         distances.GetDataPtr<scalar_t>());
+    });
+}
 
-        nanoflann::SearchParams params;
-
-        // Parallel search.
-        tbb::parallel_for(
-                tbb::blocked_range<size_t>(0, num_query_points),
-                [&](const tbb::blocked_range<size_t> &r) {
-                    std::vector<std::pair<int64_t, scalar_t>> ret_matches;
-                    for (size_t workload_idx = r.begin();
-                         workload_idx != r.end(); ++workload_idx) {
-                        int64_t result_idx = workload_idx * max_knn;
-
-                        size_t num_results = holder->index_->radiusSearch(
-                                static_cast<scalar_t *>(
-                                        query_points[workload_idx]
-                                                .GetDataPtr()),
-                                radius_squared, ret_matches, params);
-                        ret_matches.resize(num_results);
-
-                        int neighbour_idx = 0;
-                        for (auto it = ret_matches.begin();
-                             it < ret_matches.end() && neighbour_idx < max_knn;
-                             it++, neighbour_idx++) {
-                            indices_ptr[result_idx + neighbour_idx] = it->first;
-                            distances_ptr[result_idx + neighbour_idx] =
-                                    it->second;
-                        }
+template <class T>
+bool NanoFlannIndex::SearchNearest(const T *query_point,
+                                   T radius,
+                                   int64_t &index,
+                                   T &distance) const {
+    if (Dtype::FromType<T>() != GetDtype()) {
+        utility::LogError(
+                "[NanoFlannIndex::SearchNearest] query dtype {} does not match "
+                "dataset dtype {}.",
+                Dtype::FromType<T>().ToString(), GetDtype().ToString());
+    }
+    auto holder = static_cast<NanoFlannIndexHolder<L2, T> *>(holder_.get());
+    BoundedKnnResultSet<T> result_set(&index, &distance, 1, radius * radius);
+    holder->index_->findNeighbors(result_set, query_point,
+                                  nanoflann::SearchParams());
+    if (result_set.size() == 0) {
+        index = -1;
+        distance = 0;
+        return false;
+    }
+    return true;
+}
 
-                        while (neighbour_idx < max_knn) {
-                            indices_ptr[result_idx + neighbour_idx] = -1;
-                            distances_ptr[result_idx + neighbour_idx] = 0;
-                            neighbour_idx += 1;
-                        }
-                    }
-                });
-    });
-    return std::make_pair(indices, distances);
+template bool NanoFlannIndex::SearchNearest(const float *query_point,
+                                            float radius,
+                                            int64_t &index,
+                                            float &distance) const;
+template bool NanoFlannIndex::SearchNearest(const double *query_point,
+                                            double radius,
+                                            int64_t &index,
+                                            double &distance) const;
+
+void NanoFlannIndex::AssertOutputTensors(const Tensor &indices,
+                                         const Tensor &distances,
+                                         int64_t num_query_points,
+                                         int64_t knn) const {
+    indices.AssertDtype(Dtype::Int64);
+    indices.AssertShape({num_query_points, knn});
+    indices.AssertDevice(GetDevice());
+    distances.AssertDtype(GetDtype());
+    distances.AssertShape({num_query_points, knn});
+    distances.AssertDevice(GetDevice());
+    if (!indices.IsContiguous() || !distances.IsContiguous()) {
+        utility::LogError(
+                "[NanoFlannIndex] output indices and distances must be "
+                "contiguous.");
+    }
 }
 
 }  // namespace nns
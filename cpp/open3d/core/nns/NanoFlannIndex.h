@@ -161,7 +161,65 @@ public:
                                            double radius,
                                            int max_knn) const override;
 
+    /// Perform knn search into preallocated output Tensors.
+    ///
+    /// Query points are processed in parallel in chunks of
+    /// search_chunk_size and each query writes its neighbors straight into
+    /// its output row, so no memory is needed beyond the outputs.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}.
+    /// \param knn Number of neighbors to search per query point.
+    /// \param indices Output Tensor of shape {n, knn}, with dtype Int64. Must
+    /// be contiguous. Rows with less than knn neighbors are padded with -1.
+    /// \param distances Output Tensor of shape {n, knn}, with the dtype of
+    /// the dataset. Must be contiguous. The distances are squared L2 distances
+    /// and padded with 0.
+    /// \param sort If true, the neighbors of each query point are sorted by
+    /// distance. Unsorted output skips the final sorting of each row.
+    void SearchKnn(const Tensor &query_points,
+                   int knn,
+                   Tensor &indices,
+                   Tensor &distances,
+                   bool sort = true) const;
+
+    /// Perform hybrid search into preallocated output Tensors. Returns at most
+    /// max_knn nearest neighbors within radius for each query point. See
+    /// SearchKnn for the layout of the outputs.
+    void SearchHybrid(const Tensor &query_points,
+                      double radius,
+                      int max_knn,
+                      Tensor &indices,
+                      Tensor &distances,
+                      bool sort = true) const;
+
+    /// Find the nearest neighbor of a single query point within radius.
+    ///
+    /// This does not allocate or spawn tasks and may be called concurrently,
+    /// so kernels can run the search inside their own parallel loops.
+    ///
+    /// \param query_point Pointer to the GetDimension() coordinates of the
+    /// query point. T must match the dtype of the dataset.
+    /// \param radius Search radius.
+    /// \param index Output index of the nearest neighbor, -1 if none.
+    /// \param distance Output squared L2 distance to the nearest neighbor.
+    /// \return True if a neighbor within radius was found.
+    template <class T>
+    bool SearchNearest(const T *query_point,
+                       T radius,
+                       int64_t &index,
+                       T &distance) const;
+
+    /// Number of query points processed as one parallel work item.
+    const int64_t search_chunk_size = 1024;
+
 protected:
+    /// Checks dtype, shape, device and contiguity of the output Tensors of
+    /// the knn and hybrid searches.
+    void AssertOutputTensors(const Tensor &indices,
+                             const Tensor &distances,
+                             int64_t num_query_points,
+                             int64_t knn) const;
+
     // Tensor dataset_points_;
     std::unique_ptr<NanoFlannIndexHolderBase> holder_;
 };
@@ -73,7 +73,12 @@ bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
                 "Please recompile Open3D with BUILD_CUDA_MODULE=ON.");
 #endif
 
+    } else if (radius.has_value() && dataset_points_.GetShape()[1] == 3) {
+        fixed_radius_index_.reset(new nns::FixedRadiusIndex());
+        return fixed_radius_index_->SetTensorData(dataset_points_,
+                                                  radius.value());
     } else {
+        fixed_radius_index_.reset();
         return SetIndex();
     }
 }
@@ -127,7 +132,10 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
                     "set.");
         }
     } else {
-        if (nanoflann_index_) {
+        if (fixed_radius_index_) {
+            return fixed_radius_index_->SearchRadius(query_points, radius,
+                                                     sort);
+        } else if (nanoflann_index_) {
             return nanoflann_index_->SearchRadius(query_points, radius);
         } else {
             utility::LogError(
@@ -68,7 +68,9 @@ public:
     /// Set index for fixed-radius search.
     ///
     /// \param radius optional radius parameter. required for gpu fixed radius
-    /// index. \return Returns true if building index success, otherwise false.
+    /// index. If given for 3D CPU points, a spatial hash index is built and
+    /// FixedRadiusSearch accepts radii up to this value; otherwise a KDTree is
+    /// used. \return Returns true if building index success, otherwise false.
     bool FixedRadiusIndex(utility::optional<double> radius = {});
 
     /// Set index for hybrid search.
@@ -0,0 +1,535 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Deepest octree whose Morton codes fit into 64 bits.
+constexpr size_t kMaxLinearOctreeDepth = 21;
+
+constexpr int kRadixBits = 8;
+constexpr size_t kRadixBuckets = size_t(1) << kRadixBits;
+constexpr size_t kRadixBlockSize = size_t(1) << 16;
+
+/// Stable LSD radix sort of (code, index) pairs on the lowest num_bits bits
+/// of the codes. Each pass counts and scatters fixed blocks in parallel, so
+/// the result does not depend on the number of threads.
+void RadixSortByCode(std::vector<uint64_t>& codes,
+                     std::vector<size_t>& indices,
+                     size_t num_bits) {
+    const size_t n = codes.size();
+    const size_t num_blocks = (n + kRadixBlockSize - 1) / kRadixBlockSize;
+    std::vector<uint64_t> codes_tmp(n);
+    std::vector<size_t> indices_tmp(n);
+    // offsets[block * kRadixBuckets + digit]
+    std::vector<size_t> offsets(num_blocks * kRadixBuckets);
+
+    for (size_t shift = 0; shift < num_bits; shift += kRadixBits) {
+        auto digit = [shift](uint64_t code) {
+            return size_t((code >> shift) & (kRadixBuckets - 1));
+        };
+        std::fill(offsets.begin(), offsets.end(), 0);
+        tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, num_blocks),
+                [&](const tbb::blocked_range<size_t>& range) {
+                    for (size_t b = range.begin(); b < range.end(); ++b) {
+                        size_t* count = offsets.data() + b * kRadixBuckets;
+                        size_t end = std::min(n, (b + 1) * kRadixBlockSize);
+                        for (size_t i = b * kRadixBlockSize; i < end; ++i) {
+                            count[digit(codes[i])]++;
+                        }
+                    }
+                });
+
+        // Exclusive prefix sum in (digit, block) order. A pass where all
+        // codes share the same digit leaves the order unchanged.
+        size_t sum = 0;
+        bool is_sorted = false;
+        for (size_t d = 0; d < kRadixBuckets; ++d) {
+            size_t digit_sum = 0;
+            for (size_t b = 0; b < num_blocks; ++b) {
+                size_t& offset = offsets[b * kRadixBuckets + d];
+                size_t count = offset;
+                offset = sum + digit_sum;
+                digit_sum += count;
+            }
+            is_sorted = is_sorted || digit_sum == n;
+            sum += digit_sum;
+        }
+        if (is_sorted) {
+            continue;
+        }
+
+        tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, num_blocks),
+                [&](const tbb::blocked_range<size_t>& range) {
+                    for (size_t b = range.begin(); b < range.end(); ++b) {
+                        size_t* offset = offsets.data() + b * kRadixBuckets;
+                        size_t end = std::min(n, (b + 1) * kRadixBlockSize);
+                        for (size_t i = b * kRadixBlockSize; i < end; ++i) {
+                            size_t pos = offset[digit(codes[i])]++;
+                            codes_tmp[pos] = codes[i];
+                            indices_tmp[pos] = indices[i];
+                        }
+                    }
+                });
+        codes.swap(codes_tmp);
+        indices.swap(indices_tmp);
+    }
+}
+
+void TraverseRecurse(
+        const LinearOctree& octree,
+        size_t node_index,
+        const OctreeNodeInfo& node_info,
+        const std::function<bool(size_t, const OctreeNodeInfo&)>& f) {
+    if (f(node_index, node_info)) return;
+
+    const LinearOctreeNode& node = octree.nodes_[node_index];
+    double child_size = node_info.size_ / 2.0;
+    for (size_t c = node.child_begin_; c < node.child_end_; ++c) {
+        size_t child_index = size_t(octree.nodes_[c].code_ & 7);
+        size_t x_index = child_index % 2;
+        size_t y_index = (child_index / 2) % 2;
+        size_t z_index = (child_index / 4) % 2;
+        Eigen::Vector3d child_node_origin =
+                node_info.origin_ + Eigen::Vector3d(double(x_index),
+                                                    double(y_index),
+                                                    double(z_index)) *
+                                            child_size;
+        TraverseRecurse(octree, c,
+                        OctreeNodeInfo(child_node_origin, child_size,
+                                       node_info.depth_ + 1, child_index),
+                        f);
+    }
+}
+
+}  // unnamed namespace
+
+LinearOctree& LinearOctree::Clear() {
+    nodes_.clear();
+    level_offsets_.clear();
+    colors_.clear();
+    point_indices_.clear();
+    return *this;
+}
+
+bool LinearOctree::IsEmpty() const { return nodes_.empty(); }
+
+bool LinearOctree::ComputeLeafCode(const Eigen::Vector3d& point,
+                                   uint64_t& code) const {
+    Eigen::Vector3d origin = origin_;
+    double size = size_;
+    if (!Octree::IsPointInBound(point, origin, size)) {
+        return false;
+    }
+    // Same arithmetic as Octree::InsertPoint, so that points on the
+    // boundary of two nodes end up in the same leaf in both octrees.
+    code = 0;
+    for (size_t depth = 0; depth < max_depth_; ++depth) {
+        size /= 2.0;
+        size_t x_index = point(0) < origin(0) + size ? 0 : 1;
+        size_t y_index = point(1) < origin(1) + size ? 0 : 1;
+        size_t z_index = point(2) < origin(2) + size ? 0 : 1;
+        origin += Eigen::Vector3d(x_index * size, y_index * size,
+                                  z_index * size);
+        if (!Octree::IsPointInBound(point, origin, size)) {
+            return false;
+        }
+        code = (code << 3) | (x_index + y_index * 2 + z_index * 4);
+    }
+    return true;
+}
+
+void LinearOctree::BuildFromLeaves(
+        const std::vector<LinearOctreeNode>& leaves,
+        const std::vector<Eigen::Vector3d>& leaf_colors) {
+    nodes_.clear();
+    colors_.clear();
+    level_offsets_.assign(max_depth_ + 2, 0);
+    if (leaves.empty()) {
+        return;
+    }
+
+    // Parents of a sorted level are runs of equal code >> 3, so every level
+    // is sorted as well and children ranges are contiguous.
+    std::vector<std::vector<LinearOctreeNode>> levels(max_depth_ + 1);
+    std::vector<std::vector<Eigen::Vector3d>> level_colors(max_depth_ + 1);
+    levels[max_depth_] = leaves;
+    level_colors[max_depth_] = leaf_colors;
+    for (size_t depth = max_depth_; depth > 0; --depth) {
+        const std::vector<LinearOctreeNode>& children = levels[depth];
+        const std::vector<Eigen::Vector3d>& child_colors =
+                level_colors[depth];
+        std::vector<LinearOctreeNode>& parents = levels[depth - 1];
+        std::vector<Eigen::Vector3d>& parent_colors = level_colors[depth - 1];
+        for (size_t i = 0; i < children.size(); ++i) {
+            uint64_t parent_code = children[i].code_ >> 3;
+            if (parents.empty() || parents.back().code_ != parent_code) {
+                LinearOctreeNode parent;
+                parent.code_ = parent_code;
+                parent.child_begin_ = i;
+                parent.point_begin_ = children[i].point_begin_;
+                parents.push_back(parent);
+                parent_colors.push_back(Eigen::Vector3d::Zero());
+            }
+            parents.back().child_end_ = i + 1;
+            parents.back().point_end_ = children[i].point_end_;
+            parent_colors.back() += child_colors[i];
+        }
+        for (size_t i = 0; i < parents.size(); ++i) {
+            parent_colors[i] /= double(parents[i].child_end_ -
+                                       parents[i].child_begin_);
+        }
+    }
+
+    for (size_t depth = 0; depth <= max_depth_; ++depth) {
+        level_offsets_[depth + 1] =
+                level_offsets_[depth] + levels[depth].size();
+    }
+    nodes_.reserve(level_offsets_.back());
+    colors_.reserve(level_offsets_.back());
+    for (size_t depth = 0; depth <= max_depth_; ++depth) {
+        for (LinearOctreeNode node : levels[depth]) {
+            if (depth < max_depth_) {
+                node.child_begin_ += level_offsets_[depth + 1];
+                node.child_end_ += level_offsets_[depth + 1];
+            }
+            nodes_.push_back(node);
+        }
+        colors_.insert(colors_.end(), level_colors[depth].begin(),
+                       level_colors[depth].end());
+    }
+}
+
+void LinearOctree::BuildFromPoints(const std::vector<Eigen::Vector3d>& points,
+                                   const std::vector<Eigen::Vector3d>& colors) {
+    if (max_depth_ > kMaxLinearOctreeDepth) {
+        utility::LogError("max_depth {} exceeds the maximum of {}.",
+                          max_depth_, kMaxLinearOctreeDepth);
+    }
+
+    const size_t n = points.size();
+    std::vector<uint64_t> point_codes(n);
+    std::vector<uint8_t> in_bound(n);
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, n),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i < range.end(); ++i) {
+                    in_bound[i] = ComputeLeafCode(points[i], point_codes[i]);
+                }
+            });
+
+    // Points out of bound are ignored, as in Octree::InsertPoint.
+    std::vector<uint64_t> codes;
+    point_indices_.clear();
+    codes.reserve(n);
+    point_indices_.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        if (in_bound[i]) {
+            codes.push_back(point_codes[i]);
+            point_indices_.push_back(i);
+        }
+    }
+    RadixSortByCode(codes, point_indices_, 3 * max_depth_);
+
+    // Since the sort is stable, the last point of a leaf is the one inserted
+    // last by Octree::InsertPoint and determines the leaf color.
+    std::vector<LinearOctreeNode> leaves;
+    std::vector<Eigen::Vector3d> leaf_colors;
+    for (size_t begin = 0, end = 0; begin < codes.size(); begin = end) {
+        while (end < codes.size() && codes[end] == codes[begin]) {
+            end++;
+        }
+        LinearOctreeNode leaf;
+        leaf.code_ = codes[begin];
+        leaf.point_begin_ = begin;
+        leaf.point_end_ = end;
+        leaves.push_back(leaf);
+        leaf_colors.push_back(colors.empty() ? Eigen::Vector3d::Zero()
+                                             : colors[point_indices_[end - 1]]);
+    }
+    BuildFromLeaves(leaves, leaf_colors);
+}
+
+void LinearOctree::ConvertFromPointCloud(const PointCloud& point_cloud,
+                                         double size_expand) {
+    if (size_expand > 1 || size_expand < 0) {
+        utility::LogError("size_expand shall be between 0 and 1");
+    }
+
+    // Set bounds as Octree::ConvertFromPointCloud does
+    Clear();
+    Eigen::Array3d min_bound = point_cloud.GetMinBound();
+    Eigen::Array3d max_bound = point_cloud.GetMaxBound();
+    Eigen::Array3d center = (min_bound + max_bound) / 2;
+    Eigen::Array3d half_sizes = center - min_bound;
+    double max_half_size = half_sizes.maxCoeff();
+    origin_ = min_bound.min(center - max_half_size);
+    if (max_half_size == 0) {
+        size_ = size_expand;
+    } else {
+        size_ = max_half_size * 2 * (1 + size_expand);
+    }
+
+    BuildFromPoints(point_cloud.points_,
+                    point_cloud.HasColors() ? point_cloud.colors_
+                                            : std::vector<Eigen::Vector3d>());
+}
+
+void LinearOctree::CreateFromVoxelGrid(const VoxelGrid& voxel_grid) {
+    Clear();
+    origin_ = voxel_grid.origin_;
+    size_ = (voxel_grid.GetMaxBound() - origin_).maxCoeff();
+    double half_voxel_size = voxel_grid.voxel_size_ / 2.;
+    std::vector<Eigen::Vector3d> mid_points;
+    std::vector<Eigen::Vector3d> colors;
+    mid_points.reserve(voxel_grid.voxels_.size());
+    colors.reserve(voxel_grid.voxels_.size());
+    for (const auto& voxel_iter : voxel_grid.voxels_) {
+        const Voxel& voxel = voxel_iter.second;
+        mid_points.push_back(half_voxel_size + origin_.array() +
+                             voxel.grid_index_.array().cast<double>() *
+                                     voxel_grid.voxel_size_);
+        colors.push_back(voxel.color_);
+    }
+    BuildFromPoints(mid_points, colors);
+    point_indices_.clear();
+}
+
+void LinearOctree::CreateFromOctree(const Octree& octree) {
+    if (octree.max_depth_ > kMaxLinearOctreeDepth) {
+        utility::LogError("max_depth {} exceeds the maximum of {}.",
+                          octree.max_depth_, kMaxLinearOctreeDepth);
+    }
+    Clear();
+    origin_ = octree.origin_;
+    size_ = octree.size_;
+    max_depth_ = octree.max_depth_;
+
+    // Octree::Traverse visits children in child index order, i.e. leaves in
+    // Morton order, so no sorting is needed.
+    std::vector<uint64_t> path_codes(max_depth_ + 1, 0);
+    std::vector<LinearOctreeNode> leaves;
+    std::vector<Eigen::Vector3d> leaf_colors;
+    size_t num_points = 0;
+    bool has_point_indices = true;
+    auto f_collect_leaves =
+            [&](const std::shared_ptr<OctreeNode>& node,
+                const std::shared_ptr<OctreeNodeInfo>& node_info) -> bool {
+        size_t depth = node_info->depth_;
+        uint64_t code = depth == 0 ? 0
+                                   : (path_codes[depth - 1] << 3) |
+                                             node_info->child_index_;
+        path_codes[depth] = code;
+        auto leaf_node = std::dynamic_pointer_cast<OctreeLeafNode>(node);
+        if (leaf_node == nullptr) {
+            return false;
+        }
+        if (depth != max_depth_) {
+            utility::LogError("Leaf node at depth {} instead of max_depth {}.",
+                              depth, max_depth_);
+        }
+        LinearOctreeNode leaf;
+        leaf.code_ = code;
+        leaf.point_begin_ = num_points;
+        if (auto point_leaf_node =
+                    std::dynamic_pointer_cast<OctreePointColorLeafNode>(
+                            leaf_node)) {
+            point_indices_.insert(point_indices_.end(),
+                                  point_leaf_node->indices_.begin(),
+                                  point_leaf_node->indices_.end());
+            num_points += point_leaf_node->indices_.size();
+        } else {
+            has_point_indices = false;
+            num_points++;
+        }
+        leaf.point_end_ = num_points;
+        leaves.push_back(leaf);
+        auto color_leaf_node =
+                std::dynamic_pointer_cast<OctreeColorLeafNode>(leaf_node);
+        leaf_colors.push_back(color_leaf_node != nullptr
+                                      ? color_leaf_node->color_
+                                      : Eigen::Vector3d::Zero());
+        return false;
+    };
+    octree.Traverse(f_collect_leaves);
+    if (!has_point_indices) {
+        point_indices_.clear();
+    }
+    BuildFromLeaves(leaves, leaf_colors);
+}
+
+std::shared_ptr<Octree> LinearOctree::ToOctree() const {
+    auto octree = std::make_shared<Octree>(max_depth_, origin_, size_);
+    if (IsEmpty()) {
+        return octree;
+    }
+
+    // Children come after their parents in nodes_, so nodes are created
+    // back to front.
+    const bool has_point_indices = HasPointIndices();
+    const size_t leaf_begin = level_offsets_[max_depth_];
+    std::vector<std::shared_ptr<OctreeNode>> octree_nodes(nodes_.size());
+    for (size_t i = nodes_.size(); i-- > 0;) {
+        const LinearOctreeNode& node = nodes_[i];
+        auto indices_begin = point_indices_.begin() + node.point_begin_;
+        auto indices_end = point_indices_.begin() + node.point_end_;
+        if (i >= leaf_begin) {
+            if (has_point_indices) {
+                auto leaf_node = std::make_shared<OctreePointColorLeafNode>();
+                leaf_node->color_ = colors_[i];
+                leaf_node->indices_.assign(indices_begin, indices_end);
+                octree_nodes[i] = leaf_node;
+            } else {
+                auto leaf_node = std::make_shared<OctreeColorLeafNode>();
+                leaf_node->color_ = colors_[i];
+                octree_nodes[i] = leaf_node;
+            }
+        } else {
+            std::shared_ptr<OctreeInternalNode> internal_node;
+            if (has_point_indices) {
+                auto point_node = std::make_shared<OctreeInternalPointNode>();
+                // Octree::InsertPoint appends indices in insertion order
+                point_node->indices_.assign(indices_begin, indices_end);
+                std::sort(point_node->indices_.begin(),
+                          point_node->indices_.end());
+                internal_node = point_node;
+            } else {
+                internal_node = std::make_shared<OctreeInternalNode>();
+            }
+            for (size_t c = node.child_begin_; c < node.child_end_; ++c) {
+                internal_node->children_[nodes_[c].code_ & 7] =
+                        octree_nodes[c];
+            }
+            octree_nodes[i] = internal_node;
+        }
+    }
+    octree->root_node_ = octree_nodes[0];
+    return octree;
+}
+
+std::shared_ptr<VoxelGrid> LinearOctree::ToVoxelGrid() const {
+    auto voxel_grid = std::make_shared<VoxelGrid>();
+    voxel_grid->origin_ = origin_;
+    voxel_grid->voxel_size_ = size_ / double(uint64_t(1) << max_depth_);
+    if (IsEmpty()) {
+        return voxel_grid;
+    }
+    for (size_t i = level_offsets_[max_depth_]; i < nodes_.size(); ++i) {
+        // De-interleave the Morton code into the leaf coordinates
+        const uint64_t code = nodes_[i].code_;
+        Eigen::Vector3i grid_index(0, 0, 0);
+        for (size_t depth = 0; depth < max_depth_; ++depth) {
+            for (int axis = 0; axis < 3; ++axis) {
+                grid_index(axis) |= int((code >> (3 * depth + axis)) & 1)
+                                    << depth;
+            }
+        }
+        voxel_grid->AddVoxel(Voxel(grid_index, colors_[i]));
+    }
+    return voxel_grid;
+}
+
+std::pair<size_t, size_t> LinearOctree::GetLevelRange(size_t depth) const {
+    if (depth > max_depth_) {
+        utility::LogError("depth {} exceeds max_depth {}.", depth, max_depth_);
+    }
+    if (IsEmpty()) {
+        return std::make_pair(size_t(0), size_t(0));
+    }
+    return std::make_pair(level_offsets_[depth], level_offsets_[depth + 1]);
+}
+
+size_t LinearOctree::GetNodeDepth(size_t node_index) const {
+    if (node_index >= nodes_.size()) {
+        utility::LogError("node_index {} out of range [0, {}).", node_index,
+                          nodes_.size());
+    }
+    return std::upper_bound(level_offsets_.begin(), level_offsets_.end(),
+                            node_index) -
+           level_offsets_.begin() - 1;
+}
+
+OctreeNodeInfo LinearOctree::GetNodeInfo(size_t node_index) const {
+    const size_t depth = GetNodeDepth(node_index);
+    const uint64_t code = nodes_[node_index].code_;
+    // Walk down from the root with the arithmetic of Traverse
+    Eigen::Vector3d origin = origin_;
+    double size = size_;
+    size_t child_index = 0;
+    for (size_t d = 1; d <= depth; ++d) {
+        child_index = size_t((code >> (3 * (depth - d))) & 7);
+        size /= 2.0;
+        origin += Eigen::Vector3d(double(child_index % 2),
+                                  double((child_index / 2) % 2),
+                                  double((child_index / 4) % 2)) *
+                  size;
+    }
+    return OctreeNodeInfo(origin, size, depth, child_index);
+}
+
+void LinearOctree::Traverse(
+        const std::function<bool(size_t, const OctreeNodeInfo&)>& f) const {
+    if (IsEmpty()) {
+        return;
+    }
+    // The root's child index is 0, though it isn't a child node
+    TraverseRecurse(*this, 0, OctreeNodeInfo(origin_, size_, 0, 0), f);
+}
+
+std::pair<int64_t, OctreeNodeInfo> LinearOctree::LocateLeafNode(
+        const Eigen::Vector3d& point) const {
+    uint64_t code;
+    if (IsEmpty() || !ComputeLeafCode(point, code)) {
+        return std::make_pair(int64_t(-1), OctreeNodeInfo());
+    }
+    auto leaf_begin = nodes_.begin() + level_offsets_[max_depth_];
+    auto it = std::lower_bound(leaf_begin, nodes_.end(), code,
+                               [](const LinearOctreeNode& node, uint64_t c) {
+                                   return node.code_ < c;
+                               });
+    if (it == nodes_.end() || it->code_ != code) {
+        return std::make_pair(int64_t(-1), OctreeNodeInfo());
+    }
+    size_t node_index = size_t(it - nodes_.begin());
+    return std::make_pair(int64_t(node_index), GetNodeInfo(node_index));
+}
+
+}  // namespace geometry
+}  // namespace open3d
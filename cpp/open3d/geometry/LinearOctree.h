@@ -0,0 +1,199 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "open3d/geometry/Octree.h"
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+class VoxelGrid;
+
+/// \class LinearOctreeNode
+///
+/// \brief Node of a LinearOctree.
+class LinearOctreeNode {
+public:
+    /// Morton code of the node at its own depth. The bits of the node's
+    /// integer coordinates at that depth are interleaved with x as the lowest
+    /// bit, so the lowest 3 bits are the node's child index.
+    uint64_t code_ = 0;
+    /// The children of the node are nodes_[child_begin_, child_end_). Leaf
+    /// nodes have an empty range.
+    size_t child_begin_ = 0;
+    size_t child_end_ = 0;
+    /// The points below the node are point_indices_[point_begin_,
+    /// point_end_).
+    size_t point_begin_ = 0;
+    size_t point_end_ = 0;
+};
+
+/// \class LinearOctree
+///
+/// \brief Pointer-free octree stored as sorted Morton codes.
+///
+/// Nodes are kept in one contiguous array, level by level from the root, and
+/// sorted by Morton code within a level. Hence the nodes of one depth form a
+/// contiguous range (see GetLevelRange), the children of a node are
+/// contiguous in the next level and the points below any node are a
+/// contiguous range of point_indices_.
+///
+/// Points are assigned to nodes with the same arithmetic as
+/// Octree::InsertPoint, and Traverse visits nodes in the same order as
+/// Octree::Traverse, so the two representations can be converted into each
+/// other without changing the tree. The octree is built in one pass and is
+/// immutable afterwards.
+class LinearOctree {
+public:
+    /// \brief Default Constructor.
+    LinearOctree() : origin_(0, 0, 0), size_(0), max_depth_(0) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the octree.
+    LinearOctree(size_t max_depth)
+        : origin_(0, 0, 0), size_(0), max_depth_(max_depth) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the octree.
+    /// \param origin Sets the global min bound of the octree.
+    /// \param size Sets the outer bounding box edge size for the whole octree.
+    LinearOctree(size_t max_depth, const Eigen::Vector3d& origin, double size)
+        : origin_(origin), size_(size), max_depth_(max_depth) {}
+
+public:
+    /// Removes all nodes, keeping origin_, size_ and max_depth_.
+    LinearOctree& Clear();
+    bool IsEmpty() const;
+
+    /// \brief Build the octree from a point cloud.
+    ///
+    /// Bounds are computed as in Octree::ConvertFromPointCloud. Morton codes
+    /// are computed in parallel and sorted with a parallel radix sort.
+    ///
+    /// \param point_cloud Input point cloud.
+    /// \param size_expand A small expansion size such that the octree is
+    /// slightly bigger than the original point cloud bounds to accomodate all
+    /// points.
+    void ConvertFromPointCloud(const PointCloud& point_cloud,
+                               double size_expand = 0.01);
+
+    /// \brief Build the octree from the voxel centers of a voxel grid, as
+    /// Octree::CreateFromVoxelGrid. The result has no point indices.
+    void CreateFromVoxelGrid(const VoxelGrid& voxel_grid);
+
+    /// \brief Build the octree from a pointer-based Octree. Point indices are
+    /// kept if the leaves are OctreePointColorLeafNode.
+    void CreateFromOctree(const Octree& octree);
+
+    /// Convert to a pointer-based Octree. Point node types are used when the
+    /// octree has point indices, color node types otherwise.
+    std::shared_ptr<Octree> ToOctree() const;
+
+    /// Convert to VoxelGrid with one voxel per leaf.
+    std::shared_ptr<VoxelGrid> ToVoxelGrid() const;
+
+    /// Returns true if the leaves carry the indices of their points.
+    bool HasPointIndices() const { return !point_indices_.empty(); }
+
+    /// \brief Returns the range [begin, end) of nodes_ holding the nodes of
+    /// the given depth.
+    std::pair<size_t, size_t> GetLevelRange(size_t depth) const;
+
+    /// Returns the depth of nodes_[node_index].
+    size_t GetNodeDepth(size_t node_index) const;
+
+    /// Returns origin, size, depth and child index of nodes_[node_index].
+    OctreeNodeInfo GetNodeInfo(size_t node_index) const;
+
+    /// \brief DFS traversal from the root, with callback function called for
+    /// each node.
+    ///
+    /// \param f Callback which fires with the index into nodes_ and the info
+    /// of each traversed node. If f returns true, children of this node will
+    /// not be traversed.
+    void Traverse(
+            const std::function<bool(size_t, const OctreeNodeInfo&)>& f) const;
+
+    /// \brief Returns the index into nodes_ and the info of the leaf node
+    /// where the query point resides, or -1 if there is no such leaf.
+    ///
+    /// \param point Coordinates of the point.
+    std::pair<int64_t, OctreeNodeInfo> LocateLeafNode(
+            const Eigen::Vector3d& point) const;
+
+public:
+    /// Global min bound (include). A point is within bound iff
+    /// origin_ <= point < origin_ + size_.
+    Eigen::Vector3d origin_;
+
+    /// Outer bounding box edge size for the whole octree.
+    double size_;
+
+    /// Max depth of octree, at most 21 so that codes fit into 64 bits.
+    size_t max_depth_;
+
+    /// All nodes, sorted by depth and by Morton code within a depth.
+    std::vector<LinearOctreeNode> nodes_;
+
+    /// nodes_[level_offsets_[d], level_offsets_[d + 1]) are the nodes of
+    /// depth d.
+    std::vector<size_t> level_offsets_;
+
+    /// Color of each node. A leaf has the color of the last point inserted
+    /// into it, like OctreeColorLeafNode; an internal node has the mean
+    /// color of its children, which gives a level of detail color per depth.
+    std::vector<Eigen::Vector3d> colors_;
+
+    /// Indices of the input points, sorted by leaf. Empty if the octree was
+    /// built without points.
+    std::vector<size_t> point_indices_;
+
+private:
+    /// Returns the Morton code of the leaf containing point, or false if the
+    /// point is out of bound.
+    bool ComputeLeafCode(const Eigen::Vector3d& point, uint64_t& code) const;
+
+    /// Builds nodes_ and colors_ bottom-up from leaves sorted by code.
+    void BuildFromLeaves(const std::vector<LinearOctreeNode>& leaves,
+                         const std::vector<Eigen::Vector3d>& leaf_colors);
+
+    /// Sorts points by leaf code and builds the octree from them.
+    void BuildFromPoints(const std::vector<Eigen::Vector3d>& points,
+                         const std::vector<Eigen::Vector3d>& colors);
+};
+
+}  // namespace geometry
+}  // namespace open3d
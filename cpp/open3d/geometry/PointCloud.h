@@ -290,6 +290,11 @@ public:
     /// Returns a list of point labels, -1 indicates noise according to
     /// the algorithm.
     ///
+    /// Runs in parallel on a uniform grid and does not store neighbor lists.
+    /// Clusters are numbered in the order of their lowest core point index,
+    /// and border points reachable from several clusters take the lowest
+    /// label, as in sequential DBSCAN.
+    ///
     /// \param eps Density parameter that is used to find neighbouring points.
     /// \param min_points Minimum number of points to form a cluster.
     /// \param print_progress If `true` the progress is visualized in the
@@ -300,17 +305,46 @@ public:
 
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
     ///
+    /// Hypotheses are evaluated in parallel, first on a random subset of the
+    /// points, and the search stops early once \p probability is reached.
+    ///
     /// \param distance_threshold Max distance a point can be from the plane
     /// model, and still be considered an inlier.
     /// \param ransac_n Number of initial points to be considered inliers in
     /// each iteration.
-    /// \param num_iterations Number of iterations.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// The number of iterations is reduced to the number of hypotheses needed
+    /// to reach it given the best inlier ratio so far.
     /// \return Returns the plane model ax + by + cz + d = 0 and the indices of
     /// the plane inliers.
     std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlane(
             const double distance_threshold = 0.01,
             const int ransac_n = 3,
-            const int num_iterations = 100) const;
+            const int num_iterations = 100,
+            const double probability = 0.99999999) const;
+
+    /// \brief Segment multiple planes with RANSAC, removing the inliers of
+    /// each plane before searching for the next one.
+    ///
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations per plane.
+    /// \param max_num_planes Maximum number of planes to segment.
+    /// \param min_num_inliers Stop when the next plane has fewer inliers.
+    /// \param probability Expected probability of finding the optimal plane,
+    /// see SegmentPlane().
+    /// \return Returns the plane models and their inlier indices, in the
+    /// order in which they were segmented.
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+    SegmentPlanes(const double distance_threshold = 0.01,
+                  const int ransac_n = 3,
+                  const int num_iterations = 100,
+                  const int max_num_planes = 10,
+                  const size_t min_num_inliers = 100,
+                  const double probability = 0.99999999) const;
 
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
@@ -24,89 +24,390 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Dense>
-#include <unordered_set>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <unordered_map>
 
-#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Uniform grid over the points, with the points sorted by cell and the cells
+/// sorted by (x, y, z). The cell size is chosen such that any two points in a
+/// cell are closer than eps to each other.
+class DBSCANGrid {
+public:
+    DBSCANGrid(const std::vector<Eigen::Vector3d> &points, double eps) {
+        // KDTreeFlann::SearchRadius compares squared distances strictly
+        // against a float squared radius. Do the same so that the labels
+        // match the kd-tree based implementation.
+        eps2_ = double(float(eps * eps));
+        if (!(eps2_ > 0) || !std::isfinite(eps2_)) {
+            utility::LogError("[ClusterDBSCAN] eps {} is out of range.", eps);
+        }
+        cell_size_ = std::sqrt(eps2_ / 3.0) * (1.0 - 1e-6);
+        cell_range_ = int(std::ceil(std::sqrt(eps2_) / cell_size_));
+
+        const int64_t num_points = int64_t(points.size());
+        Eigen::Vector3d min_bound =
+                points.empty() ? Eigen::Vector3d::Zero() : points[0];
+        Eigen::Vector3d max_bound = min_bound;
+        for (const auto &point : points) {
+            min_bound = min_bound.cwiseMin(point);
+            max_bound = max_bound.cwiseMax(point);
+        }
+        // Cell coordinates, offset by the neighbor range, must fit in int.
+        const double max_cell = (max_bound - min_bound).maxCoeff() / cell_size_;
+        if (!(max_cell < std::numeric_limits<int>::max() / 2)) {
+            utility::LogError(
+                    "[ClusterDBSCAN] eps {} is too small for the extent {} of "
+                    "the point cloud.",
+                    eps, (max_bound - min_bound).maxCoeff());
+        }
+
+        struct CellPoint {
+            int x, y, z, index;
+            bool operator<(const CellPoint &other) const {
+                return std::tie(x, y, z, index) <
+                       std::tie(other.x, other.y, other.z, other.index);
+            }
+        };
+        std::vector<CellPoint> cell_points(num_points);
+#pragma omp parallel for schedule(static)
+        for (int64_t idx = 0; idx < num_points; ++idx) {
+            Eigen::Vector3i cell = ((points[idx] - min_bound) / cell_size_)
+                                           .array()
+                                           .floor()
+                                           .cast<int>();
+            cell_points[idx] = {cell(0), cell(1), cell(2), int(idx)};
+        }
+        tbb::parallel_sort(cell_points.begin(), cell_points.end());
+
+        sorted_indices_.resize(num_points);
+        sorted_points_.resize(num_points);
+#pragma omp parallel for schedule(static)
+        for (int64_t k = 0; k < num_points; ++k) {
+            sorted_indices_[k] = cell_points[k].index;
+            sorted_points_[k] = points[cell_points[k].index];
+        }
+
+        // Cells, and columns of cells sharing (x, y).
+        for (int64_t k = 0; k < num_points; ++k) {
+            const CellPoint &cp = cell_points[k];
+            const Eigen::Vector3i cell(cp.x, cp.y, cp.z);
+            if (cells_.empty() || cells_.back() != cell) {
+                if (cells_.empty() || cells_.back()(0) != cp.x ||
+                    cells_.back()(1) != cp.y) {
+                    column_ids_[ColumnKey(cp.x, cp.y)] =
+                            int(column_offsets_.size());
+                    column_offsets_.push_back(int(cells_.size()));
+                }
+                cells_.push_back(cell);
+                cell_offsets_.push_back(k);
+            }
+        }
+        cell_offsets_.push_back(num_points);
+        column_offsets_.push_back(int(cells_.size()));
+    }
+
+    int NumCells() const { return int(cells_.size()); }
+    int64_t CellBegin(int c) const { return cell_offsets_[c]; }
+    int64_t CellEnd(int c) const { return cell_offsets_[c + 1]; }
+    int64_t CellSize(int c) const { return CellEnd(c) - CellBegin(c); }
+    /// Original index of the k-th point in cell order.
+    int PointIndex(int64_t k) const { return sorted_indices_[k]; }
+
+    bool IsNeighbor(int64_t k, int64_t l) const {
+        const Eigen::Vector3d &p = sorted_points_[k];
+        const Eigen::Vector3d &q = sorted_points_[l];
+        const double dx = p(0) - q(0);
+        const double dy = p(1) - q(1);
+        const double dz = p(2) - q(2);
+        return dx * dx + dy * dy + dz * dz < eps2_;
+    }
+
+    /// Ranges [begin, end) of cells that can hold points within eps of cell c,
+    /// including c itself. Consecutive cells of a column are one range, so
+    /// their points are contiguous as well.
+    void GetNeighborCells(int c,
+                          std::vector<std::pair<int, int>> &nb_ranges) const {
+        nb_ranges.clear();
+        const Eigen::Vector3i &cell = cells_[c];
+        for (int dx = -cell_range_; dx <= cell_range_; ++dx) {
+            for (int dy = -cell_range_; dy <= cell_range_; ++dy) {
+                const double gap2 = Gap2(dx) + Gap2(dy);
+                if (gap2 >= eps2_) continue;
+                auto it = column_ids_.find(
+                        ColumnKey(cell(0) + dx, cell(1) + dy));
+                if (it == column_ids_.end()) continue;
+
+                int dz = cell_range_;
+                while (gap2 + Gap2(dz) >= eps2_) --dz;
+                auto begin = cells_.begin() + column_offsets_[it->second];
+                auto end = cells_.begin() + column_offsets_[it->second + 1];
+                auto z_less = [](const Eigen::Vector3i &cell, int z) {
+                    return cell(2) < z;
+                };
+                auto range_begin =
+                        std::lower_bound(begin, end, cell(2) - dz, z_less);
+                auto range_end = std::lower_bound(range_begin, end,
+                                                  cell(2) + dz + 1, z_less);
+                if (range_begin != range_end) {
+                    nb_ranges.emplace_back(int(range_begin - cells_.begin()),
+                                           int(range_end - cells_.begin()));
+                }
+            }
+        }
+    }
+
+private:
+    static int64_t ColumnKey(int x, int y) {
+        return int64_t(uint64_t(uint32_t(x)) << 32 | uint32_t(y));
+    }
+
+    /// Squared lower bound of the distance along an axis between points in
+    /// cells that are offset by d along this axis.
+    double Gap2(int d) const {
+        const double gap = std::max(std::abs(d) - 1, 0) * cell_size_;
+        return gap * gap;
+    }
+
+    double eps2_;
+    double cell_size_;
+    int cell_range_;
+    std::vector<Eigen::Vector3d> sorted_points_;
+    std::vector<int> sorted_indices_;
+    std::vector<Eigen::Vector3i> cells_;
+    std::vector<int64_t> cell_offsets_;
+    std::vector<int> column_offsets_;
+    std::unordered_map<int64_t, int> column_ids_;
+};
+
+/// Lock-free union-find. Roots are always linked below the root with the
+/// smaller id.
+class ConcurrentUnionFind {
+public:
+    explicit ConcurrentUnionFind(int size) : parents_(size) {
+        for (int i = 0; i < size; ++i) {
+            parents_[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    int Find(int x) {
+        while (true) {
+            int parent = parents_[x].load(std::memory_order_acquire);
+            if (parent == x) {
+                return x;
+            }
+            int grandparent = parents_[parent].load(std::memory_order_acquire);
+            // Path halving. Failure only means another thread got there first.
+            parents_[x].compare_exchange_weak(parent, grandparent,
+                                              std::memory_order_acq_rel);
+            x = grandparent;
+        }
+    }
+
+    void Union(int x, int y) {
+        while (true) {
+            x = Find(x);
+            y = Find(y);
+            if (x == y) {
+                return;
+            }
+            if (x < y) {
+                std::swap(x, y);
+            }
+            int expected = x;
+            if (parents_[x].compare_exchange_strong(
+                        expected, y, std::memory_order_acq_rel)) {
+                return;
+            }
+        }
+    }
+
+private:
+    std::vector<std::atomic<int>> parents_;
+};
+
+}  // namespace
+
 std::vector<int> PointCloud::ClusterDBSCAN(double eps,
                                            size_t min_points,
                                            bool print_progress) const {
-    KDTreeFlann kdtree(*this);
-
-    // Precompute all neighbors.
-    utility::LogDebug("Precompute neighbors.");
-    utility::ConsoleProgressBar progress_bar(
-            points_.size(), "Precompute neighbors.", print_progress);
-    std::vector<std::vector<int>> nbs(points_.size());
-#pragma omp parallel for schedule(static)
-    for (int idx = 0; idx < int(points_.size()); ++idx) {
-        std::vector<double> dists2;
-        kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
+    if (eps <= 0) {
+        utility::LogError("[ClusterDBSCAN] eps <= 0.");
+    }
+    // Grid based DBSCAN, see Gunawan, "A faster algorithm for DBSCAN", 2013.
+    // Points of a cell are mutually within eps, so connectivity of core points
+    // is tracked per cell and no neighbor lists are stored.
+    utility::LogDebug("Build grid.");
+    DBSCANGrid grid(points_, eps);
+    const int num_cells = grid.NumCells();
+    utility::LogDebug("Done build grid: {:d} cells.", num_cells);
 
+    // Find core points, i.e. points with at least min_points neighbors
+    // including themselves.
+    utility::LogDebug("Find core points.");
+    utility::ConsoleProgressBar progress_bar(num_cells, "Find core points",
+                                             print_progress);
+    std::vector<uint8_t> is_core(points_.size(), 0);
+    std::vector<uint8_t> cell_has_core(num_cells, 0);
+#pragma omp parallel
+    {
+        std::vector<std::pair<int, int>> nb_ranges;
+#pragma omp for schedule(dynamic, 64)
+        for (int c = 0; c < num_cells; ++c) {
+            if (size_t(grid.CellSize(c)) >= min_points) {
+                for (int64_t k = grid.CellBegin(c); k < grid.CellEnd(c); ++k) {
+                    is_core[k] = 1;
+                }
+                cell_has_core[c] = 1;
+            } else {
+                grid.GetNeighborCells(c, nb_ranges);
+                for (int64_t k = grid.CellBegin(c); k < grid.CellEnd(c); ++k) {
+                    size_t count = 0;
+                    for (const auto &range : nb_ranges) {
+                        for (int64_t l = grid.CellBegin(range.first);
+                             l < grid.CellBegin(range.second) &&
+                             count < min_points;
+                             ++l) {
+                            count += grid.IsNeighbor(k, l);
+                        }
+                    }
+                    if (count >= min_points) {
+                        is_core[k] = 1;
+                        cell_has_core[c] = 1;
+                    }
+                }
+            }
 #pragma omp critical
-        { ++progress_bar; }
+            { ++progress_bar; }
+        }
     }
-    utility::LogDebug("Done Precompute neighbors.");
+    utility::LogDebug("Done find core points.");
 
-    // Set all labels to undefined (-2).
+    // Merge cells whose core points are within eps of each other.
     utility::LogDebug("Compute Clusters");
-    progress_bar.Reset(points_.size(), "Clustering", print_progress);
-    std::vector<int> labels(points_.size(), -2);
-    int cluster_label = 0;
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        // Label is not undefined.
-        if (labels[idx] != -2) {
-            continue;
-        }
-
-        // Check density.
-        if (nbs[idx].size() < min_points) {
-            labels[idx] = -1;
-            continue;
-        }
-
-        std::unordered_set<int> nbs_next(nbs[idx].begin(), nbs[idx].end());
-        std::unordered_set<int> nbs_visited;
-        nbs_visited.insert(int(idx));
-
-        labels[idx] = cluster_label;
-        ++progress_bar;
-        while (!nbs_next.empty()) {
-            int nb = *nbs_next.begin();
-            nbs_next.erase(nbs_next.begin());
-            nbs_visited.insert(nb);
-
-            // Noise label.
-            if (labels[nb] == -1) {
-                labels[nb] = cluster_label;
-                ++progress_bar;
+    progress_bar.Reset(num_cells, "Clustering", print_progress);
+    ConcurrentUnionFind union_find(num_cells);
+#pragma omp parallel
+    {
+        std::vector<std::pair<int, int>> nb_ranges;
+#pragma omp for schedule(dynamic, 64)
+        for (int c = 0; c < num_cells; ++c) {
+            if (cell_has_core[c]) {
+                grid.GetNeighborCells(c, nb_ranges);
+                for (const auto &range : nb_ranges) {
+                    for (int nb = std::max(range.first, c + 1);
+                         nb < range.second; ++nb) {
+                        if (!cell_has_core[nb] ||
+                            union_find.Find(c) == union_find.Find(nb)) {
+                            continue;
+                        }
+                        bool connected = false;
+                        for (int64_t k = grid.CellBegin(c);
+                             k < grid.CellEnd(c) && !connected; ++k) {
+                            if (!is_core[k]) continue;
+                            for (int64_t l = grid.CellBegin(nb);
+                                 l < grid.CellEnd(nb) && !connected; ++l) {
+                                connected = is_core[l] && grid.IsNeighbor(k, l);
+                            }
+                        }
+                        if (connected) {
+                            union_find.Union(c, nb);
+                        }
+                    }
+                }
+            }
+#pragma omp critical
+            { ++progress_bar; }
+        }
+    }
+
+    // Number clusters in the order of their smallest core point index, which
+    // is the order in which sequential DBSCAN discovers them.
+    std::vector<int> cell_min_core(num_cells, -1);
+    std::vector<int> root_min_core(num_cells, -1);
+    for (int c = 0; c < num_cells; ++c) {
+        if (!cell_has_core[c]) continue;
+        for (int64_t k = grid.CellBegin(c); k < grid.CellEnd(c); ++k) {
+            if (is_core[k]) {
+                cell_min_core[c] = grid.PointIndex(k);
+                break;
             }
-            // Not undefined label.
-            if (labels[nb] != -2) {
-                continue;
+        }
+        int &root_min = root_min_core[union_find.Find(c)];
+        if (root_min < 0 || cell_min_core[c] < root_min) {
+            root_min = cell_min_core[c];
+        }
+    }
+    std::vector<std::pair<int, int>> min_core_and_root;
+    for (int c = 0; c < num_cells; ++c) {
+        if (root_min_core[c] >= 0) {
+            min_core_and_root.emplace_back(root_min_core[c], c);
+        }
+    }
+    std::sort(min_core_and_root.begin(), min_core_and_root.end());
+    std::vector<int> root_labels(num_cells, -1);
+    for (size_t label = 0; label < min_core_and_root.size(); ++label) {
+        root_labels[min_core_and_root[label].second] = int(label);
+    }
+
+    // Core points take the label of their cell. Border points take the
+    // smallest label of the core points within eps, as the first cluster
+    // expanded by sequential DBSCAN claims them. Others are noise (-1).
+    std::vector<int> labels(points_.size(), -1);
+#pragma omp parallel
+    {
+        std::vector<std::pair<int, int>> nb_ranges;
+#pragma omp for schedule(dynamic, 64)
+        for (int c = 0; c < num_cells; ++c) {
+            const int cell_label =
+                    cell_has_core[c] ? root_labels[union_find.Find(c)] : -1;
+            bool has_border = false;
+            for (int64_t k = grid.CellBegin(c); k < grid.CellEnd(c); ++k) {
+                if (is_core[k]) {
+                    labels[grid.PointIndex(k)] = cell_label;
+                } else {
+                    has_border = true;
+                }
             }
-            labels[nb] = cluster_label;
-            ++progress_bar;
+            if (!has_border) continue;
 
-            if (nbs[nb].size() >= min_points) {
-                for (int qnb : nbs[nb]) {
-                    if (nbs_visited.count(qnb) == 0) {
-                        nbs_next.insert(qnb);
+            grid.GetNeighborCells(c, nb_ranges);
+            for (int64_t k = grid.CellBegin(c); k < grid.CellEnd(c); ++k) {
+                if (is_core[k]) continue;
+                int label = -1;
+                for (const auto &range : nb_ranges) {
+                    for (int nb = range.first; nb < range.second; ++nb) {
+                        if (!cell_has_core[nb]) continue;
+                        const int nb_label = root_labels[union_find.Find(nb)];
+                        if (label >= 0 && nb_label >= label) continue;
+                        for (int64_t l = grid.CellBegin(nb);
+                             l < grid.CellEnd(nb); ++l) {
+                            if (is_core[l] && grid.IsNeighbor(k, l)) {
+                                label = nb_label;
+                                break;
+                            }
+                        }
                     }
                 }
+                labels[grid.PointIndex(k)] = label;
             }
         }
-
-        cluster_label++;
     }
 
-    utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
+    utility::LogDebug("Done Compute Clusters: {:d}", min_core_and_root.size());
     return labels;
 }
 
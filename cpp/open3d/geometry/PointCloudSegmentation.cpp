@@ -26,10 +26,11 @@
 
 #include <Eigen/Dense>
 #include <algorithm>
+#include <cmath>
 #include <iterator>
 #include <numeric>
 #include <random>
-#include <unordered_set>
+#include <tuple>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
@@ -38,52 +39,6 @@
 namespace open3d {
 namespace geometry {
 
-/// \class RANSACResult
-///
-/// \brief Stores the current best result in the RANSAC algorithm.
-class RANSACResult {
-public:
-    RANSACResult() : fitness_(0), inlier_rmse_(0) {}
-    ~RANSACResult() {}
-
-public:
-    double fitness_;
-    double inlier_rmse_;
-};
-
-// Calculates the number of inliers given a list of points and a plane model,
-// and the total distance between the inliers and the plane. These numbers are
-// then used to evaluate how well the plane model fits the given points.
-RANSACResult EvaluateRANSACBasedOnDistance(
-        const std::vector<Eigen::Vector3d> &points,
-        const Eigen::Vector4d plane_model,
-        std::vector<size_t> &inliers,
-        double distance_threshold,
-        double error) {
-    RANSACResult result;
-
-    for (size_t idx = 0; idx < points.size(); ++idx) {
-        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
-                              1);
-        double distance = std::abs(plane_model.dot(point));
-
-        if (distance < distance_threshold) {
-            error += distance;
-            inliers.emplace_back(idx);
-        }
-    }
-
-    size_t inlier_num = inliers.size();
-    if (inlier_num == 0) {
-        result.fitness_ = 0;
-        result.inlier_rmse_ = 0;
-    } else {
-        result.fitness_ = (double)inlier_num / (double)points.size();
-        result.inlier_rmse_ = error / std::sqrt((double)inlier_num);
-    }
-    return result;
-}
-
 // Find the plane such that the summed squared distance from the
 // plane to all points is minimized.
 //
@@ -132,86 +87,328 @@ Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
     return Eigen::Vector4d(abc(0), abc(1), abc(2), d);
 }
 
-std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
-        const double distance_threshold /* = 0.01 */,
-        const int ransac_n /* = 3 */,
-        const int num_iterations /* = 100 */) const {
-    RANSACResult result;
-    double error = 0;
+namespace {
 
-    // Initialize the plane model ax + by + cz + d = 0.
-    Eigen::Vector4d plane_model = Eigen::Vector4d(0, 0, 0, 0);
-    // Initialize the best plane model.
-    Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
+/// Hypotheses evaluated in parallel between two termination checks.
+constexpr int kRANSACBatchSize = 32;
+/// Size of the random subset hypotheses are scored on before the full scan.
+constexpr size_t kRANSACSubsetSize = 2048;
 
-    // Initialize consensus set.
-    std::vector<size_t> inliers;
+/// \class RANSACPoints
+///
+/// \brief Points of a RANSAC problem in a random order, stored as single
+/// precision structure of arrays relative to their centroid.
+///
+/// The random order makes every prefix a random subset for preemptive
+/// scoring, and the layout lets the distance tests vectorize.
+class RANSACPoints {
+public:
+    RANSACPoints(const std::vector<Eigen::Vector3d> &points,
+                 std::vector<size_t> indices,
+                 std::mt19937 &rng)
+        : indices_(std::move(indices)) {
+        std::shuffle(indices_.begin(), indices_.end(), rng);
+        const int64_t num_points = int64_t(indices_.size());
+        center_.setZero();
+        for (size_t idx : indices_) {
+            center_ += points[idx];
+        }
+        center_ /= std::max(double(num_points), 1.0);
 
-    size_t num_points = points_.size();
-    std::vector<size_t> indices(num_points);
-    std::iota(std::begin(indices), std::end(indices), 0);
+        xs_.resize(num_points);
+        ys_.resize(num_points);
+        zs_.resize(num_points);
+#pragma omp parallel for schedule(static)
+        for (int64_t k = 0; k < num_points; ++k) {
+            const Eigen::Vector3d point = points[indices_[k]] - center_;
+            xs_[k] = float(point(0));
+            ys_[k] = float(point(1));
+            zs_[k] = float(point(2));
+        }
+    }
 
-    std::random_device rd;
-    std::mt19937 rng(rd());
+    size_t Size() const { return indices_.size(); }
+    size_t Index(size_t k) const { return indices_[k]; }
 
-    // Return if ransac_n is less than the required plane model parameters.
-    if (ransac_n < 3) {
-        utility::LogError(
-                "ransac_n should be set to higher than or equal to 3.");
-        return std::make_tuple(best_plane_model, inliers);
+    /// Number of points in [begin, end) closer than \p distance_threshold to
+    /// the plane.
+    size_t CountInliers(const Eigen::Vector4d &plane,
+                        size_t begin,
+                        size_t end,
+                        double distance_threshold) const {
+        float a, b, c, d;
+        std::tie(a, b, c, d) = ToLocalPlane(plane);
+        const float threshold = float(distance_threshold);
+        const float *xs = xs_.data();
+        const float *ys = ys_.data();
+        const float *zs = zs_.data();
+        int count = 0;
+        for (size_t k = begin; k < end; ++k) {
+            const float distance =
+                    std::abs(a * xs[k] + b * ys[k] + c * zs[k] + d);
+            count += distance < threshold;
+        }
+        return size_t(count);
     }
-    if (num_points < size_t(ransac_n)) {
-        utility::LogError("There must be at least 'ransac_n' points.");
-        return std::make_tuple(best_plane_model, inliers);
+
+    /// Inlier RMSE as defined by the previous serial implementation, i.e. the
+    /// summed inlier distance over the square root of the inlier count.
+    double InlierRMSE(const Eigen::Vector4d &plane,
+                      double distance_threshold) const {
+        float a, b, c, d;
+        std::tie(a, b, c, d) = ToLocalPlane(plane);
+        const float threshold = float(distance_threshold);
+        double error = 0;
+        size_t count = 0;
+        for (size_t k = 0; k < Size(); ++k) {
+            const float distance =
+                    std::abs(a * xs_[k] + b * ys_[k] + c * zs_[k] + d);
+            if (distance < threshold) {
+                error += distance;
+                ++count;
+            }
+        }
+        return count == 0 ? 0 : error / std::sqrt(double(count));
     }
 
-    for (int itr = 0; itr < num_iterations; itr++) {
-        for (int i = 0; i < ransac_n; ++i) {
-            std::swap(indices[i], indices[rng() % num_points]);
+private:
+    std::tuple<float, float, float, float> ToLocalPlane(
+            const Eigen::Vector4d &plane) const {
+        return std::make_tuple(float(plane(0)), float(plane(1)),
+                               float(plane(2)),
+                               float(plane(3) + plane.head<3>().dot(center_)));
+    }
+
+    std::vector<size_t> indices_;
+    Eigen::Vector3d center_;
+    std::vector<float> xs_;
+    std::vector<float> ys_;
+    std::vector<float> zs_;
+};
+
+/// Fits a plane to \p ransac_n distinct random points.
+Eigen::Vector4d SampleRANSACPlane(const std::vector<Eigen::Vector3d> &points,
+                                  const RANSACPoints &ransac_points,
+                                  int ransac_n,
+                                  std::minstd_rand &rng) {
+    std::uniform_int_distribution<size_t> dist(0, ransac_points.Size() - 1);
+    std::vector<size_t> sample;
+    while (int(sample.size()) < ransac_n) {
+        const size_t idx = ransac_points.Index(dist(rng));
+        if (std::find(sample.begin(), sample.end(), idx) == sample.end()) {
+            sample.push_back(idx);
         }
-        inliers.clear();
-        for (int idx = 0; idx < ransac_n; ++idx) {
-            inliers.emplace_back(indices[idx]);
+    }
+    if (ransac_n == 3) {
+        return TriangleMesh::ComputeTrianglePlane(
+                points[sample[0]], points[sample[1]], points[sample[2]]);
+    }
+    return GetPlaneFromPoints(points, sample);
+}
+
+/// Lower confidence bound of an inlier ratio estimated from \p n samples.
+double InlierRatioLowerBound(double ratio, size_t n) {
+    return ratio - 3.0 * std::sqrt(ratio * (1.0 - ratio) / double(n));
+}
+
+/// RANSAC plane segmentation of the points with the given indices.
+///
+/// Hypotheses are generated and scored in parallel batches. Each hypothesis
+/// is first scored on a random subset, and only scanned fully if its subset
+/// inlier ratio is compatible with beating the best hypothesis so far. The
+/// number of iterations adapts to the best inlier ratio w, stopping after
+/// log(1 - probability) / log(1 - w^ransac_n) hypotheses.
+std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlaneRANSAC(
+        const std::vector<Eigen::Vector3d> &points,
+        std::vector<size_t> indices,
+        double distance_threshold,
+        int ransac_n,
+        int num_iterations,
+        double probability,
+        std::mt19937 &rng) {
+    const RANSACPoints ransac_points(points, std::move(indices), rng);
+    const size_t num_points = ransac_points.Size();
+    const size_t subset_size = num_points >= 2 * kRANSACSubsetSize
+                                       ? kRANSACSubsetSize
+                                       : num_points;
+
+    Eigen::Vector4d best_plane_model(0, 0, 0, 0);
+    size_t best_count = 0;
+    double best_rmse = -1;  // Computed lazily to break ties.
+    int max_iterations = num_iterations;
+    int itr = 0;
+    std::vector<Eigen::Vector4d> planes(kRANSACBatchSize);
+    std::vector<size_t> counts(kRANSACBatchSize);
+    std::vector<uint32_t> seeds(kRANSACBatchSize);
+    while (itr < max_iterations) {
+        const int batch_size = std::min(kRANSACBatchSize, max_iterations - itr);
+        for (int k = 0; k < batch_size; ++k) {
+            seeds[k] = rng();
+        }
+#pragma omp parallel for schedule(static)
+        for (int k = 0; k < batch_size; ++k) {
+            std::minstd_rand hypothesis_rng(seeds[k]);
+            planes[k] = SampleRANSACPlane(points, ransac_points, ransac_n,
+                                          hypothesis_rng);
+            counts[k] = planes[k].isZero(0)
+                                ? 0
+                                : ransac_points.CountInliers(
+                                          planes[k], 0, subset_size,
+                                          distance_threshold);
         }
 
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
-        plane_model = TriangleMesh::ComputeTrianglePlane(
-                points_[inliers[0]], points_[inliers[1]], points_[inliers[2]]);
-        if (plane_model.isZero(0)) {
-            continue;
+        if (subset_size < num_points) {
+            // Inlier ratio a hypothesis very likely reaches if it is to beat
+            // the best full score so far or the best subset score in the
+            // batch.
+            const size_t best_subset_count =
+                    *std::max_element(counts.begin(),
+                                      counts.begin() + batch_size);
+            const double ref_ratio = std::max(
+                    double(best_count) / double(num_points),
+                    InlierRatioLowerBound(
+                            double(best_subset_count) / double(subset_size),
+                            subset_size));
+            const double min_subset_ratio =
+                    ref_ratio > 0 ? InlierRatioLowerBound(ref_ratio,
+                                                          subset_size)
+                                  : 0;
+#pragma omp parallel for schedule(dynamic)
+            for (int k = 0; k < batch_size; ++k) {
+                if (counts[k] > 0 && double(counts[k]) >=
+                                             min_subset_ratio * subset_size) {
+                    counts[k] += ransac_points.CountInliers(
+                            planes[k], subset_size, num_points,
+                            distance_threshold);
+                } else {
+                    counts[k] = 0;
+                }
+            }
         }
 
-        error = 0;
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold, error);
-        if (this_result.fitness_ > result.fitness_ ||
-            (this_result.fitness_ == result.fitness_ &&
-             this_result.inlier_rmse_ < result.inlier_rmse_)) {
-            result = this_result;
-            best_plane_model = plane_model;
+        // Reduce in hypothesis order, so that results do not depend on the
+        // number of threads.
+        for (int k = 0; k < batch_size; ++k) {
+            if (counts[k] == 0 || counts[k] < best_count) continue;
+            if (counts[k] == best_count) {
+                if (best_rmse < 0) {
+                    best_rmse = ransac_points.InlierRMSE(best_plane_model,
+                                                         distance_threshold);
+                }
+                const double rmse = ransac_points.InlierRMSE(
+                        planes[k], distance_threshold);
+                if (rmse >= best_rmse) continue;
+                best_rmse = rmse;
+            } else {
+                best_rmse = -1;
+            }
+            best_count = counts[k];
+            best_plane_model = planes[k];
         }
-    }
+        itr += batch_size;
 
-    // Find the final inliers using best_plane_model.
-    inliers.clear();
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        Eigen::Vector4d point(points_[idx](0), points_[idx](1), points_[idx](2),
-                              1);
-        double distance = std::abs(best_plane_model.dot(point));
+        if (best_count > 0) {
+            const double inlier_ratio = double(best_count) / double(num_points);
+            const double required =
+                    std::log1p(-probability) /
+                    std::log1p(-std::pow(inlier_ratio, ransac_n));
+            if (required < double(max_iterations)) {
+                max_iterations = std::max(int(std::ceil(required)), 1);
+            }
+        }
+    }
 
-        if (distance < distance_threshold) {
-            inliers.emplace_back(idx);
+    // Find the final inliers using best_plane_model. If no valid plane was
+    // found, this keeps the previous behavior of returning all points.
+    std::vector<size_t> inliers;
+    for (size_t k = 0; k < num_points; ++k) {
+        const size_t idx = ransac_points.Index(k);
+        const Eigen::Vector4d point(points[idx](0), points[idx](1),
+                                    points[idx](2), 1);
+        if (std::abs(best_plane_model.dot(point)) < distance_threshold) {
+            inliers.push_back(idx);
         }
     }
+    std::sort(inliers.begin(), inliers.end());
+
+    utility::LogDebug(
+            "RANSAC | Iterations: {:d}, Inliers: {:d}, Fitness: {:e}, RMSE: "
+            "{:e}",
+            itr, inliers.size(), double(best_count) / double(num_points),
+            ransac_points.InlierRMSE(best_plane_model, distance_threshold));
 
     // Improve best_plane_model using the final inliers.
-    best_plane_model = GetPlaneFromPoints(points_, inliers);
+    return std::make_tuple(GetPlaneFromPoints(points, inliers), inliers);
+}
+
+void CheckSegmentPlaneParameters(size_t num_points,
+                                 int ransac_n,
+                                 double probability) {
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    if (num_points < size_t(ransac_n)) {
+        utility::LogError("There must be at least 'ransac_n' points.");
+    }
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("probability must be in (0, 1], but got {}.",
+                          probability);
+    }
+}
+
+}  // namespace
 
-    utility::LogDebug("RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}",
-                      inliers.size(), result.fitness_, result.inlier_rmse_);
-    return std::make_tuple(best_plane_model, inliers);
+std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
+        const double distance_threshold /* = 0.01 */,
+        const int ransac_n /* = 3 */,
+        const int num_iterations /* = 100 */,
+        const double probability /* = 0.99999999 */) const {
+    CheckSegmentPlaneParameters(points_.size(), ransac_n, probability);
+
+    std::vector<size_t> indices(points_.size());
+    std::iota(std::begin(indices), std::end(indices), 0);
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    return SegmentPlaneRANSAC(points_, std::move(indices), distance_threshold,
+                              ransac_n, num_iterations, probability, rng);
+}
+
+std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+PointCloud::SegmentPlanes(const double distance_threshold /* = 0.01 */,
+                          const int ransac_n /* = 3 */,
+                          const int num_iterations /* = 100 */,
+                          const int max_num_planes /* = 10 */,
+                          const size_t min_num_inliers /* = 100 */,
+                          const double probability /* = 0.99999999 */) const {
+    CheckSegmentPlaneParameters(points_.size(), ransac_n, probability);
+
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes;
+    std::vector<size_t> remaining(points_.size());
+    std::iota(std::begin(remaining), std::end(remaining), 0);
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    while (int(planes.size()) < max_num_planes &&
+           remaining.size() >= size_t(ransac_n)) {
+        Eigen::Vector4d plane_model;
+        std::vector<size_t> inliers;
+        std::tie(plane_model, inliers) =
+                SegmentPlaneRANSAC(points_, remaining, distance_threshold,
+                                   ransac_n, num_iterations, probability, rng);
+        if (plane_model.isZero(0) || inliers.size() < min_num_inliers) {
+            break;
+        }
+
+        // Both lists are sorted.
+        std::vector<size_t> outliers;
+        outliers.reserve(remaining.size() - inliers.size());
+        std::set_difference(remaining.begin(), remaining.end(),
+                            inliers.begin(), inliers.end(),
+                            std::back_inserter(outliers));
+        remaining = std::move(outliers);
+        planes.emplace_back(plane_model, std::move(inliers));
+    }
+    return planes;
 }
 
 }  // namespace geometry
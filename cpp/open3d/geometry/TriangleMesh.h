@@ -430,6 +430,26 @@ public:
             double maximum_error,
             double boundary_weight) const;
 
+    /// Parallel variant of SimplifyQuadricDecimation.
+    ///
+    /// Edges are collapsed in rounds. Each round takes a batch of the
+    /// cheapest edges, selects a subset of them whose neighborhoods do not
+    /// overlap and collapses those concurrently. Edge costs are cached and
+    /// only recomputed around collapsed edges. The result is deterministic,
+    /// but differs from the strictly greedy order of
+    /// SimplifyQuadricDecimation.
+    /// \param target_number_of_triangles defines the number of triangles that
+    /// the simplified mesh should have. It is not guaranteed that this number
+    /// will be reached.
+    /// \param maximum_error defines the maximum error where a vertex is allowed
+    /// to be merged
+    /// \param boundary_weight a weight applied to edge vertices used to
+    /// preserve boundaries
+    std::shared_ptr<TriangleMesh> SimplifyQuadricDecimationParallel(
+            int target_number_of_triangles,
+            double maximum_error,
+            double boundary_weight) const;
+
     /// Function to select points from \p input TriangleMesh into
     /// output TriangleMesh
     /// Vertices with indices in \p indices are selected.
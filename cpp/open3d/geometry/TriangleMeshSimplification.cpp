@@ -24,8 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <numeric>
 #include <queue>
+#include <random>
 #include <tuple>
 
 #include "open3d/geometry/TriangleMesh.h"
@@ -88,6 +95,90 @@ public:
     double c_;
 };
 
+/// Computes the error quadric of every vertex from the planes of its adjacent
+/// triangles. Boundary edges, i.e. edges with a single adjacent triangle, add
+/// a plane perpendicular to that triangle weighted by \p boundary_weight.
+/// \p vert_to_triangles lists the triangles adjacent to each vertex, each
+/// triangle at most once.
+template <typename VertToTriangles>
+static std::vector<Quadric> ComputeVertexQuadrics(
+        const TriangleMesh& mesh,
+        const VertToTriangles& vert_to_triangles,
+        const std::vector<Eigen::Vector4d>& triangle_planes,
+        const std::vector<double>& triangle_areas,
+        double boundary_weight) {
+    const auto& vertices = mesh.vertices_;
+    const auto& triangles = mesh.triangles_;
+    auto IsBoundaryEdge = [&](int vidx0, int vidx1) {
+        int count = 0;
+        for (int tidx : vert_to_triangles[vidx0]) {
+            const auto& tria = triangles[tidx];
+            count += (tria(0) == vidx1 || tria(1) == vidx1 || tria(2) == vidx1);
+        }
+        return count == 1;
+    };
+
+    std::vector<Quadric> Qs(vertices.size());
+#pragma omp parallel for schedule(static)
+    for (int64_t vidx = 0; vidx < int64_t(vertices.size()); ++vidx) {
+        Quadric& Q = Qs[vidx];
+        for (int tidx : vert_to_triangles[vidx]) {
+            Q += Quadric(triangle_planes[tidx], triangle_areas[tidx]);
+        }
+        for (int tidx : vert_to_triangles[vidx]) {
+            const auto& tria = triangles[tidx];
+            for (int k = 0; k < 3; ++k) {
+                int vidx0 = tria(k);
+                int vidx1 = tria((k + 1) % 3);
+                if ((vidx0 != vidx && vidx1 != vidx) ||
+                    !IsBoundaryEdge(vidx0, vidx1)) {
+                    continue;
+                }
+                const auto& vert0 = vertices[vidx0];
+                const auto& vert1 = vertices[vidx1];
+                const auto& vert2 = vertices[tria((k + 2) % 3)];
+                Eigen::Vector3d vert2p = (vert2 - vert0).cross(vert2 - vert1);
+                Eigen::Vector4d plane = TriangleMesh::ComputeTrianglePlane(
+                        vert0, vert1, vert2p);
+                Q += Quadric(plane, triangle_areas[tidx] * boundary_weight);
+            }
+        }
+    }
+    return Qs;
+}
+
+/// Computes the position \p vbar that minimizes the quadric error of the
+/// contracted edge (vidx0, vidx1) and returns its cost. Falls back to the
+/// best of the end points and the edge midpoint if the quadric is singular.
+static double ComputeEdgeCollapse(const std::vector<Quadric>& Qs,
+                                  const std::vector<Eigen::Vector3d>& vertices,
+                                  int vidx0,
+                                  int vidx1,
+                                  Eigen::Vector3d& vbar) {
+    Quadric Qbar = Qs[vidx0] + Qs[vidx1];
+    double cost;
+    if (Qbar.IsInvertible()) {
+        vbar = Qbar.Minimum();
+        cost = Qbar.Eval(vbar);
+    } else {
+        const Eigen::Vector3d& v0 = vertices[vidx0];
+        const Eigen::Vector3d& v1 = vertices[vidx1];
+        Eigen::Vector3d vmid = (v0 + v1) / 2;
+        double cost0 = Qbar.Eval(v0);
+        double cost1 = Qbar.Eval(v1);
+        double costmid = Qbar.Eval(vmid);
+        cost = std::min(cost0, std::min(cost1, costmid));
+        if (cost == costmid) {
+            vbar = vmid;
+        } else if (cost == cost0) {
+            vbar = v0;
+        } else {
+            vbar = v1;
+        }
+    }
+    return cost;
+}
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
         double voxel_size,
         SimplificationContraction
@@ -111,148 +202,216 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
         utility::LogError("[VoxelGridFromPointCloud] voxel_size is too small.");
     }
 
-    auto GetVoxelIdx = [&](const Eigen::Vector3d& vert) {
-        Eigen::Vector3d ref_coord = (vert - voxel_min_bound) / voxel_size;
-        Eigen::Vector3i idx(int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                            int(floor(ref_coord(2))));
-        return idx;
+    // Sort the vertices by voxel, so that each voxel is a run of vertices in
+    // increasing index order. The runs are reduced independently.
+    struct VertexVoxel {
+        Eigen::Vector3i voxel_index_;
+        int vertex_index_;
     };
+    const int64_t num_vertices = int64_t(vertices_.size());
+    std::vector<VertexVoxel> vertex_voxels(num_vertices);
+#pragma omp parallel for schedule(static)
+    for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+        Eigen::Vector3d ref_coord =
+                (vertices_[vidx] - voxel_min_bound) / voxel_size;
+        vertex_voxels[vidx].voxel_index_ << int(floor(ref_coord(0))),
+                int(floor(ref_coord(1))), int(floor(ref_coord(2)));
+        vertex_voxels[vidx].vertex_index_ = int(vidx);
+    }
+    tbb::parallel_sort(vertex_voxels.begin(), vertex_voxels.end(),
+                       [](const VertexVoxel& a, const VertexVoxel& b) {
+                           const Eigen::Vector3i& va = a.voxel_index_;
+                           const Eigen::Vector3i& vb = b.voxel_index_;
+                           if (va(2) != vb(2)) return va(2) < vb(2);
+                           if (va(1) != vb(1)) return va(1) < vb(1);
+                           if (va(0) != vb(0)) return va(0) < vb(0);
+                           return a.vertex_index_ < b.vertex_index_;
+                       });
+    std::vector<int64_t> run_begins;
+    for (int64_t i = 0; i < num_vertices; ++i) {
+        if (i == 0 || vertex_voxels[i].voxel_index_ !=
+                              vertex_voxels[i - 1].voxel_index_) {
+            run_begins.push_back(i);
+        }
+    }
+    run_begins.push_back(num_vertices);
+    const int64_t num_voxels = int64_t(run_begins.size()) - 1;
 
-    std::unordered_map<Eigen::Vector3i, std::unordered_set<int>,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxel_vertices;
-    std::unordered_map<Eigen::Vector3i, int,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxel_vert_ind;
+    // Number the voxels in the order of their first vertex, and map every
+    // vertex to the new vertex of its voxel.
+    std::vector<int> vert_to_voxel(num_vertices, 0);
+    for (int64_t run = 0; run < num_voxels; ++run) {
+        vert_to_voxel[vertex_voxels[run_begins[run]].vertex_index_] = 1;
+    }
+    std::vector<int> run_to_voxel(num_voxels);
     int new_vidx = 0;
-    for (size_t vidx = 0; vidx < vertices_.size(); ++vidx) {
-        const Eigen::Vector3i vox_idx = GetVoxelIdx(vertices_[vidx]);
-        voxel_vertices[vox_idx].insert(int(vidx));
-
-        if (voxel_vert_ind.count(vox_idx) == 0) {
-            voxel_vert_ind[vox_idx] = new_vidx;
-            new_vidx++;
+    for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+        const int is_first = vert_to_voxel[vidx];
+        vert_to_voxel[vidx] = new_vidx;
+        new_vidx += is_first;
+    }
+#pragma omp parallel for schedule(static)
+    for (int64_t run = 0; run < num_voxels; ++run) {
+        const int voxel = vert_to_voxel[vertex_voxels[run_begins[run]]
+                                                .vertex_index_];
+        run_to_voxel[run] = voxel;
+        for (int64_t i = run_begins[run] + 1; i < run_begins[run + 1]; ++i) {
+            vert_to_voxel[vertex_voxels[i].vertex_index_] = voxel;
         }
     }
 
     // aggregate vertex info
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
-    mesh->vertices_.resize(voxel_vertices.size());
+    mesh->vertices_.resize(num_voxels);
     if (has_vert_normal) {
-        mesh->vertex_normals_.resize(voxel_vertices.size());
+        mesh->vertex_normals_.resize(num_voxels);
     }
     if (has_vert_color) {
-        mesh->vertex_colors_.resize(voxel_vertices.size());
+        mesh->vertex_colors_.resize(num_voxels);
     }
 
-    auto AvgVertex = [&](const std::unordered_set<int> ind) {
-        Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += vertices_[vidx];
-        }
-        aggr /= double(ind.size());
-        return aggr;
-    };
-    auto AvgNormal = [&](const std::unordered_set<int> ind) {
+    auto AvgRun = [&](const std::vector<Eigen::Vector3d>& values,
+                      int64_t run) {
         Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += vertex_normals_[vidx];
+        for (int64_t i = run_begins[run]; i < run_begins[run + 1]; ++i) {
+            aggr += values[vertex_voxels[i].vertex_index_];
         }
-        aggr /= double(ind.size());
-        return aggr;
-    };
-    auto AvgColor = [&](const std::unordered_set<int> ind) {
-        Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += vertex_colors_[vidx];
-        }
-        aggr /= double(ind.size());
+        aggr /= double(run_begins[run + 1] - run_begins[run]);
         return aggr;
     };
 
     if (contraction == SimplificationContraction::Average) {
-        for (const auto& voxel : voxel_vertices) {
-            int vox_vidx = voxel_vert_ind[voxel.first];
-            mesh->vertices_[vox_vidx] = AvgVertex(voxel.second);
-            if (has_vert_normal) {
-                mesh->vertex_normals_[vox_vidx] = AvgNormal(voxel.second);
+#pragma omp parallel for schedule(static)
+        for (int64_t run = 0; run < num_voxels; ++run) {
+            mesh->vertices_[run_to_voxel[run]] = AvgRun(vertices_, run);
+        }
+    } else if (contraction == SimplificationContraction::Quadric) {
+        // Map vertices to their distinct triangles, in compressed rows
+        const int64_t num_triangles = int64_t(triangles_.size());
+        std::vector<int64_t> vert_to_triangles_begins(num_vertices + 1, 0);
+        for (const auto& tria : triangles_) {
+            vert_to_triangles_begins[tria(0) + 1]++;
+            if (tria(1) != tria(0)) {
+                vert_to_triangles_begins[tria(1) + 1]++;
             }
-            if (has_vert_color) {
-                mesh->vertex_colors_[vox_vidx] = AvgColor(voxel.second);
+            if (tria(2) != tria(0) && tria(2) != tria(1)) {
+                vert_to_triangles_begins[tria(2) + 1]++;
             }
         }
-    } else if (contraction == SimplificationContraction::Quadric) {
-        // Map triangles
-        std::unordered_map<int, std::unordered_set<int>> vert_to_triangles;
-        for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-            vert_to_triangles[triangles_[tidx](0)].emplace(int(tidx));
-            vert_to_triangles[triangles_[tidx](1)].emplace(int(tidx));
-            vert_to_triangles[triangles_[tidx](2)].emplace(int(tidx));
+        std::partial_sum(vert_to_triangles_begins.begin(),
+                         vert_to_triangles_begins.end(),
+                         vert_to_triangles_begins.begin());
+        std::vector<int> vert_to_triangles(vert_to_triangles_begins.back());
+        std::vector<int64_t> next_slot(vert_to_triangles_begins.begin(),
+                                       vert_to_triangles_begins.end() - 1);
+        for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
+            const auto& tria = triangles_[tidx];
+            vert_to_triangles[next_slot[tria(0)]++] = int(tidx);
+            if (tria(1) != tria(0)) {
+                vert_to_triangles[next_slot[tria(1)]++] = int(tidx);
+            }
+            if (tria(2) != tria(0) && tria(2) != tria(1)) {
+                vert_to_triangles[next_slot[tria(2)]++] = int(tidx);
+            }
+        }
+        std::vector<Quadric> triangle_quadrics(num_triangles);
+#pragma omp parallel for schedule(static)
+        for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
+            triangle_quadrics[tidx] =
+                    Quadric(GetTrianglePlane(tidx), GetTriangleArea(tidx));
         }
 
-        for (const auto& voxel : voxel_vertices) {
-            int vox_vidx = voxel_vert_ind[voxel.first];
-
+#pragma omp parallel for schedule(static)
+        for (int64_t run = 0; run < num_voxels; ++run) {
             Quadric q;
-            for (int vidx : voxel.second) {
-                for (int tidx : vert_to_triangles[vidx]) {
-                    Eigen::Vector4d p = GetTrianglePlane(tidx);
-                    double area = GetTriangleArea(tidx);
-                    q += Quadric(p, area);
+            for (int64_t i = run_begins[run]; i < run_begins[run + 1]; ++i) {
+                const int vidx = vertex_voxels[i].vertex_index_;
+                for (int64_t j = vert_to_triangles_begins[vidx];
+                     j < vert_to_triangles_begins[vidx + 1]; ++j) {
+                    q += triangle_quadrics[vert_to_triangles[j]];
                 }
             }
             if (q.IsInvertible()) {
-                Eigen::Vector3d v = q.Minimum();
-                mesh->vertices_[vox_vidx] = v;
+                mesh->vertices_[run_to_voxel[run]] = q.Minimum();
             } else {
-                mesh->vertices_[vox_vidx] = AvgVertex(voxel.second);
+                mesh->vertices_[run_to_voxel[run]] = AvgRun(vertices_, run);
             }
-
+        }
+    }
+    if (has_vert_normal || has_vert_color) {
+#pragma omp parallel for schedule(static)
+        for (int64_t run = 0; run < num_voxels; ++run) {
             if (has_vert_normal) {
-                mesh->vertex_normals_[vox_vidx] = AvgNormal(voxel.second);
+                mesh->vertex_normals_[run_to_voxel[run]] =
+                        AvgRun(vertex_normals_, run);
             }
             if (has_vert_color) {
-                mesh->vertex_colors_[vox_vidx] = AvgColor(voxel.second);
+                mesh->vertex_colors_[run_to_voxel[run]] =
+                        AvgRun(vertex_colors_, run);
             }
         }
     }
 
     //  connect vertices
-    std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
-            triangles;
-    for (const auto& triangle : triangles_) {
-        int vidx0 = voxel_vert_ind[GetVoxelIdx(vertices_[triangle(0)])];
-        int vidx1 = voxel_vert_ind[GetVoxelIdx(vertices_[triangle(1)])];
-        int vidx2 = voxel_vert_ind[GetVoxelIdx(vertices_[triangle(2)])];
-
-        // only connect if in different voxels
-        if (vidx0 == vidx1 || vidx0 == vidx2 || vidx1 == vidx2) {
-            continue;
-        }
+    const int64_t num_triangles = int64_t(triangles_.size());
+    std::vector<Eigen::Vector3i> voxel_triangles(num_triangles);
+    std::vector<int64_t> valid_triangles;
+#pragma omp parallel
+    {
+        std::vector<int64_t> valid_triangles_private;
+#pragma omp for nowait schedule(static)
+        for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
+            const auto& triangle = triangles_[tidx];
+            int vidx0 = vert_to_voxel[triangle(0)];
+            int vidx1 = vert_to_voxel[triangle(1)];
+            int vidx2 = vert_to_voxel[triangle(2)];
 
-        // Note: there can be still double faces with different orientation
-        // The user has to clean up manually
-        if (vidx1 < vidx0 && vidx1 < vidx2) {
-            int tmp = vidx0;
-            vidx0 = vidx1;
-            vidx1 = vidx2;
-            vidx2 = tmp;
-        } else if (vidx2 < vidx0 && vidx2 < vidx1) {
-            int tmp = vidx1;
-            vidx1 = vidx0;
-            vidx0 = vidx2;
-            vidx2 = tmp;
-        }
+            // only connect if in different voxels
+            if (vidx0 == vidx1 || vidx0 == vidx2 || vidx1 == vidx2) {
+                continue;
+            }
 
-        triangles.emplace(Eigen::Vector3i(vidx0, vidx1, vidx2));
+            // Note: there can be still double faces with different
+            // orientation. The user has to clean up manually
+            if (vidx1 < vidx0 && vidx1 < vidx2) {
+                voxel_triangles[tidx] = Eigen::Vector3i(vidx1, vidx2, vidx0);
+            } else if (vidx2 < vidx0 && vidx2 < vidx1) {
+                voxel_triangles[tidx] = Eigen::Vector3i(vidx2, vidx0, vidx1);
+            } else {
+                voxel_triangles[tidx] = Eigen::Vector3i(vidx0, vidx1, vidx2);
+            }
+            valid_triangles_private.push_back(tidx);
+        }
+#pragma omp critical
+        {
+            valid_triangles.insert(valid_triangles.end(),
+                                   valid_triangles_private.begin(),
+                                   valid_triangles_private.end());
+        }
     }
 
-    mesh->triangles_.resize(triangles.size());
-    int tidx = 0;
-    for (const Eigen::Vector3i& triangle : triangles) {
-        mesh->triangles_[tidx] = triangle;
-        tidx++;
+    // Keep the first occurrence of each triangle, in the input order
+    tbb::parallel_sort(valid_triangles.begin(), valid_triangles.end(),
+                       [&](int64_t tidx0, int64_t tidx1) {
+                           const Eigen::Vector3i& t0 = voxel_triangles[tidx0];
+                           const Eigen::Vector3i& t1 = voxel_triangles[tidx1];
+                           if (t0(0) != t1(0)) return t0(0) < t1(0);
+                           if (t0(1) != t1(1)) return t0(1) < t1(1);
+                           if (t0(2) != t1(2)) return t0(2) < t1(2);
+                           return tidx0 < tidx1;
+                       });
+    std::vector<uint8_t> is_kept(num_triangles, 0);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < int64_t(valid_triangles.size()); ++i) {
+        is_kept[valid_triangles[i]] =
+                i == 0 || voxel_triangles[valid_triangles[i]] !=
+                                  voxel_triangles[valid_triangles[i - 1]];
+    }
+    for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
+        if (is_kept[tidx]) {
+            mesh->triangles_.push_back(voxel_triangles[tidx]);
+        }
     }
 
     if (HasTriangleNormals()) {
@@ -284,51 +443,24 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
 
     // Map vertices to triangles and compute triangle planes and areas
     std::vector<std::unordered_set<int>> vert_to_triangles(vertices_.size());
-    std::vector<Eigen::Vector4d> triangle_planes(triangles_.size());
-    std::vector<double> triangle_areas(triangles_.size());
     for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
         vert_to_triangles[triangles_[tidx](0)].emplace(static_cast<int>(tidx));
         vert_to_triangles[triangles_[tidx](1)].emplace(static_cast<int>(tidx));
         vert_to_triangles[triangles_[tidx](2)].emplace(static_cast<int>(tidx));
-
+    }
+    std::vector<Eigen::Vector4d> triangle_planes(triangles_.size());
+    std::vector<double> triangle_areas(triangles_.size());
+#pragma omp parallel for schedule(static)
+    for (int64_t tidx = 0; tidx < int64_t(triangles_.size()); ++tidx) {
         triangle_planes[tidx] = GetTrianglePlane(tidx);
         triangle_areas[tidx] = GetTriangleArea(tidx);
     }
 
-    // Compute the error metric per vertex
-    std::vector<Quadric> Qs(vertices_.size());
-    for (size_t vidx = 0; vidx < vertices_.size(); ++vidx) {
-        for (int tidx : vert_to_triangles[vidx]) {
-            Qs[vidx] += Quadric(triangle_planes[tidx], triangle_areas[tidx]);
-        }
-    }
-
-    // For boundary edges add perpendicular plane quadric
-    auto edge_triangle_count = GetEdgeToTrianglesMap();
-    auto AddPerpPlaneQuadric = [&](int vidx0, int vidx1, int vidx2,
-                                   double area) {
-        int min = std::min(vidx0, vidx1);
-        int max = std::max(vidx0, vidx1);
-        Eigen::Vector2i edge(min, max);
-        if (edge_triangle_count[edge].size() != 1) {
-            return;
-        }
-        const auto& vert0 = mesh->vertices_[vidx0];
-        const auto& vert1 = mesh->vertices_[vidx1];
-        const auto& vert2 = mesh->vertices_[vidx2];
-        Eigen::Vector3d vert2p = (vert2 - vert0).cross(vert2 - vert1);
-        Eigen::Vector4d plane = ComputeTrianglePlane(vert0, vert1, vert2p);
-        Quadric quad(plane, area * boundary_weight);
-        Qs[vidx0] += quad;
-        Qs[vidx1] += quad;
-    };
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto& tria = triangles_[tidx];
-        double area = triangle_areas[tidx];
-        AddPerpPlaneQuadric(tria(0), tria(1), tria(2), area);
-        AddPerpPlaneQuadric(tria(1), tria(2), tria(0), area);
-        AddPerpPlaneQuadric(tria(2), tria(0), tria(1), area);
-    }
+    // Compute the error metric per vertex, including the perpendicular plane
+    // quadrics of boundary edges
+    std::vector<Quadric> Qs =
+            ComputeVertexQuadrics(*this, vert_to_triangles, triangle_planes,
+                                  triangle_areas, boundary_weight);
 
     // Get valid edges and compute cost
     // Note: We could also select all vertex pairs as edges with dist < eps
@@ -341,51 +473,50 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     auto CostEdgeComp = [](const CostEdge& a, const CostEdge& b) {
         return std::get<0>(a) > std::get<0>(b);
     };
+
+    // The initial edge costs are computed in parallel and turned into a heap
+    // at once. Updated edges are pushed again and stale entries are skipped
+    // when popped.
+    std::vector<CostEdge> initial_edges(3 * triangles_.size());
+    std::vector<Eigen::Vector3d> initial_vbars(3 * triangles_.size());
+#pragma omp parallel for schedule(static)
+    for (int64_t tidx = 0; tidx < int64_t(triangles_.size()); ++tidx) {
+        const auto& triangle = triangles_[tidx];
+        for (int k = 0; k < 3; ++k) {
+            int vidx0 = triangle(k);
+            int vidx1 = triangle((k + 1) % 3);
+            double cost = ComputeEdgeCollapse(Qs, vertices_, vidx0, vidx1,
+                                              initial_vbars[3 * tidx + k]);
+            initial_edges[3 * tidx + k] = CostEdge(
+                    cost, std::min(vidx0, vidx1), std::max(vidx0, vidx1));
+        }
+    }
+    size_t num_edges = 0;
+    for (size_t idx = 0; idx < initial_edges.size(); ++idx) {
+        Eigen::Vector2i edge(std::get<1>(initial_edges[idx]),
+                             std::get<2>(initial_edges[idx]));
+        if (vbars.count(edge) == 0) {
+            vbars[edge] = initial_vbars[idx];
+            costs[edge] = std::get<0>(initial_edges[idx]);
+            initial_edges[num_edges++] = initial_edges[idx];
+        }
+    }
+    initial_edges.resize(num_edges);
     std::priority_queue<CostEdge, std::vector<CostEdge>, decltype(CostEdgeComp)>
-            queue(CostEdgeComp);
+            queue(CostEdgeComp, std::move(initial_edges));
 
-    auto AddEdge = [&](int vidx0, int vidx1, bool update) {
+    auto UpdateEdge = [&](int vidx0, int vidx1) {
         int min = std::min(vidx0, vidx1);
         int max = std::max(vidx0, vidx1);
         Eigen::Vector2i edge(min, max);
-        if (update || vbars.count(edge) == 0) {
-            const Quadric& Q0 = Qs[min];
-            const Quadric& Q1 = Qs[max];
-            Quadric Qbar = Q0 + Q1;
-            double cost;
-            Eigen::Vector3d vbar;
-            if (Qbar.IsInvertible()) {
-                vbar = Qbar.Minimum();
-                cost = Qbar.Eval(vbar);
-            } else {
-                const Eigen::Vector3d& v0 = mesh->vertices_[vidx0];
-                const Eigen::Vector3d& v1 = mesh->vertices_[vidx1];
-                Eigen::Vector3d vmid = (v0 + v1) / 2;
-                double cost0 = Qbar.Eval(v0);
-                double cost1 = Qbar.Eval(v1);
-                double costmid = Qbar.Eval(vmid);
-                cost = std::min(cost0, std::min(cost1, costmid));
-                if (cost == costmid) {
-                    vbar = vmid;
-                } else if (cost == cost0) {
-                    vbar = v0;
-                } else {
-                    vbar = v1;
-                }
-            }
-            vbars[edge] = vbar;
-            costs[edge] = cost;
-            queue.push(CostEdge(cost, min, max));
-        }
+        Eigen::Vector3d vbar;
+        double cost =
+                ComputeEdgeCollapse(Qs, mesh->vertices_, vidx0, vidx1, vbar);
+        vbars[edge] = vbar;
+        costs[edge] = cost;
+        queue.push(CostEdge(cost, min, max));
     };
 
-    // add all edges to priority queue
-    for (const auto& triangle : triangles_) {
-        AddEdge(triangle(0), triangle(1), false);
-        AddEdge(triangle(1), triangle(2), false);
-        AddEdge(triangle(2), triangle(0), false);
-    }
-
     // perform incremental edge collapse
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
@@ -498,13 +629,13 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
             }
             const Eigen::Vector3i& tria = mesh->triangles_[tidx];
             if (tria(0) == vidx0 || tria(1) == vidx0) {
-                AddEdge(tria(0), tria(1), true);
+                UpdateEdge(tria(0), tria(1));
             }
             if (tria(1) == vidx0 || tria(2) == vidx0) {
-                AddEdge(tria(1), tria(2), true);
+                UpdateEdge(tria(1), tria(2));
             }
             if (tria(2) == vidx0 || tria(0) == vidx0) {
-                AddEdge(tria(2), tria(0), true);
+                UpdateEdge(tria(2), tria(0));
             }
         }
     }
@@ -552,5 +683,440 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     return mesh;
 }
 
+std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimationParallel(
+        int target_number_of_triangles,
+        double maximum_error = std::numeric_limits<double>::infinity(),
+        double boundary_weight = 1.0) const {
+    if (HasTriangleUvs()) {
+        utility::LogWarning(
+                "[SimplifyQuadricDecimationParallel] This mesh contains "
+                "triangle uvs that are not handled in this function");
+    }
+    const int64_t num_vertices = int64_t(vertices_.size());
+    const int64_t num_triangles = int64_t(triangles_.size());
+    if (3 * num_triangles > std::numeric_limits<int>::max()) {
+        utility::LogError(
+                "[SimplifyQuadricDecimationParallel] Too many triangles.");
+    }
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
+    mesh->triangles_ = triangles_;
+    auto& vertices = mesh->vertices_;
+    auto& triangles = mesh->triangles_;
+
+    std::vector<uint8_t> vertices_deleted(num_vertices, 0);
+    std::vector<uint8_t> triangles_deleted(num_triangles, 0);
+
+    // Map vertices to triangles and compute triangle planes and areas
+    std::vector<std::vector<int>> vert_to_triangles(num_vertices);
+    for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
+        const auto& tria = triangles_[tidx];
+        vert_to_triangles[tria(0)].push_back(int(tidx));
+        if (tria(1) != tria(0)) {
+            vert_to_triangles[tria(1)].push_back(int(tidx));
+        }
+        if (tria(2) != tria(0) && tria(2) != tria(1)) {
+            vert_to_triangles[tria(2)].push_back(int(tidx));
+        }
+    }
+    std::vector<Eigen::Vector4d> triangle_planes(num_triangles);
+    std::vector<double> triangle_areas(num_triangles);
+#pragma omp parallel for schedule(static)
+    for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
+        triangle_planes[tidx] = GetTrianglePlane(tidx);
+        triangle_areas[tidx] = GetTriangleArea(tidx);
+    }
+    std::vector<Quadric> Qs =
+            ComputeVertexQuadrics(*this, vert_to_triangles, triangle_planes,
+                                  triangle_areas, boundary_weight);
+
+    // Each undirected edge is represented by the half-edge 3 * tidx + k from
+    // tria(k) to tria(k + 1) with tria(k) < tria(k + 1), or by its only
+    // half-edge if it is a boundary edge. Costs are cached per half-edge and
+    // recomputed lazily for the triangles around a collapsed edge.
+    std::vector<double> edge_costs(3 * num_triangles);
+    std::vector<Eigen::Vector3d> edge_vbars(3 * num_triangles);
+    std::vector<uint8_t> edge_is_candidate(3 * num_triangles, 0);
+    std::vector<uint8_t> triangles_dirty(num_triangles, 1);
+    auto UpdateEdge = [&](int64_t eidx, int vidx0, int vidx1) {
+        if (vidx0 == vidx1) {
+            edge_is_candidate[eidx] = 0;
+            return;
+        }
+        int count = 0;
+        for (int tidx : vert_to_triangles[vidx0]) {
+            const auto& tria = triangles[tidx];
+            count += !triangles_deleted[tidx] &&
+                     (tria(0) == vidx1 || tria(1) == vidx1 || tria(2) == vidx1);
+        }
+        edge_is_candidate[eidx] = vidx0 < vidx1 || count == 1;
+        edge_costs[eidx] =
+                ComputeEdgeCollapse(Qs, vertices, std::min(vidx0, vidx1),
+                                    std::max(vidx0, vidx1), edge_vbars[eidx]);
+    };
+
+    // Vertices of the triangles around the edge (vidx0, vidx1). Collapses
+    // whose regions are disjoint can be applied concurrently.
+    auto ForEachRegionVertex = [&](int vidx0, int vidx1, auto&& f) {
+        for (int vidx : {vidx0, vidx1}) {
+            for (int tidx : vert_to_triangles[vidx]) {
+                if (triangles_deleted[tidx]) {
+                    continue;
+                }
+                const auto& tria = triangles[tidx];
+                f(tria(0));
+                f(tria(1));
+                f(tria(2));
+            }
+        }
+    };
+
+    // Returns true if moving the vertices vidx0 and vidx1 to vbar flips the
+    // normal of one of their triangles that does not contain the edge.
+    auto IsFlipped = [&](int vidx0, int vidx1, const Eigen::Vector3d& vbar) {
+        for (int vidx : {vidx0, vidx1}) {
+            for (int tidx : vert_to_triangles[vidx]) {
+                if (triangles_deleted[tidx]) {
+                    continue;
+                }
+                const Eigen::Vector3i& tria = triangles[tidx];
+                bool has_vidx0 = vidx0 == tria(0) || vidx0 == tria(1) ||
+                                 vidx0 == tria(2);
+                bool has_vidx1 = vidx1 == tria(0) || vidx1 == tria(1) ||
+                                 vidx1 == tria(2);
+                if (has_vidx0 && has_vidx1) {
+                    continue;
+                }
+                Eigen::Vector3d verts[3];
+                Eigen::Vector3d verts_after[3];
+                for (int k = 0; k < 3; ++k) {
+                    verts[k] = vertices[tria(k)];
+                    verts_after[k] = tria(k) == vidx ? vbar : verts[k];
+                }
+                Eigen::Vector3d norm_before =
+                        (verts[1] - verts[0]).cross(verts[2] - verts[0]);
+                Eigen::Vector3d norm_after =
+                        (verts_after[1] - verts_after[0])
+                                .cross(verts_after[2] - verts_after[0]);
+                if (norm_before.dot(norm_after) < 0) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    constexpr int kUnclaimed = std::numeric_limits<int>::max();
+    constexpr int kLocked = -1;
+    constexpr int kClaimPasses = 2;
+    std::vector<std::atomic<int>> claims(num_vertices);
+#pragma omp parallel for schedule(static)
+    for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+        claims[vidx].store(kUnclaimed);
+    }
+
+    bool has_vert_normal = HasVertexNormals();
+    bool has_vert_color = HasVertexColors();
+    int64_t n_triangles = num_triangles;
+    std::vector<int> candidates;
+    std::vector<int> priorities;
+    std::vector<int> removed;
+    std::vector<uint8_t> decided;
+    int num_rounds = 0;
+    while (n_triangles > target_number_of_triangles) {
+        // Update the costs of edges whose end points have changed
+#pragma omp parallel for schedule(static)
+        for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
+            if (!triangles_dirty[tidx] || triangles_deleted[tidx]) {
+                continue;
+            }
+            const auto& tria = triangles[tidx];
+            for (int k = 0; k < 3; ++k) {
+                UpdateEdge(3 * tidx + k, tria(k), tria((k + 1) % 3));
+            }
+            triangles_dirty[tidx] = 0;
+        }
+
+        // Collect the edges that may be collapsed
+        candidates.clear();
+#pragma omp parallel
+        {
+            std::vector<int> candidates_private;
+#pragma omp for nowait schedule(static)
+            for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
+                if (triangles_deleted[tidx]) {
+                    continue;
+                }
+                for (int k = 0; k < 3; ++k) {
+                    const int eidx = int(3 * tidx + k);
+                    if (edge_is_candidate[eidx] &&
+                        edge_costs[eidx] <= maximum_error) {
+                        candidates_private.push_back(eidx);
+                    }
+                }
+            }
+#pragma omp critical
+            {
+                candidates.insert(candidates.end(), candidates_private.begin(),
+                                  candidates_private.end());
+            }
+        }
+        if (candidates.empty()) {
+            break;
+        }
+
+        // Take the cheapest edges of this round, ordered by cost and index so
+        // that the result does not depend on the number of threads. Roughly
+        // one in kBatchRatio edges is taken, but not more than needed to reach
+        // the target.
+        auto EdgeLess = [&](int eidx0, int eidx1) {
+            return edge_costs[eidx0] < edge_costs[eidx1] ||
+                   (edge_costs[eidx0] == edge_costs[eidx1] && eidx0 < eidx1);
+        };
+        constexpr int64_t kBatchRatio = 16;
+        const int64_t batch_size = std::max<int64_t>(
+                1, std::min<int64_t>(
+                           int64_t(candidates.size()) / kBatchRatio,
+                           (n_triangles - target_number_of_triangles + 1) / 2));
+        std::nth_element(candidates.begin(),
+                         candidates.begin() + batch_size - 1, candidates.end(),
+                         EdgeLess);
+        candidates.resize(batch_size);
+        tbb::parallel_sort(candidates.begin(), candidates.end(), EdgeLess);
+
+        // Select edges with disjoint regions in a few passes. In each pass,
+        // every vertex is claimed by the undecided edge of the highest
+        // priority whose region contains it, and an edge is selected if it
+        // holds all claims in its region. The regions of selected edges are
+        // locked, which drops the edges overlapping them. Priorities are a
+        // random permutation of the batch: ordering by cost instead would let
+        // chains of overlapping edges with increasing costs block all but one
+        // of them.
+        priorities.resize(batch_size);
+        std::iota(priorities.begin(), priorities.end(), 0);
+        std::shuffle(priorities.begin(), priorities.end(),
+                     std::mt19937(num_rounds));
+        removed.assign(batch_size, 0);
+        decided.assign(batch_size, 0);
+        int64_t num_flipped = 0;
+        auto ForEachCandidateVertex = [&](int64_t rank, auto&& f) {
+            const int eidx = candidates[rank];
+            const auto& tria = triangles[eidx / 3];
+            ForEachRegionVertex(tria(eidx % 3), tria((eidx % 3 + 1) % 3), f);
+        };
+        for (int pass = 0; pass < kClaimPasses; ++pass) {
+#pragma omp parallel for schedule(static)
+            for (int64_t rank = 0; rank < batch_size; ++rank) {
+                if (decided[rank]) {
+                    continue;
+                }
+                bool blocked = false;
+                ForEachCandidateVertex(rank, [&](int vidx) {
+                    blocked = blocked || claims[vidx].load() == kLocked;
+                });
+                if (blocked) {
+                    decided[rank] = 1;
+                    continue;
+                }
+                const int priority = priorities[rank];
+                ForEachCandidateVertex(rank, [&](int vidx) {
+                    int claim = claims[vidx].load();
+                    while (priority < claim &&
+                           !claims[vidx].compare_exchange_weak(claim,
+                                                               priority)) {
+                    }
+                });
+            }
+#pragma omp parallel for reduction(+ : num_flipped) schedule(static)
+            for (int64_t rank = 0; rank < batch_size; ++rank) {
+                if (decided[rank]) {
+                    continue;
+                }
+                bool owned = true;
+                bool blocked = false;
+                ForEachCandidateVertex(rank, [&](int vidx) {
+                    const int claim = claims[vidx].load();
+                    owned = owned && claim == priorities[rank];
+                    blocked = blocked || claim == kLocked;
+                });
+                if (!owned && !blocked) {
+                    continue;
+                }
+                decided[rank] = 1;
+                if (blocked) {
+                    continue;
+                }
+                const int eidx = candidates[rank];
+                const auto& tria = triangles[eidx / 3];
+                const int vidx0 =
+                        std::min(tria(eidx % 3), tria((eidx % 3 + 1) % 3));
+                const int vidx1 =
+                        std::max(tria(eidx % 3), tria((eidx % 3 + 1) % 3));
+                if (IsFlipped(vidx0, vidx1, edge_vbars[eidx])) {
+                    // Skip the edge until one of its triangles is updated
+                    edge_is_candidate[eidx] = 0;
+                    num_flipped++;
+                    continue;
+                }
+                for (int tidx : vert_to_triangles[vidx1]) {
+                    const auto& other_tria = triangles[tidx];
+                    removed[rank] += !triangles_deleted[tidx] &&
+                                     (other_tria(0) == vidx0 ||
+                                      other_tria(1) == vidx0 ||
+                                      other_tria(2) == vidx0);
+                }
+            }
+#pragma omp parallel for schedule(static)
+            for (int64_t rank = 0; rank < batch_size; ++rank) {
+                if (removed[rank] == 0) {
+                    ForEachCandidateVertex(rank, [&](int vidx) {
+                        if (claims[vidx].load() != kLocked) {
+                            claims[vidx].store(kUnclaimed);
+                        }
+                    });
+                }
+            }
+#pragma omp parallel for schedule(static)
+            for (int64_t rank = 0; rank < batch_size; ++rank) {
+                if (removed[rank] > 0) {
+                    ForEachCandidateVertex(rank, [&](int vidx) {
+                        claims[vidx].store(kLocked);
+                    });
+                }
+            }
+        }
+#pragma omp parallel for schedule(static)
+        for (int64_t rank = 0; rank < batch_size; ++rank) {
+            ForEachCandidateVertex(rank, [&](int vidx) {
+                claims[vidx].store(kUnclaimed);
+            });
+        }
+
+        // Do not collapse more edges than needed to reach the target
+        int64_t num_removed = 0;
+        for (int64_t rank = 0; rank < batch_size; ++rank) {
+            if (n_triangles - num_removed <= target_number_of_triangles) {
+                removed[rank] = 0;
+            }
+            num_removed += removed[rank];
+        }
+        n_triangles -= num_removed;
+
+        // Collapse the selected edges concurrently, vidx1 into vidx0
+#pragma omp parallel for schedule(static)
+        for (int64_t rank = 0; rank < batch_size; ++rank) {
+            if (removed[rank] == 0) {
+                continue;
+            }
+            const int eidx = candidates[rank];
+            const Eigen::Vector3i& edge_tria = triangles[eidx / 3];
+            const int vidx0 = std::min(edge_tria(eidx % 3),
+                                       edge_tria((eidx % 3 + 1) % 3));
+            const int vidx1 = std::max(edge_tria(eidx % 3),
+                                       edge_tria((eidx % 3 + 1) % 3));
+            const Eigen::Vector3d vbar = edge_vbars[eidx];
+
+            std::vector<int>& triangles0 = vert_to_triangles[vidx0];
+            std::vector<int>& triangles1 = vert_to_triangles[vidx1];
+            for (int tidx : triangles1) {
+                if (triangles_deleted[tidx]) {
+                    continue;
+                }
+                Eigen::Vector3i& tria = triangles[tidx];
+                if (tria(0) == vidx0 || tria(1) == vidx0 || tria(2) == vidx0) {
+                    triangles_deleted[tidx] = 1;
+                    continue;
+                }
+                for (int k = 0; k < 3; ++k) {
+                    if (tria(k) == vidx1) {
+                        tria(k) = vidx0;
+                    }
+                }
+                triangles0.push_back(tidx);
+            }
+            triangles0.erase(
+                    std::remove_if(triangles0.begin(), triangles0.end(),
+                                   [&](int tidx) {
+                                       return triangles_deleted[tidx] != 0;
+                                   }),
+                    triangles0.end());
+            std::vector<int>().swap(triangles1);
+            for (int tidx : triangles0) {
+                triangles_dirty[tidx] = 1;
+            }
+
+            vertices[vidx0] = vbar;
+            Qs[vidx0] += Qs[vidx1];
+            if (has_vert_normal) {
+                mesh->vertex_normals_[vidx0] =
+                        0.5 * (mesh->vertex_normals_[vidx0] +
+                               mesh->vertex_normals_[vidx1]);
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[vidx0] =
+                        0.5 * (mesh->vertex_colors_[vidx0] +
+                               mesh->vertex_colors_[vidx1]);
+            }
+            vertices_deleted[vidx1] = 1;
+        }
+        num_rounds++;
+
+        // Every round either removes triangles or drops flipped candidates,
+        // so this only guards against a round that makes no progress
+        if (num_removed == 0 && num_flipped == 0) {
+            break;
+        }
+    }
+    utility::LogDebug(
+            "[SimplifyQuadricDecimationParallel] {:d} rounds, {:d} triangles "
+            "left.",
+            num_rounds, n_triangles);
+
+    // Apply changes to the triangle mesh
+    std::vector<int> vert_remapping(num_vertices, -1);
+    int next_free = 0;
+    for (int64_t idx = 0; idx < num_vertices; ++idx) {
+        if (!vertices_deleted[idx]) {
+            vert_remapping[idx] = next_free;
+            vertices[next_free] = vertices[idx];
+            if (has_vert_normal) {
+                mesh->vertex_normals_[next_free] = mesh->vertex_normals_[idx];
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[next_free] = mesh->vertex_colors_[idx];
+            }
+            next_free++;
+        }
+    }
+    vertices.resize(next_free);
+    if (has_vert_normal) {
+        mesh->vertex_normals_.resize(next_free);
+    }
+    if (has_vert_color) {
+        mesh->vertex_colors_.resize(next_free);
+    }
+
+    next_free = 0;
+    for (int64_t idx = 0; idx < num_triangles; ++idx) {
+        if (!triangles_deleted[idx]) {
+            const Eigen::Vector3i tria = triangles[idx];
+            triangles[next_free](0) = vert_remapping[tria(0)];
+            triangles[next_free](1) = vert_remapping[tria(1)];
+            triangles[next_free](2) = vert_remapping[tria(2)];
+            next_free++;
+        }
+    }
+    triangles.resize(next_free);
+
+    if (HasTriangleNormals()) {
+        mesh->ComputeTriangleNormals();
+    }
+
+    return mesh;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -26,6 +26,7 @@
 
 #include "open3d/geometry/VoxelGrid.h"
 
+#include <limits>
 #include <numeric>
 #include <unordered_map>
 
@@ -39,6 +40,19 @@
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Hash of a grid index for FlatVoxelGrid. The multiplicative mixing spreads
+/// neighboring indices over the whole table.
+inline size_t HashGridIndex(const Eigen::Vector3i &grid_index) {
+    uint64_t h = uint64_t(uint32_t(grid_index(0))) * 0x9E3779B97F4A7C15ULL ^
+                 uint64_t(uint32_t(grid_index(1))) * 0xC2B2AE3D27D4EB4FULL ^
+                 uint64_t(uint32_t(grid_index(2))) * 0x165667B19E3779F9ULL;
+    return size_t(h ^ (h >> 32));
+}
+
+}  // unnamed namespace
+
 VoxelGrid::VoxelGrid(const VoxelGrid &src_voxel_grid)
     : Geometry3D(Geometry::GeometryType::VoxelGrid),
       voxel_size_(src_voxel_grid.voxel_size_),
@@ -212,16 +226,18 @@ void VoxelGrid::AddVoxel(const Voxel &voxel) {
 }
 
 std::vector<bool> VoxelGrid::CheckIfIncluded(
-        const std::vector<Eigen::Vector3d> &queries) {
-    std::vector<bool> output;
-    output.resize(queries.size());
-    size_t i = 0;
-    for (auto &query_double : queries) {
-        auto query = GetVoxel(query_double);
-        output[i] = voxels_.count(query) > 0;
-        i++;
+        const std::vector<Eigen::Vector3d> &queries) const {
+    // Building the flat copy costs about one hash map lookup per voxel, which
+    // pays off once there are more queries than voxels.
+    if (queries.size() >= voxels_.size()) {
+        return FlatVoxelGrid(*this).CheckIfIncluded(queries);
     }
-    return output;
+    std::vector<uint8_t> included(queries.size());
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < int64_t(queries.size()); i++) {
+        included[i] = voxels_.count(GetVoxel(queries[i])) > 0;
+    }
+    return std::vector<bool>(included.begin(), included.end());
 }
 
 void VoxelGrid::CreateFromOctree(const Octree &octree) {
@@ -287,9 +303,7 @@ VoxelGrid &VoxelGrid::CarveDepthMap(
 
     // get for each voxel if it projects to a valid pixel and check if the voxel
     // depth is behind the depth of the depth map at the projected pixel.
-    for (auto it = voxels_.begin(); it != voxels_.end();) {
-        bool carve = true;
-        const geometry::Voxel &voxel = it->second;
+    return CarveVoxels([&](const Voxel &voxel) -> bool {
         auto pts = GetVoxelBoundingPoints(voxel.grid_index_);
         for (auto &x : pts) {
             auto x_trans = rot * x + trans;
@@ -302,16 +316,11 @@ VoxelGrid &VoxelGrid::CarveDepthMap(
             std::tie(within_boundary, d) = depth_map.FloatValueAt(u, v);
             if ((!within_boundary && keep_voxels_outside_image) ||
                 (within_boundary && d > 0 && z >= d)) {
-                carve = false;
-                break;
+                return true;
             }
         }
-        if (carve)
-            it = voxels_.erase(it);
-        else
-            it++;
-    }
-    return *this;
+        return false;
+    });
 }
 
 VoxelGrid &VoxelGrid::CarveSilhouette(
@@ -331,9 +340,7 @@ VoxelGrid &VoxelGrid::CarveSilhouette(
 
     // get for each voxel if it projects to a valid pixel and check if the pixel
     // is set (>0).
-    for (auto it = voxels_.begin(); it != voxels_.end();) {
-        bool carve = true;
-        const geometry::Voxel &voxel = it->second;
+    return CarveVoxels([&](const Voxel &voxel) -> bool {
         auto pts = GetVoxelBoundingPoints(voxel.grid_index_);
         for (auto &x : pts) {
             auto x_trans = rot * x + trans;
@@ -346,14 +353,31 @@ VoxelGrid &VoxelGrid::CarveSilhouette(
             std::tie(within_boundary, d) = silhouette_mask.FloatValueAt(u, v);
             if ((!within_boundary && keep_voxels_outside_image) ||
                 (within_boundary && d > 0)) {
-                carve = false;
-                break;
+                return true;
             }
         }
-        if (carve)
-            it = voxels_.erase(it);
-        else
-            it++;
+        return false;
+    });
+}
+
+VoxelGrid &VoxelGrid::CarveVoxels(
+        const std::function<bool(const Voxel &)> &f_keep) {
+    std::vector<const Voxel *> voxels;
+    voxels.reserve(voxels_.size());
+    for (const auto &it : voxels_) {
+        voxels.push_back(&it.second);
+    }
+    std::vector<uint8_t> keep(voxels.size());
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < int64_t(voxels.size()); i++) {
+        keep[i] = f_keep(*voxels[i]);
+    }
+    for (size_t i = 0; i < voxels.size(); i++) {
+        if (!keep[i]) {
+            // Copy the key, it must not refer into the erased element
+            Eigen::Vector3i grid_index = voxels[i]->grid_index_;
+            voxels_.erase(grid_index);
+        }
     }
     return *this;
 }
@@ -367,5 +391,89 @@ std::vector<Voxel> VoxelGrid::GetVoxels() const {
     return result;
 }
 
+FlatVoxelGrid::FlatVoxelGrid(const VoxelGrid &voxel_grid)
+    : voxel_size_(voxel_grid.voxel_size_), origin_(voxel_grid.origin_) {
+    if (voxel_grid.voxels_.size() >
+        size_t(std::numeric_limits<int32_t>::max())) {
+        utility::LogError("[FlatVoxelGrid] too many voxels: {}.",
+                          voxel_grid.voxels_.size());
+    }
+    const size_t num_voxels = voxel_grid.voxels_.size();
+    grid_indices_.reserve(num_voxels);
+    colors_r_.reserve(num_voxels);
+    colors_g_.reserve(num_voxels);
+    colors_b_.reserve(num_voxels);
+    for (const auto &it : voxel_grid.voxels_) {
+        grid_indices_.push_back(it.first);
+        colors_r_.push_back(it.second.color_(0));
+        colors_g_.push_back(it.second.color_(1));
+        colors_b_.push_back(it.second.color_(2));
+    }
+
+    size_t table_size = 16;
+    while (table_size < 2 * num_voxels) {
+        table_size *= 2;
+    }
+    hash_table_.assign(table_size, {Eigen::Vector3i::Zero(), -1});
+    const size_t mask = table_size - 1;
+    for (size_t i = 0; i < num_voxels; i++) {
+        size_t slot = HashGridIndex(grid_indices_[i]) & mask;
+        while (hash_table_[slot].index_ >= 0) {
+            slot = (slot + 1) & mask;
+        }
+        hash_table_[slot].grid_index_ = grid_indices_[i];
+        hash_table_[slot].index_ = int32_t(i);
+    }
+}
+
+int64_t FlatVoxelGrid::Find(const Eigen::Vector3i &grid_index) const {
+    if (hash_table_.empty()) {
+        return -1;
+    }
+    const size_t mask = hash_table_.size() - 1;
+    for (size_t slot = HashGridIndex(grid_index) & mask;;
+         slot = (slot + 1) & mask) {
+        const HashEntry &entry = hash_table_[slot];
+        if (entry.index_ < 0) {
+            return -1;
+        }
+        if (entry.grid_index_ == grid_index) {
+            return entry.index_;
+        }
+    }
+}
+
+std::vector<int64_t> FlatVoxelGrid::FindVoxels(
+        const std::vector<Eigen::Vector3d> &queries) const {
+    std::vector<int64_t> indices(queries.size());
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < int64_t(queries.size()); i++) {
+        Eigen::Vector3d voxel_f = (queries[i] - origin_) / voxel_size_;
+        indices[i] = Find((Eigen::floor(voxel_f.array())).cast<int>());
+    }
+    return indices;
+}
+
+std::vector<bool> FlatVoxelGrid::CheckIfIncluded(
+        const std::vector<Eigen::Vector3d> &queries) const {
+    std::vector<int64_t> indices = FindVoxels(queries);
+    std::vector<bool> output(queries.size());
+    for (size_t i = 0; i < indices.size(); i++) {
+        output[i] = indices[i] >= 0;
+    }
+    return output;
+}
+
+std::shared_ptr<VoxelGrid> FlatVoxelGrid::ToVoxelGrid() const {
+    auto voxel_grid = std::make_shared<VoxelGrid>();
+    voxel_grid->voxel_size_ = voxel_size_;
+    voxel_grid->origin_ = origin_;
+    voxel_grid->voxels_.reserve(Size());
+    for (size_t i = 0; i < Size(); i++) {
+        voxel_grid->AddVoxel(Voxel(grid_indices_[i], GetColor(i)));
+    }
+    return voxel_grid;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -27,6 +27,8 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -135,8 +137,10 @@ public:
 
     /// Element-wise check if a query in the list is included in the VoxelGrid
     /// Queries are double precision and are mapped to the closest voxel.
+    /// Queries are processed in parallel; large batches are answered from a
+    /// FlatVoxelGrid built for the call.
     std::vector<bool> CheckIfIncluded(
-            const std::vector<Eigen::Vector3d> &queries);
+            const std::vector<Eigen::Vector3d> &queries) const;
 
     /// Remove all voxels from the VoxelGrid where none of the boundary points
     /// of the voxel projects to depth value that is smaller, or equal than the
@@ -245,6 +249,10 @@ public:
     /// the voxel grid.
     std::vector<Voxel> GetVoxels() const;
 
+protected:
+    /// Removes, in parallel, the voxels for which f_keep returns false.
+    VoxelGrid &CarveVoxels(const std::function<bool(const Voxel &)> &f_keep);
+
 public:
     /// Size of the voxel.
     double voxel_size_ = 0.0;
@@ -257,6 +265,76 @@ public:
             voxels_;
 };
 
+/// \class FlatVoxelGrid
+///
+/// \brief Read-only copy of a VoxelGrid in flat arrays, for fast batched and
+/// multi-threaded occupancy queries.
+///
+/// Grid indices are stored in one array and colors in one array per channel.
+/// The grid indices are hashed into an open addressing table with linear
+/// probing, so a lookup reads one contiguous probe sequence instead of
+/// following the bucket list of an unordered_map. Changes to the source
+/// VoxelGrid after construction are not reflected.
+class FlatVoxelGrid {
+public:
+    /// \brief Default Constructor.
+    FlatVoxelGrid() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param voxel_grid The voxel grid to copy.
+    explicit FlatVoxelGrid(const VoxelGrid &voxel_grid);
+
+public:
+    /// Number of voxels.
+    size_t Size() const { return grid_indices_.size(); }
+    bool IsEmpty() const { return grid_indices_.empty(); }
+
+    /// Returns the position of the voxel with the given grid index in
+    /// grid_indices_, or -1 if there is no such voxel.
+    int64_t Find(const Eigen::Vector3i &grid_index) const;
+
+    /// Returns for each query point the position of the voxel containing it,
+    /// or -1. Points are mapped to voxels as in VoxelGrid::GetVoxel. Queries
+    /// are processed in parallel.
+    std::vector<int64_t> FindVoxels(
+            const std::vector<Eigen::Vector3d> &queries) const;
+
+    /// Element-wise check if a query in the list is included in the voxel
+    /// grid. Same as VoxelGrid::CheckIfIncluded.
+    std::vector<bool> CheckIfIncluded(
+            const std::vector<Eigen::Vector3d> &queries) const;
+
+    /// Returns the color of the voxel at the given position.
+    Eigen::Vector3d GetColor(size_t index) const {
+        return Eigen::Vector3d(colors_r_[index], colors_g_[index],
+                               colors_b_[index]);
+    }
+
+    /// Convert back to VoxelGrid.
+    std::shared_ptr<VoxelGrid> ToVoxelGrid() const;
+
+public:
+    /// Size of the voxel.
+    double voxel_size_ = 0.0;
+    /// Coorindate of the origin point.
+    Eigen::Vector3d origin_ = Eigen::Vector3d::Zero();
+    /// Grid indices of the voxels.
+    std::vector<Eigen::Vector3i> grid_indices_;
+    /// Color channels of the voxels.
+    std::vector<double> colors_r_;
+    std::vector<double> colors_g_;
+    std::vector<double> colors_b_;
+
+private:
+    struct HashEntry {
+        Eigen::Vector3i grid_index_;
+        /// Position in grid_indices_, -1 for an empty slot.
+        int32_t index_;
+    };
+    /// Open addressing table of power of two size, at most half full.
+    std::vector<HashEntry> hash_table_;
+};
+
 /// \class AvgColorVoxel
 ///
 /// \brief Class to aggregate color values from different votes in one voxel
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
 #include <numeric>
 #include <unordered_map>
 
@@ -76,29 +78,58 @@ std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromPointCloudWithinBounds(
     }
     output->voxel_size_ = voxel_size;
     output->origin_ = min_bound;
-    std::unordered_map<Eigen::Vector3i, AvgColorVoxel,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    bool has_colors = input.HasColors();
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        ref_coord = (input.points_[i] - min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
+
+    // Sort the points by voxel and average the colors of each run of equal
+    // voxels. Ties are broken by point index, so colors are summed in the
+    // same order as the sequential AvgColorVoxel accumulation.
+    struct PointVoxel {
+        Eigen::Vector3i voxel_index_;
+        int64_t point_index_;
+    };
+    const int64_t num_points = int64_t(input.points_.size());
+    std::vector<PointVoxel> point_voxels(num_points);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; i++) {
+        Eigen::Vector3d ref_coord = (input.points_[i] - min_bound) / voxel_size;
+        point_voxels[i].voxel_index_ << int(floor(ref_coord(0))),
+                int(floor(ref_coord(1))), int(floor(ref_coord(2)));
+        point_voxels[i].point_index_ = i;
+    }
+    tbb::parallel_sort(point_voxels.begin(), point_voxels.end(),
+                       [](const PointVoxel &a, const PointVoxel &b) {
+                           const Eigen::Vector3i &va = a.voxel_index_;
+                           const Eigen::Vector3i &vb = b.voxel_index_;
+                           if (va(2) != vb(2)) return va(2) < vb(2);
+                           if (va(1) != vb(1)) return va(1) < vb(1);
+                           if (va(0) != vb(0)) return va(0) < vb(0);
+                           return a.point_index_ < b.point_index_;
+                       });
+    std::vector<int64_t> run_begins;
+    for (int64_t i = 0; i < num_points; i++) {
+        if (i == 0 || point_voxels[i].voxel_index_ !=
+                              point_voxels[i - 1].voxel_index_) {
+            run_begins.push_back(i);
+        }
+    }
+    run_begins.push_back(num_points);
+
+    const bool has_colors = input.HasColors();
+    const int64_t num_voxels = int64_t(run_begins.size()) - 1;
+    std::vector<Voxel> voxels(num_voxels);
+#pragma omp parallel for schedule(static)
+    for (int64_t v = 0; v < num_voxels; v++) {
+        Eigen::Vector3d color(0, 0, 0);
         if (has_colors) {
-            voxelindex_to_accpoint[voxel_index].Add(voxel_index,
-                                                    input.colors_[i]);
-        } else {
-            voxelindex_to_accpoint[voxel_index].Add(voxel_index);
+            for (int64_t i = run_begins[v]; i < run_begins[v + 1]; i++) {
+                color += input.colors_[point_voxels[i].point_index_];
+            }
+            color /= double(run_begins[v + 1] - run_begins[v]);
         }
+        voxels[v] = Voxel(point_voxels[run_begins[v]].voxel_index_, color);
     }
-    for (auto accpoint : voxelindex_to_accpoint) {
-        const Eigen::Vector3i &grid_index = accpoint.second.GetVoxelIndex();
-        const Eigen::Vector3d &color =
-                has_colors ? accpoint.second.GetAverageColor()
-                           : Eigen::Vector3d(0, 0, 0);
-        output->AddVoxel(geometry::Voxel(grid_index, color));
+    output->voxels_.reserve(voxels.size());
+    for (const Voxel &voxel : voxels) {
+        output->AddVoxel(voxel);
     }
     utility::LogDebug(
             "Pointcloud is voxelized from {:d} points to {:d} voxels.",
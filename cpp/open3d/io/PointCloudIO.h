@@ -67,6 +67,12 @@ struct ReadPointCloudOption {
     bool remove_nan_points;
     /// Whether to remove all points that have +-inf
     bool remove_infinite_points;
+    /// Whether to load normals if the file has them. Currently only the PCD
+    /// reader skips decoding the normal fields when this is false.
+    bool read_normals = true;
+    /// Whether to load colors if the file has them. Currently only the PCD
+    /// reader skips decoding the color fields when this is false.
+    bool read_colors = true;
     /// Print progress to stdout about loading progress.
     /// Also see \p update_progress if you want to have your own progress
     /// indicators or to be able to cancel loading.
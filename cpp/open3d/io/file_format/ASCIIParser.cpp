@@ -0,0 +1,196 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/file_format/ASCIIParser.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+
+namespace open3d {
+namespace io {
+
+static inline bool IsBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+static inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+/// Parses the token at \p begin with strtod() for everything the fast path of
+/// ParseASCIIDouble() does not handle, e.g. inf, nan, hexadecimal numbers and
+/// numbers with more than 19 significant digits.
+static const char *ParseASCIIDoubleSlow(const char *begin,
+                                        const char *end,
+                                        double &value) {
+    char buffer[128];
+    size_t size = 0;
+    while (begin + size < end && !IsBlank(begin[size]) &&
+           size + 1 < sizeof(buffer)) {
+        ++size;
+    }
+    std::memcpy(buffer, begin, size);
+    buffer[size] = '\0';
+    char *parse_end = nullptr;
+    value = std::strtod(buffer, &parse_end);
+    if (parse_end == buffer) {
+        return nullptr;
+    }
+    return begin + (parse_end - buffer);
+}
+
+const char *ParseASCIIDouble(const char *begin,
+                             const char *end,
+                             double &value) {
+    // Exactly representable powers of 10.
+    static const double kPowersOf10[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+            1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+            1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    const char *p = begin;
+    while (p < end && IsBlank(*p)) {
+        ++p;
+    }
+    const char *token = p;
+    bool negative = false;
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = *p == '-';
+        ++p;
+    }
+
+    // The number is mantissa * 10^exponent, with at most 19 significant
+    // digits in the mantissa.
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    bool exact = true;
+    bool has_digits = false;
+    for (; p < end && IsDigit(*p); ++p) {
+        has_digits = true;
+        if (num_digits < 19) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+            num_digits += mantissa != 0;
+        } else {
+            ++exponent;
+            exact &= *p == '0';
+        }
+    }
+    if (p < end && *p == '.') {
+        ++p;
+        for (; p < end && IsDigit(*p); ++p) {
+            has_digits = true;
+            if (num_digits < 19) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                num_digits += mantissa != 0;
+                --exponent;
+            } else {
+                exact &= *p == '0';
+            }
+        }
+    }
+    if (!has_digits || (p < end && (*p == 'x' || *p == 'X'))) {
+        return ParseASCIIDoubleSlow(token, end, value);
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char *q = p + 1;
+        bool exponent_negative = false;
+        if (q < end && (*q == '+' || *q == '-')) {
+            exponent_negative = *q == '-';
+            ++q;
+        }
+        // Without digits, 'e' is not part of the number.
+        if (q < end && IsDigit(*q)) {
+            int e = 0;
+            for (; q < end && IsDigit(*q); ++q) {
+                if (e < 100000) {
+                    e = e * 10 + (*q - '0');
+                }
+            }
+            exponent += exponent_negative ? -e : e;
+            p = q;
+        }
+    }
+
+    if (exact && mantissa == 0) {
+        value = negative ? -0.0 : 0.0;
+        return p;
+    }
+    // Both the mantissa and the power of 10 are exact doubles, so a single
+    // multiplication or division is correctly rounded.
+    if (exact && mantissa <= (uint64_t(1) << 53) && exponent >= -22 &&
+        exponent <= 22) {
+        double v = static_cast<double>(mantissa);
+        v = exponent < 0 ? v / kPowersOf10[-exponent]
+                         : v * kPowersOf10[exponent];
+        value = negative ? -v : v;
+        return p;
+    }
+    return ParseASCIIDoubleSlow(token, end, value);
+}
+
+const char *ParseASCIIInt(const char *begin, const char *end, int &value) {
+    const char *p = begin;
+    while (p < end && IsBlank(*p)) {
+        ++p;
+    }
+    bool negative = false;
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = *p == '-';
+        ++p;
+    }
+    if (p == end || !IsDigit(*p)) {
+        return nullptr;
+    }
+    int64_t v = 0;
+    for (; p < end && IsDigit(*p); ++p) {
+        if (v <= INT_MAX) {
+            v = v * 10 + (*p - '0');
+        }
+    }
+    v = negative ? -v : v;
+    value = static_cast<int>(
+            std::max<int64_t>(INT_MIN, std::min<int64_t>(INT_MAX, v)));
+    return p;
+}
+
+std::vector<std::pair<const char *, const char *>> SplitASCIILines(
+        const char *begin, const char *end, int64_t chunk_size) {
+    std::vector<std::pair<const char *, const char *>> chunks;
+    while (begin < end) {
+        const char *chunk_end = end;
+        if (end - begin > chunk_size) {
+            const char *line_break = static_cast<const char *>(std::memchr(
+                    begin + chunk_size, '\n', end - begin - chunk_size));
+            chunk_end = line_break == nullptr ? end : line_break + 1;
+        }
+        chunks.emplace_back(begin, chunk_end);
+        begin = chunk_end;
+    }
+    return chunks;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,178 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace open3d {
+namespace io {
+
+/// Parses a floating point number like strtod(), starting at \p begin and not
+/// reading past \p end. Leading blanks are skipped. Plain decimal numbers with
+/// up to 19 significant digits are converted without calling into libc.
+///
+/// \return Pointer past the number, or nullptr if there is no number.
+const char *ParseASCIIDouble(const char *begin, const char *end, double &value);
+
+/// Parses a decimal integer like strtol(), see ParseASCIIDouble().
+const char *ParseASCIIInt(const char *begin, const char *end, int &value);
+
+/// Parses \p num_values numbers separated by blanks at the beginning of
+/// [begin, end). Like sscanf(), anything after the numbers is ignored.
+///
+/// \return false if fewer than \p num_values numbers were found.
+inline bool ParseASCIIDoubles(const char *begin,
+                              const char *end,
+                              int num_values,
+                              double *values) {
+    for (int i = 0; i < num_values; ++i) {
+        begin = ParseASCIIDouble(begin, end, values[i]);
+        if (begin == nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Splits [begin, end) into consecutive ranges of whole lines of about
+/// \p chunk_size bytes each.
+std::vector<std::pair<const char *, const char *>> SplitASCIILines(
+        const char *begin, const char *end, int64_t chunk_size);
+
+/// Parses the lines of [begin, end) in parallel.
+///
+/// \p parse_line(line_begin, line_end, values) is called for every line,
+/// excluding the line break, and returns true if the line is a record, in
+/// which case it has written \p num_values doubles to values.
+///
+/// The records of each chunk of lines are written to \p records, in file
+/// order, with \p num_values doubles per record.
+///
+/// \p update_progress(num_bytes), if set, is called every 1000 lines with the
+/// number of bytes parsed so far, one call at a time. Returning false cancels
+/// the parsing.
+///
+/// \return false if the parsing was cancelled, true otherwise.
+template <typename ParseLine>
+bool ParseASCIILines(
+        const char *begin,
+        const char *end,
+        int num_values,
+        ParseLine parse_line,
+        std::vector<std::vector<double>> &records,
+        const std::function<bool(int64_t)> &update_progress = nullptr) {
+    const int64_t chunk_size = 4 << 20;
+    const int64_t lines_per_update = 1000;
+    const std::vector<std::pair<const char *, const char *>> chunks =
+            SplitASCIILines(begin, end, chunk_size);
+    records.clear();
+    records.resize(chunks.size());
+    std::atomic<bool> cancelled(false);
+    int64_t num_parsed_bytes = 0;
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t c = 0; c < static_cast<int64_t>(chunks.size()); ++c) {
+        std::vector<double> &chunk_records = records[c];
+        const char *line = chunks[c].first;
+        const char *chunk_end = chunks[c].second;
+        const char *last_update = line;
+        int64_t num_lines = 0;
+        while (line < chunk_end && !cancelled) {
+            const char *line_end = static_cast<const char *>(
+                    std::memchr(line, '\n', chunk_end - line));
+            const char *next_line;
+            if (line_end == nullptr) {
+                line_end = chunk_end;
+                next_line = chunk_end;
+            } else {
+                next_line = line_end + 1;
+            }
+            size_t size = chunk_records.size();
+            chunk_records.resize(size + num_values);
+            if (!parse_line(line, line_end, chunk_records.data() + size)) {
+                chunk_records.resize(size);
+            }
+            line = next_line;
+
+            if (update_progress && ++num_lines % lines_per_update == 0) {
+#pragma omp critical(ParseASCIILinesProgress)
+                {
+                    num_parsed_bytes += line - last_update;
+                    if (!cancelled && !update_progress(num_parsed_bytes)) {
+                        cancelled = true;
+                    }
+                }
+                last_update = line;
+            }
+        }
+        if (update_progress) {
+#pragma omp critical(ParseASCIILinesProgress)
+            num_parsed_bytes += line - last_update;
+        }
+    }
+    return !cancelled;
+}
+
+/// Returns the number of records parsed by ParseASCIILines().
+inline int64_t CountASCIIRecords(
+        const std::vector<std::vector<double>> &records, int num_values) {
+    int64_t count = 0;
+    for (const std::vector<double> &chunk_records : records) {
+        count += static_cast<int64_t>(chunk_records.size()) / num_values;
+    }
+    return count;
+}
+
+/// Calls \p store(index, values) in parallel for every record returned by
+/// ParseASCIILines(), where index is the position of the record in file order.
+/// Each chunk of records is released once it has been stored.
+template <typename Store>
+void StoreASCIIRecords(std::vector<std::vector<double>> &records,
+                       int num_values,
+                       Store store) {
+    std::vector<int64_t> offsets(records.size() + 1, 0);
+    for (size_t c = 0; c < records.size(); ++c) {
+        offsets[c + 1] = offsets[c] +
+                         static_cast<int64_t>(records[c].size()) / num_values;
+    }
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t c = 0; c < static_cast<int64_t>(records.size()); ++c) {
+        const double *values = records[c].data();
+        for (int64_t i = offsets[c]; i < offsets[c + 1]; ++i) {
+            store(i, values);
+            values += num_values;
+        }
+        std::vector<double>().swap(records[c]);
+    }
+}
+
+}  // namespace io
+}  // namespace open3d
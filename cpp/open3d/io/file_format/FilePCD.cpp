@@ -26,8 +26,10 @@
 
 #include <liblzf/lzf.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <limits>
 #include <sstream>
 
 #include "open3d/io/FileFormatIO.h"
@@ -332,10 +334,84 @@ Eigen::Vector3d UnpackASCIIPCDColor(const char *data_ptr,
     }
 }
 
+// Number of points unpacked per block when reading or writing binary data.
+constexpr int kPCDBinaryBlockSize = 1 << 16;
+
+// A field of the binary data together with the point cloud attribute it is
+// decoded into. component is the coordinate index, or -1 for packed colors.
+struct PCDFieldTarget {
+    const PCLPointField *field;
+    std::vector<Eigen::Vector3d> *attribute;
+    int component;
+    // Byte offset of the first element of the field in the data block.
+    size_t offset;
+};
+
+// Collects the fields that have to be decoded. Fields of attributes that are
+// not requested are skipped, so that they are never unpacked.
+std::vector<PCDFieldTarget> SelectPCDFields(const PCDHeader &header,
+                                            geometry::PointCloud &pointcloud,
+                                            bool read_normals,
+                                            bool read_colors) {
+    static const std::vector<std::string> point_names = {"x", "y", "z"};
+    static const std::vector<std::string> normal_names = {
+            "normal_x", "normal_y", "normal_z"};
+    std::vector<PCDFieldTarget> targets;
+    for (const auto &field : header.fields) {
+        PCDFieldTarget target = {&field, nullptr, 0, 0};
+        for (int k = 0; k < 3; k++) {
+            if (field.name == point_names[k]) {
+                target.attribute = &pointcloud.points_;
+                target.component = k;
+            } else if (read_normals && field.name == normal_names[k]) {
+                target.attribute = &pointcloud.normals_;
+                target.component = k;
+            }
+        }
+        if (read_colors && (field.name == "rgb" || field.name == "rgba")) {
+            target.attribute = &pointcloud.colors_;
+            target.component = -1;
+        }
+        if (target.attribute != nullptr) {
+            targets.push_back(target);
+        }
+    }
+    return targets;
+}
+
+// Decodes num_points points starting at point begin. Element j of a field is
+// read from data + target.offset + j * stride, where stride is the point size
+// for interleaved (binary) data and the field size for column-major
+// (binary_compressed) data.
+void UnpackBinaryPCDBlock(const char *data,
+                          const std::vector<PCDFieldTarget> &targets,
+                          bool column_major,
+                          int pointsize,
+                          int begin,
+                          int num_points) {
+#pragma omp parallel for schedule(static)
+    for (int j = 0; j < num_points; j++) {
+        for (const auto &target : targets) {
+            const PCLPointField &field = *target.field;
+            const size_t stride = column_major ? field.size * field.count
+                                               : (size_t)pointsize;
+            const char *ptr = data + target.offset + j * stride;
+            auto &value = (*target.attribute)[begin + j];
+            if (target.component < 0) {
+                value = UnpackBinaryPCDColor(ptr, field.type, field.size);
+            } else {
+                value(target.component) =
+                        UnpackBinaryPCDElement(ptr, field.type, field.size);
+            }
+        }
+    }
+}
+
 bool ReadPCDData(FILE *file,
                  const PCDHeader &header,
                  geometry::PointCloud &pointcloud,
                  const ReadPointCloudOption &params) {
+    pointcloud.Clear();
     // The header should have been checked
     if (header.has_points) {
         pointcloud.points_.resize(header.points);
@@ -344,10 +420,12 @@ bool ReadPCDData(FILE *file,
                 "[ReadPCDData] Fields for point data are not complete.");
         return false;
     }
-    if (header.has_normals) {
+    const bool read_normals = header.has_normals && params.read_normals;
+    const bool read_colors = header.has_colors && params.read_colors;
+    if (read_normals) {
         pointcloud.normals_.resize(header.points);
     }
-    if (header.has_colors) {
+    if (read_colors) {
         pointcloud.colors_.resize(header.points);
     }
     utility::CountingProgressReporter reporter(params.update_progress);
@@ -378,19 +456,20 @@ bool ReadPCDData(FILE *file,
                     pointcloud.points_[idx](2) = UnpackASCIIPCDElement(
                             strs[field.count_offset].c_str(), field.type,
                             field.size);
-                } else if (field.name == "normal_x") {
+                } else if (read_normals && field.name == "normal_x") {
                     pointcloud.normals_[idx](0) = UnpackASCIIPCDElement(
                             strs[field.count_offset].c_str(), field.type,
                             field.size);
-                } else if (field.name == "normal_y") {
+                } else if (read_normals && field.name == "normal_y") {
                     pointcloud.normals_[idx](1) = UnpackASCIIPCDElement(
                             strs[field.count_offset].c_str(), field.type,
                             field.size);
-                } else if (field.name == "normal_z") {
+                } else if (read_normals && field.name == "normal_z") {
                     pointcloud.normals_[idx](2) = UnpackASCIIPCDElement(
                             strs[field.count_offset].c_str(), field.type,
                             field.size);
-                } else if (field.name == "rgb" || field.name == "rgba") {
+                } else if (read_colors &&
+                           (field.name == "rgb" || field.name == "rgba")) {
                     pointcloud.colors_[idx] = UnpackASCIIPCDColor(
                             strs[field.count_offset].c_str(), field.type,
                             field.size);
@@ -402,48 +481,25 @@ bool ReadPCDData(FILE *file,
             }
         }
     } else if (header.datatype == PCD_DATA_BINARY) {
-        std::unique_ptr<char[]> buffer(new char[header.pointsize]);
-        for (int i = 0; i < header.points; i++) {
-            if (fread(buffer.get(), header.pointsize, 1, file) != 1) {
+        auto targets = SelectPCDFields(header, pointcloud, read_normals,
+                                       read_colors);
+        for (auto &target : targets) {
+            target.offset = target.field->offset;
+        }
+        const int block_size = std::min(kPCDBinaryBlockSize, header.points);
+        std::vector<char> buffer((size_t)block_size * header.pointsize);
+        for (int begin = 0; begin < header.points; begin += block_size) {
+            const int num_points = std::min(block_size, header.points - begin);
+            if (fread(buffer.data(), header.pointsize, num_points, file) !=
+                (size_t)num_points) {
                 utility::LogWarning(
                         "[ReadPCDData] Failed to read data record.");
                 pointcloud.Clear();
                 return false;
             }
-            for (const auto &field : header.fields) {
-                if (field.name == "x") {
-                    pointcloud.points_[i](0) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "y") {
-                    pointcloud.points_[i](1) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "z") {
-                    pointcloud.points_[i](2) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "normal_x") {
-                    pointcloud.normals_[i](0) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "normal_y") {
-                    pointcloud.normals_[i](1) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "normal_z") {
-                    pointcloud.normals_[i](2) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "rgb" || field.name == "rgba") {
-                    pointcloud.colors_[i] =
-                            UnpackBinaryPCDColor(buffer.get() + field.offset,
-                                                 field.type, field.size);
-                }
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+            UnpackBinaryPCDBlock(buffer.data(), targets, false,
+                                 header.pointsize, begin, num_points);
+            reporter.Update(begin + num_points);
         }
     } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
         double reporter_total = 100.0;
@@ -466,6 +522,15 @@ bool ReadPCDData(FILE *file,
                 "PCD data with {:d} compressed size, and {:d} uncompressed "
                 "size.",
                 compressed_size, uncompressed_size);
+        if ((size_t)uncompressed_size <
+            (size_t)header.points * header.pointsize) {
+            utility::LogWarning(
+                    "[ReadPCDData] Uncompressed size {:d} is too small for "
+                    "{:d} points.",
+                    uncompressed_size, header.points);
+            pointcloud.Clear();
+            return false;
+        }
         std::unique_ptr<char[]> buffer_compressed(new char[compressed_size]);
         reporter.Update(int(reporter_total * .1));
         if (fread(buffer_compressed.get(), 1, compressed_size, file) !=
@@ -484,55 +549,16 @@ bool ReadPCDData(FILE *file,
             pointcloud.Clear();
             return false;
         }
-        for (const auto &field : header.fields) {
-            const char *base_ptr = buffer.get() + field.offset * header.points;
-            double progress =
-                    double(base_ptr - buffer.get()) / uncompressed_size;
-            reporter.Update(int(reporter_total * (progress + .2)));
-            if (field.name == "x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "rgb" || field.name == "rgba") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.colors_[i] = UnpackBinaryPCDColor(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            }
+        buffer_compressed.reset();
+        reporter.Update(int(reporter_total * .6));
+        // The decompressed data is stored field by field.
+        auto targets = SelectPCDFields(header, pointcloud, read_normals,
+                                       read_colors);
+        for (auto &target : targets) {
+            target.offset = (size_t)target.field->offset * header.points;
         }
+        UnpackBinaryPCDBlock(buffer.get(), targets, true, header.pointsize, 0,
+                             header.points);
     }
     reporter.Finish();
     return true;
@@ -642,6 +668,41 @@ float ConvertRGBToFloat(const Eigen::Vector3d &color) {
     return value;
 }
 
+// Packs num_points points starting at point begin into buffer as floats in
+// the field order of GenerateHeader(). Element c of point j is stored at
+// buffer[j * point_stride + c * field_stride], i.e. point_stride is the
+// number of elements for interleaved (binary) data and 1 for column-major
+// (binary_compressed) data.
+void PackBinaryPCDBlock(const geometry::PointCloud &pointcloud,
+                        int begin,
+                        int num_points,
+                        size_t point_stride,
+                        size_t field_stride,
+                        float *buffer) {
+    const bool has_normal = pointcloud.HasNormals();
+    const bool has_color = pointcloud.HasColors();
+#pragma omp parallel for schedule(static)
+    for (int j = 0; j < num_points; j++) {
+        float *data = buffer + j * point_stride;
+        const auto &point = pointcloud.points_[begin + j];
+        data[0 * field_stride] = (float)point(0);
+        data[1 * field_stride] = (float)point(1);
+        data[2 * field_stride] = (float)point(2);
+        size_t idx = 3;
+        if (has_normal) {
+            const auto &normal = pointcloud.normals_[begin + j];
+            data[(idx + 0) * field_stride] = (float)normal(0);
+            data[(idx + 1) * field_stride] = (float)normal(1);
+            data[(idx + 2) * field_stride] = (float)normal(2);
+            idx += 3;
+        }
+        if (has_color) {
+            data[idx * field_stride] =
+                    ConvertRGBToFloat(pointcloud.colors_[begin + j]);
+        }
+    }
+}
+
 bool WritePCDData(FILE *file,
                   const PCDHeader &header,
                   const geometry::PointCloud &pointcloud,
@@ -669,62 +730,42 @@ bool WritePCDData(FILE *file,
             }
         }
     } else if (header.datatype == PCD_DATA_BINARY) {
-        std::unique_ptr<float[]> data(new float[header.elementnum]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            data[0] = (float)point(0);
-            data[1] = (float)point(1);
-            data[2] = (float)point(2);
-            int idx = 3;
-            if (has_normal) {
-                const auto &normal = pointcloud.normals_[i];
-                data[idx + 0] = (float)normal(0);
-                data[idx + 1] = (float)normal(1);
-                data[idx + 2] = (float)normal(2);
-                idx += 3;
-            }
-            if (has_color) {
-                const auto &color = pointcloud.colors_[i];
-                data[idx] = ConvertRGBToFloat(color);
-            }
-            fwrite(data.get(), sizeof(float), header.elementnum, file);
-            if (i % 1000 == 0) {
-                reporter.Update(i);
+        const int block_size = std::min(kPCDBinaryBlockSize, header.points);
+        std::vector<float> buffer((size_t)block_size * header.elementnum);
+        for (int begin = 0; begin < header.points; begin += block_size) {
+            const int num_points = std::min(block_size, header.points - begin);
+            PackBinaryPCDBlock(pointcloud, begin, num_points,
+                               header.elementnum, 1, buffer.data());
+            if (fwrite(buffer.data(), sizeof(float) * header.elementnum,
+                       num_points, file) != (size_t)num_points) {
+                utility::LogWarning("[WritePCDData] Failed to write data.");
+                return false;
             }
+            reporter.Update(begin + num_points);
         }
     } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
         double report_total = double(pointcloud.points_.size() * 2);
         // 0%-50% packing into buffer
         // 50%-75% compressing buffer
         // 75%-100% writing compressed buffer
-        reporter.SetTotal(int(report_total));
-        int strip_size = header.points;
-        std::uint32_t buffer_size =
-                (std::uint32_t)(header.elementnum * header.points);
-        std::unique_ptr<float[]> buffer(new float[buffer_size]);
-        std::unique_ptr<float[]> buffer_compressed(new float[buffer_size * 2]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            buffer[0 * strip_size + i] = (float)point(0);
-            buffer[1 * strip_size + i] = (float)point(1);
-            buffer[2 * strip_size + i] = (float)point(2);
-            int idx = 3;
-            if (has_normal) {
-                const auto &normal = pointcloud.normals_[i];
-                buffer[(idx + 0) * strip_size + i] = (float)normal(0);
-                buffer[(idx + 1) * strip_size + i] = (float)normal(1);
-                buffer[(idx + 2) * strip_size + i] = (float)normal(2);
-                idx += 3;
-            }
-            if (has_color) {
-                const auto &color = pointcloud.colors_[i];
-                buffer[idx * strip_size + i] = ConvertRGBToFloat(color);
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+        reporter.SetTotal(int64_t(report_total));
+        const size_t buffer_size = (size_t)header.elementnum * header.points;
+        if (buffer_size * 2 * sizeof(float) >
+            std::numeric_limits<std::uint32_t>::max()) {
+            utility::LogWarning(
+                    "[WritePCDData] Too many points for binary_compressed "
+                    "data.");
+            return false;
         }
-        std::uint32_t buffer_size_in_bytes = buffer_size * sizeof(float);
+        // Fields are stored one after another, each as a contiguous column.
+        std::unique_ptr<float[]> buffer(new float[buffer_size]);
+        PackBinaryPCDBlock(pointcloud, 0, header.points, 1, header.points,
+                           buffer.get());
+        reporter.Update(int64_t(report_total * 0.5));
+        std::uint32_t buffer_size_in_bytes =
+                (std::uint32_t)(buffer_size * sizeof(float));
+        std::unique_ptr<char[]> buffer_compressed(
+                new char[buffer_size_in_bytes * 2]);
         std::uint32_t size_compressed =
                 lzf_compress(buffer.get(), buffer_size_in_bytes,
                              buffer_compressed.get(), buffer_size_in_bytes * 2);
@@ -735,10 +776,14 @@ bool WritePCDData(FILE *file,
         utility::LogDebug(
                 "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
                 buffer_size_in_bytes, size_compressed);
-        reporter.Update(int(report_total * 0.75));
+        reporter.Update(int64_t(report_total * 0.75));
         fwrite(&size_compressed, sizeof(size_compressed), 1, file);
         fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
-        fwrite(buffer_compressed.get(), 1, size_compressed, file);
+        if (fwrite(buffer_compressed.get(), 1, size_compressed, file) !=
+            size_compressed) {
+            utility::LogWarning("[WritePCDData] Failed to write data.");
+            return false;
+        }
     }
     reporter.Finish();
     return true;
@@ -25,9 +25,11 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <cstring>
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/ASCIIParser.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -44,60 +46,104 @@ bool ReadPointCloudFromPTS(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read PTS failed: unable to open file: {}",
                                 filename);
             return false;
         }
+        const char *begin = file.GetData();
+        const char *end = begin + file.GetSize();
+        auto find_line_end = [end](const char *line) {
+            const char *line_end = static_cast<const char *>(
+                    std::memchr(line, '\n', end - line));
+            return line_end == nullptr ? end : line_end;
+        };
+
         size_t num_of_pts = 0;
-        int num_of_fields = 0;
-        const char *line_buffer;
-        if ((line_buffer = file.ReadLine())) {
-            sscanf(line_buffer, "%zu", &num_of_pts);
+        const char *line_end = end;
+        if (begin < end) {
+            line_end = find_line_end(begin);
+            sscanf(std::string(begin, line_end).c_str(), "%zu", &num_of_pts);
         }
         if (num_of_pts <= 0) {
             utility::LogWarning("Read PTS failed: unable to read header.");
             return false;
         }
-        utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(num_of_pts);
-
         pointcloud.Clear();
-        size_t idx = 0;
-        while (idx < num_of_pts && (line_buffer = file.ReadLine())) {
-            if (num_of_fields == 0) {
-                std::vector<std::string> st =
-                        utility::SplitString(line_buffer, " ");
-                num_of_fields = (int)st.size();
-                if (num_of_fields < 3) {
-                    utility::LogWarning(
-                            "Read PTS failed: insufficient data fields.");
-                    return false;
-                }
-                pointcloud.points_.resize(num_of_pts);
-                if (num_of_fields >= 7) {
-                    // X Y Z I R G B
-                    pointcloud.colors_.resize(num_of_pts);
-                }
+        const char *data = line_end < end ? line_end + 1 : end;
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(end - data);
+        if (data < end) {
+            // The first point decides the fields of all points.
+            const int num_of_fields = static_cast<int>(
+                    utility::SplitString(std::string(data, find_line_end(data)),
+                                         " ")
+                            .size());
+            if (num_of_fields < 3) {
+                utility::LogWarning(
+                        "Read PTS failed: insufficient data fields.");
+                return false;
             }
-            double x, y, z;
-            int i, r, g, b;
-            if (num_of_fields < 7) {
-                if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                }
-            } else {
-                if (sscanf(line_buffer, "%lf %lf %lf %d %d %d %d", &x, &y, &z,
-                           &i, &r, &g, &b) == 7) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                    pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-                }
+            pointcloud.points_.resize(num_of_pts);
+            const bool has_colors = num_of_fields >= 7;
+            if (has_colors) {
+                // X Y Z I R G B
+                pointcloud.colors_.resize(num_of_pts);
             }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+
+            // Every line is a record, so that records are indexed by line.
+            // The last value tells whether the line could be parsed.
+            const int num_values = has_colors ? 7 : 4;
+            std::vector<std::vector<double>> records;
+            if (!ParseASCIILines(
+                        data, end, num_values,
+                        [has_colors](const char *line, const char *line_end,
+                                     double *values) {
+                            double &parsed = values[has_colors ? 6 : 3];
+                            parsed = 0;
+                            const char *p = line;
+                            for (int k = 0; k < 3 && p != nullptr; ++k) {
+                                p = ParseASCIIDouble(p, line_end, values[k]);
+                            }
+                            int irgb[4];
+                            for (int k = 0; has_colors && k < 4 && p != nullptr;
+                                 ++k) {
+                                p = ParseASCIIInt(p, line_end, irgb[k]);
+                            }
+                            if (p != nullptr) {
+                                if (has_colors) {
+                                    values[3] = irgb[1];
+                                    values[4] = irgb[2];
+                                    values[5] = irgb[3];
+                                }
+                                parsed = 1;
+                            }
+                            return true;
+                        },
+                        records, [&reporter](int64_t num_bytes) {
+                            return reporter.Update(num_bytes);
+                        })) {
+                pointcloud.Clear();
+                utility::LogWarning("Read PTS failed: reading was cancelled.");
+                return false;
             }
+            StoreASCIIRecords(
+                    records, num_values,
+                    [&](int64_t idx, const double *values) {
+                        if (idx >= static_cast<int64_t>(num_of_pts) ||
+                            values[num_values - 1] == 0) {
+                            return;
+                        }
+                        pointcloud.points_[idx] = Eigen::Vector3d(
+                                values[0], values[1], values[2]);
+                        if (has_colors) {
+                            pointcloud.colors_[idx] = utility::ColorToDouble(
+                                    static_cast<int>(values[3]),
+                                    static_cast<int>(values[4]),
+                                    static_cast<int>(values[5]));
+                        }
+                    });
         }
         reporter.Finish();
 
@@ -28,6 +28,7 @@
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/ASCIIParser.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -43,29 +44,37 @@ bool ReadPointCloudFromXYZN(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read XYZN failed: unable to open file: {}",
                                 filename);
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
+        reporter.SetTotal(file.GetSize());
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z, nx, ny, nz;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf %lf %lf", &x, &y, &z, &nx,
-                       &ny, &nz) == 6) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-                pointcloud.normals_.push_back(Eigen::Vector3d(nx, ny, nz));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+        std::vector<std::vector<double>> records;
+        if (!ParseASCIILines(
+                    file.GetData(), file.GetData() + file.GetSize(), 6,
+                    [](const char *begin, const char *end, double *values) {
+                        return ParseASCIIDoubles(begin, end, 6, values);
+                    },
+                    records, [&reporter](int64_t num_bytes) {
+                        return reporter.Update(num_bytes);
+                    })) {
+            utility::LogWarning("Read XYZN failed: reading was cancelled.");
+            return false;
         }
+        const int64_t num_points = CountASCIIRecords(records, 6);
+        pointcloud.points_.resize(num_points);
+        pointcloud.normals_.resize(num_points);
+        StoreASCIIRecords(records, 6, [&](int64_t i, const double *values) {
+            pointcloud.points_[i] = Eigen::Vector3d(values[0], values[1],
+                                                    values[2]);
+            pointcloud.normals_[i] = Eigen::Vector3d(values[3], values[4],
+                                                    values[5]);
+        });
         reporter.Finish();
 
         return true;
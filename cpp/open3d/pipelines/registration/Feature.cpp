@@ -27,6 +27,7 @@
 #include "open3d/pipelines/registration/Feature.h"
 
 #include <Eigen/Dense>
+#include <numeric>
 
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
@@ -70,84 +71,149 @@ static Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
     return result;
 }
 
-static std::shared_ptr<Feature> ComputeSPFHFeature(
-        const geometry::PointCloud &input,
-        const geometry::KDTreeFlann &kdtree,
-        const geometry::KDTreeSearchParam &search_param) {
-    auto feature = std::make_shared<Feature>();
-    feature->Resize(33, (int)input.points_.size());
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
-        const auto &normal = input.normals_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
-            // only compute SPFH feature when a point has neighbors
-            double hist_incr = 100.0 / (double)(indices.size() - 1);
-            for (size_t k = 1; k < indices.size(); k++) {
-                // skip the point itself, compute histogram
-                auto pf = ComputePairFeatures(point, normal,
-                                              input.points_[indices[k]],
-                                              input.normals_[indices[k]]);
-                int h_index = (int)(floor(11 * (pf(0) + M_PI) / (2.0 * M_PI)));
-                if (h_index < 0) h_index = 0;
-                if (h_index >= 11) h_index = 10;
-                feature->data_(h_index, i) += hist_incr;
-                h_index = (int)(floor(11 * (pf(1) + 1.0) * 0.5));
-                if (h_index < 0) h_index = 0;
-                if (h_index >= 11) h_index = 10;
-                feature->data_(h_index + 11, i) += hist_incr;
-                h_index = (int)(floor(11 * (pf(2) + 1.0) * 0.5));
-                if (h_index < 0) h_index = 0;
-                if (h_index >= 11) h_index = 10;
-                feature->data_(h_index + 22, i) += hist_incr;
-            }
-        }
+/// Computes the SPFH histogram of point i from its neighbors, the first of
+/// which is the point itself.
+static void ComputeSPFHFeature(const geometry::PointCloud &input,
+                               size_t i,
+                               const std::vector<int> &neighbors,
+                               float *spfh) {
+    const auto &point = input.points_[i];
+    const auto &normal = input.normals_[i];
+    double hist[33] = {0.0};
+    // only compute SPFH feature when a point has neighbors
+    double hist_incr = 100.0 / (double)(neighbors.size() - 1);
+    for (size_t k = 1; k < neighbors.size(); k++) {
+        // skip the point itself, compute histogram
+        auto pf = ComputePairFeatures(point, normal,
+                                      input.points_[neighbors[k]],
+                                      input.normals_[neighbors[k]]);
+        int h_index = (int)(floor(11 * (pf(0) + M_PI) / (2.0 * M_PI)));
+        if (h_index < 0) h_index = 0;
+        if (h_index >= 11) h_index = 10;
+        hist[h_index] += hist_incr;
+        h_index = (int)(floor(11 * (pf(1) + 1.0) * 0.5));
+        if (h_index < 0) h_index = 0;
+        if (h_index >= 11) h_index = 10;
+        hist[h_index + 11] += hist_incr;
+        h_index = (int)(floor(11 * (pf(2) + 1.0) * 0.5));
+        if (h_index < 0) h_index = 0;
+        if (h_index >= 11) h_index = 10;
+        hist[h_index + 22] += hist_incr;
+    }
+    for (int j = 0; j < 33; j++) {
+        spfh[j] = float(hist[j]);
     }
-    return feature;
 }
 
 std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::PointCloud &input,
         const geometry::KDTreeSearchParam
-                &search_param /* = geometry::KDTreeSearchParamKNN()*/) {
-    auto feature = std::make_shared<Feature>();
-    feature->Resize(33, (int)input.points_.size());
+                &search_param /* = geometry::KDTreeSearchParamKNN()*/,
+        const utility::optional<std::vector<size_t>>
+                &indices /* = utility::nullopt*/) {
     if (!input.HasNormals()) {
         utility::LogError(
                 "[ComputeFPFHFeature] Failed because input point cloud has no "
                 "normal.");
     }
+    const int num_points = (int)input.points_.size();
+    std::vector<int> fpfh_points;
+    if (indices.has_value()) {
+        fpfh_points.reserve(indices.value().size());
+        for (size_t index : indices.value()) {
+            if (index >= (size_t)num_points) {
+                utility::LogError(
+                        "[ComputeFPFHFeature] Index {} out of range for a "
+                        "point cloud of size {}.",
+                        index, num_points);
+            }
+            fpfh_points.push_back((int)index);
+        }
+    } else {
+        fpfh_points.resize(num_points);
+        std::iota(fpfh_points.begin(), fpfh_points.end(), 0);
+    }
+    auto feature = std::make_shared<Feature>();
+    feature->Resize(33, (int)fpfh_points.size());
+
+    // Neighbor lists are searched once per point and cached for both passes.
     geometry::KDTreeFlann kdtree(input);
-    auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
+    std::vector<std::vector<int>> neighbors(num_points);
+    std::vector<uint8_t> searched(num_points, 0);
+    auto search_neighbors = [&](const std::vector<int> &points) {
+        std::vector<int> new_points;
+        for (int i : points) {
+            if (!searched[i]) {
+                searched[i] = 1;
+                new_points.push_back(i);
+            }
+        }
+#pragma omp parallel for schedule(static)
+        for (int k = 0; k < (int)new_points.size(); k++) {
+            int i = new_points[k];
+            std::vector<double> distance2;
+            kdtree.Search(input.points_[i], search_param, neighbors[i],
+                          distance2);
+        }
+    };
+    search_neighbors(fpfh_points);
+
+    // SPFH is needed for the FPFH points and their neighbors. It is stored as
+    // float32, one column per point in spfh_points.
+    std::vector<int> spfh_points;
+    std::vector<int> spfh_column(num_points, -1);
+    auto add_spfh_point = [&](int i) {
+        if (spfh_column[i] < 0) {
+            spfh_column[i] = (int)spfh_points.size();
+            spfh_points.push_back(i);
+        }
+    };
+    for (int i : fpfh_points) {
+        add_spfh_point(i);
+        for (size_t k = 1; k < neighbors[i].size(); k++) {
+            add_spfh_point(neighbors[i][k]);
+        }
+    }
+    search_neighbors(spfh_points);
+    Eigen::MatrixXf spfh = Eigen::MatrixXf::Zero(33, spfh_points.size());
+#pragma omp parallel for schedule(static)
+    for (int c = 0; c < (int)spfh_points.size(); c++) {
+        int i = spfh_points[c];
+        if (neighbors[i].size() > 1) {
+            ComputeSPFHFeature(input, i, neighbors[i], spfh.col(c).data());
+        }
+    }
+
 #pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)input.points_.size(); i++) {
+    for (int c = 0; c < (int)fpfh_points.size(); c++) {
+        const int i = fpfh_points[c];
         const auto &point = input.points_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        const std::vector<int> &point_neighbors = neighbors[i];
+        if (point_neighbors.size() > 1) {
             double sum[3] = {0.0, 0.0, 0.0};
-            for (size_t k = 1; k < indices.size(); k++) {
+            for (size_t k = 1; k < point_neighbors.size(); k++) {
                 // skip the point itself
-                double dist = distance2[k];
+                const int j = point_neighbors[k];
+                double dist = (input.points_[j] - point).squaredNorm();
                 if (dist == 0.0) continue;
-                for (int j = 0; j < 33; j++) {
-                    double val = spfh->data_(j, indices[k]) / dist;
-                    sum[j / 11] += val;
-                    feature->data_(j, i) += val;
+                const float *spfh_j = spfh.col(spfh_column[j]).data();
+                for (int h = 0; h < 33; h++) {
+                    double val = spfh_j[h] / dist;
+                    sum[h / 11] += val;
+                    feature->data_(h, c) += val;
                 }
             }
-            for (int j = 0; j < 3; j++)
-                if (sum[j] != 0.0) sum[j] = 100.0 / sum[j];
-            for (int j = 0; j < 33; j++) {
-                feature->data_(j, i) *= sum[j / 11];
+            for (int h = 0; h < 3; h++)
+                if (sum[h] != 0.0) sum[h] = 100.0 / sum[h];
+            const float *spfh_i = spfh.col(spfh_column[i]).data();
+            for (int h = 0; h < 33; h++) {
+                feature->data_(h, c) *= sum[h / 11];
                 // The commented line is the fpfh function in the paper.
                 // But according to PCL implementation, it is skipped.
                 // Our initial test shows that the full fpfh function in the
                 // paper seems to be better than PCL implementation. Further
                 // test required.
-                feature->data_(j, i) += spfh->data_(j, i);
+                feature->data_(h, c) += spfh_i[h];
             }
         }
     }
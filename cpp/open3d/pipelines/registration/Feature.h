@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "open3d/geometry/KDTreeSearchParam.h"
+#include "open3d/utility/Optional.h"
 
 namespace open3d {
 
@@ -66,12 +67,22 @@ public:
 
 /// Function to compute FPFH feature for a point cloud.
 ///
+/// The neighbors of each point are searched once and shared by the SPFH and
+/// the FPFH pass. If \p indices is given, FPFH is only computed for these
+/// points, and SPFH only for them and their neighbors. The features are the
+/// same as the corresponding columns of the full computation.
+///
 /// \param input The Input point cloud.
 /// \param search_param KDTree KNN search parameter.
+/// \param indices Indices of the points to compute FPFH features for. All
+/// points if not given.
+/// \return Features with one column per point, or per entry of \p indices.
 std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::PointCloud &input,
         const geometry::KDTreeSearchParam &search_param =
-                geometry::KDTreeSearchParamKNN());
+                geometry::KDTreeSearchParamKNN(),
+        const utility::optional<std::vector<size_t>> &indices =
+                utility::nullopt);
 
 }  // namespace registration
 }  // namespace pipelines
@@ -28,6 +28,7 @@
 
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
+#include <algorithm>
 #include <tuple>
 #include <vector>
 
@@ -184,6 +185,7 @@ static double ComputeResidual(const PoseGraph &pose_graph,
 static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
     int n_edges = (int)pose_graph.edges_.size();
     Eigen::VectorXd output(n_edges * 6);
+#pragma omp parallel for schedule(static)
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
         Eigen::Matrix4d X_inv, Ts, Tt_inv;
         std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
@@ -206,15 +208,23 @@ static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
 ///
 /// This function focuses the case that every edge has two nodes (not hyper
 /// graph) so we have two Jacobian matrices from one constraint.
-static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
-        const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
+///
+/// H is assembled as a sparse matrix of 6x6 blocks, with a nonzero block for
+/// every node and for every pair of nodes connected by an edge. The sparsity
+/// pattern only depends on the graph topology, so it is the same for every
+/// call on the same pose graph. The Jacobians are evaluated in parallel over
+/// edges, and the blocks are accumulated in parallel over block columns.
+static std::tuple<Eigen::SparseMatrix<double>, Eigen::VectorXd>
+ComputeLinearSystem(const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
-    Eigen::MatrixXd H(n_nodes * 6, n_nodes * 6);
-    Eigen::VectorXd b(n_nodes * 6);
-    H.setZero();
-    b.setZero();
 
+    // Per-edge blocks: H_ss, H_st, H_tt (H_ts = H_st^T), and b_s, b_t.
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> H_edges(
+            n_edges * 3);
+    std::vector<Eigen::Vector6d, utility::Vector6d_allocator> b_edges(n_edges *
+                                                                      2);
+#pragma omp parallel for schedule(static)
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
         const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
         Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
@@ -229,24 +239,119 @@ static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
         Eigen::Vector6d eT_Info = e.transpose() * t.information_;
         double line_process_iter = t.confidence_;
 
-        int id_i = t.source_node_id_ * 6;
-        int id_j = t.target_node_id_ * 6;
-        H.block<6, 6>(id_i, id_i).noalias() +=
+        H_edges[iter_edge * 3 + 0].noalias() =
                 line_process_iter * JsT_Info * Js;
-        H.block<6, 6>(id_i, id_j).noalias() +=
+        H_edges[iter_edge * 3 + 1].noalias() =
                 line_process_iter * JsT_Info * Jt;
-        H.block<6, 6>(id_j, id_i).noalias() +=
-                line_process_iter * JtT_Info * Js;
-        H.block<6, 6>(id_j, id_j).noalias() +=
+        H_edges[iter_edge * 3 + 2].noalias() =
                 line_process_iter * JtT_Info * Jt;
-        b.block<6, 1>(id_i, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Js;
-        b.block<6, 1>(id_j, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Jt;
+        b_edges[iter_edge * 2 + 0].noalias() =
+                -line_process_iter * Js.transpose() * eT_Info;
+        b_edges[iter_edge * 2 + 1].noalias() =
+                -line_process_iter * Jt.transpose() * eT_Info;
+    }
+
+    // Edges incident to each node, and the sorted block rows of each block
+    // column (the node itself and its neighbors).
+    std::vector<std::vector<int>> node_edges(n_nodes);
+    std::vector<std::vector<int>> block_rows(n_nodes);
+    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
+        block_rows[iter_node].push_back(iter_node);
+    }
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        node_edges[t.source_node_id_].push_back(iter_edge);
+        block_rows[t.source_node_id_].push_back(t.target_node_id_);
+        if (t.target_node_id_ != t.source_node_id_) {
+            node_edges[t.target_node_id_].push_back(iter_edge);
+            block_rows[t.target_node_id_].push_back(t.source_node_id_);
+        }
+    }
+    // Value offset of the first entry of each block column.
+    std::vector<int> block_col_offsets(n_nodes + 1, 0);
+    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
+        auto &rows = block_rows[iter_node];
+        std::sort(rows.begin(), rows.end());
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+        block_col_offsets[iter_node + 1] =
+                block_col_offsets[iter_node] + 36 * (int)rows.size();
+    }
+
+    Eigen::SparseMatrix<double> H(n_nodes * 6, n_nodes * 6);
+    Eigen::VectorXd b(n_nodes * 6);
+    H.resizeNonZeros(block_col_offsets[n_nodes]);
+    int *outer = H.outerIndexPtr();
+    int *inner = H.innerIndexPtr();
+    double *values = H.valuePtr();
+    outer[n_nodes * 6] = block_col_offsets[n_nodes];
+
+#pragma omp parallel for schedule(dynamic, 16)
+    for (int j = 0; j < n_nodes; j++) {
+        const std::vector<int> &rows = block_rows[j];
+        const int n_rows = (int)rows.size() * 6;
+        // Within a block column, column k holds the k-th column of every
+        // block, so block (rows[r], j) starts at offset + k * n_rows + r * 6.
+        const int offset = block_col_offsets[j];
+        for (int k = 0; k < 6; k++) {
+            outer[j * 6 + k] = offset + k * n_rows;
+            for (size_t r = 0; r < rows.size(); r++) {
+                for (int i = 0; i < 6; i++) {
+                    inner[offset + k * n_rows + r * 6 + i] = rows[r] * 6 + i;
+                }
+            }
+        }
+        std::fill(values + offset, values + offset + 6 * n_rows, 0.0);
+        auto add_block = [&](int row, const Eigen::Matrix6d &block) {
+            const int r = int(std::lower_bound(rows.begin(), rows.end(), row) -
+                              rows.begin());
+            Eigen::Map<Eigen::Matrix6d, 0, Eigen::OuterStride<>> dst(
+                    values + offset + r * 6, Eigen::OuterStride<>(n_rows));
+            dst += block;
+        };
+
+        Eigen::Vector6d b_j = Eigen::Vector6d::Zero();
+        for (int iter_edge : node_edges[j]) {
+            const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+            if (t.source_node_id_ == j) {
+                add_block(j, H_edges[iter_edge * 3 + 0]);
+                add_block(t.target_node_id_,
+                          H_edges[iter_edge * 3 + 1].transpose());
+                b_j += b_edges[iter_edge * 2 + 0];
+            }
+            if (t.target_node_id_ == j) {
+                add_block(t.source_node_id_, H_edges[iter_edge * 3 + 1]);
+                add_block(j, H_edges[iter_edge * 3 + 2]);
+                b_j += b_edges[iter_edge * 2 + 1];
+            }
+        }
+        b.block<6, 1>(j * 6, 0) = b_j;
     }
     return std::make_tuple(std::move(H), std::move(b));
 }
 
+/// Solves H delta = b with a sparse LDLT factorization. The symbolic analysis
+/// of \p solver is reused as long as the sparsity pattern of H is unchanged,
+/// which holds during the optimization of one pose graph.
+static std::tuple<bool, Eigen::VectorXd> SolveLinearSystemSparse(
+        Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> &solver,
+        bool &pattern_analyzed,
+        const Eigen::SparseMatrix<double> &H,
+        const Eigen::VectorXd &b) {
+    if (!pattern_analyzed) {
+        solver.analyzePattern(H);
+        pattern_analyzed = true;
+    }
+    solver.factorize(H);
+    if (solver.info() == Eigen::Success) {
+        Eigen::VectorXd delta = solver.solve(b);
+        if (solver.info() == Eigen::Success) {
+            return std::make_tuple(true, std::move(delta));
+        }
+    }
+    utility::LogWarning("Sparse LDLT solve of the pose graph system failed.");
+    return std::make_tuple(false, Eigen::VectorXd::Zero(b.rows()));
+}
+
 static Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
     int n_nodes = (int)pose_graph.nodes_.size();
     Eigen::VectorXd output(n_nodes * 6);
@@ -388,55 +493,44 @@ static bool ValidatePoseGraphConnectivity(const PoseGraph &pose_graph,
     size_t n_nodes = pose_graph.nodes_.size();
     size_t n_edges = pose_graph.edges_.size();
 
+    std::vector<std::vector<int>> adjacent_nodes(n_nodes);
+    for (size_t j = 0; j < n_edges; j++) {
+        const PoseGraphEdge &t = pose_graph.edges_[j];
+        if (ignore_uncertain_edges && t.uncertain_) {
+            continue;
+        }
+        adjacent_nodes[t.source_node_id_].push_back(t.target_node_id_);
+        adjacent_nodes[t.target_node_id_].push_back(t.source_node_id_);
+    }
+
     // Test if the connected component containing the first node is the entire
     // graph
     std::vector<int> nodes_to_explore{};
-    std::vector<int> component{};
+    std::vector<bool> in_component(n_nodes, false);
+    size_t component_size = 0;
     if (n_nodes > 0) {
         nodes_to_explore.push_back(0);
-        component.push_back(0);
+        in_component[0] = true;
+        component_size++;
     }
     while (!nodes_to_explore.empty()) {
         int i = nodes_to_explore.back();
         nodes_to_explore.pop_back();
-        for (size_t j = 0; j < n_edges; j++) {
-            const PoseGraphEdge &t = pose_graph.edges_[j];
-            if (ignore_uncertain_edges && t.uncertain_) {
-                continue;
-            }
-            int adjacent_node{-1};
-            if (t.source_node_id_ == i) {
-                adjacent_node = t.target_node_id_;
-            } else if (t.target_node_id_ == i) {
-                adjacent_node = t.source_node_id_;
-            }
-            if (adjacent_node != -1) {
-                auto find_result = std::find(component.begin(), component.end(),
-                                             adjacent_node);
-                if (find_result == component.end()) {
-                    nodes_to_explore.push_back(adjacent_node);
-                    component.push_back(adjacent_node);
-                }
+        for (int adjacent_node : adjacent_nodes[i]) {
+            if (!in_component[adjacent_node]) {
+                nodes_to_explore.push_back(adjacent_node);
+                in_component[adjacent_node] = true;
+                component_size++;
             }
         }
     }
-    return component.size() == n_nodes;
+    return component_size == n_nodes;
 }
 
 static bool ValidatePoseGraph(const PoseGraph &pose_graph) {
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
 
-    if (!ValidatePoseGraphConnectivity(pose_graph, false)) {
-        utility::LogWarning("Invalid PoseGraph - graph is not connected.");
-        return false;
-    }
-
-    if (!ValidatePoseGraphConnectivity(pose_graph, true)) {
-        utility::LogWarning(
-                "Certain-edge subset of PoseGraph is not connected.");
-    }
-
     for (int j = 0; j < n_edges; j++) {
         bool valid = false;
         const PoseGraphEdge &t = pose_graph.edges_[j];
@@ -450,6 +544,17 @@ static bool ValidatePoseGraph(const PoseGraph &pose_graph) {
             return false;
         }
     }
+
+    if (!ValidatePoseGraphConnectivity(pose_graph, false)) {
+        utility::LogWarning("Invalid PoseGraph - graph is not connected.");
+        return false;
+    }
+
+    if (!ValidatePoseGraphConnectivity(pose_graph, true)) {
+        utility::LogWarning(
+                "Certain-edge subset of PoseGraph is not connected.");
+    }
+
     for (int j = 0; j < n_edges; j++) {
         const PoseGraphEdge &t = pose_graph.edges_[j];
         if (!t.uncertain_ && t.confidence_ != 1.0) {
@@ -511,9 +616,11 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
     valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H;
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver;
+    bool pattern_analyzed = false;
 
     std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
 
@@ -532,10 +639,9 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
         Eigen::VectorXd delta(H.cols());
         bool solver_success = false;
 
-        // Solve H_LM @ delta == b using a sparse solver
-        std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                H, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                /*check_det=*/false, /*check_psd=*/false);
+        // Solve H @ delta == b using a sparse solver
+        std::tie(solver_success, delta) =
+                SolveLinearSystemSparse(solver, pattern_analyzed, H, b);
 
         stop = stop || CheckRelativeIncrement(delta, x, criteria);
         if (stop) {
@@ -602,10 +708,13 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
     int valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H_I = Eigen::MatrixXd::Identity(n_nodes * 6, n_nodes * 6);
-    Eigen::MatrixXd H;
+    Eigen::SparseMatrix<double> H_I(n_nodes * 6, n_nodes * 6);
+    H_I.setIdentity();
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver;
+    bool pattern_analyzed = false;
 
     std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
 
@@ -629,14 +738,15 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         timer_iter.Start();
         int lm_count = 0;
         do {
-            Eigen::MatrixXd H_LM = H + current_lambda * H_I;
+            // H always has nonzero diagonal blocks, so adding the identity
+            // keeps the sparsity pattern of H.
+            Eigen::SparseMatrix<double> H_LM = H + current_lambda * H_I;
             Eigen::VectorXd delta(H_LM.cols());
             bool solver_success = false;
 
             // Solve H_LM @ delta == b using a sparse solver
-            std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                    H_LM, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            std::tie(solver_success, delta) =
+                    SolveLinearSystemSparse(solver, pattern_analyzed, H_LM, b);
 
             stop = stop || CheckRelativeIncrement(delta, x, criteria);
             if (!stop) {
@@ -26,6 +26,8 @@
 
 #include "open3d/pipelines/registration/Registration.h"
 
+#include <atomic>
+
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Feature.h"
@@ -86,6 +88,39 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
     return result;
 }
 
+/// Counts the correspondences closer than \p max_correspondence_distance
+/// after transforming the source points, without copying the point cloud.
+/// Returns -1 as soon as \p min_num_inliers can no longer be reached.
+static int CountRANSACInliers(const geometry::PointCloud &source,
+                              const geometry::PointCloud &target,
+                              const CorrespondenceSet &corres,
+                              double max_correspondence_distance,
+                              const Eigen::Matrix4d &transformation,
+                              int min_num_inliers,
+                              double &error2) {
+    const Eigen::Matrix3d rotation = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d translation = transformation.block<3, 1>(0, 3);
+    const double max_dis2 =
+            max_correspondence_distance * max_correspondence_distance;
+    const int num_corres = int(corres.size());
+    int good = 0;
+    error2 = 0.0;
+    for (int k = 0; k < num_corres; k++) {
+        if (good + num_corres - k < min_num_inliers) {
+            return -1;
+        }
+        const auto &c = corres[k];
+        double dis2 = (rotation * source.points_[c[0]] + translation -
+                       target.points_[c[1]])
+                              .squaredNorm();
+        if (dis2 < max_dis2) {
+            good++;
+            error2 += dis2;
+        }
+    }
+    return good;
+}
+
 static RegistrationResult EvaluateRANSACBasedOnCorrespondence(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -93,12 +128,15 @@ static RegistrationResult EvaluateRANSACBasedOnCorrespondence(
         double max_correspondence_distance,
         const Eigen::Matrix4d &transformation) {
     RegistrationResult result(transformation);
+    const Eigen::Matrix3d rotation = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d translation = transformation.block<3, 1>(0, 3);
     double error2 = 0.0;
     int good = 0;
     double max_dis2 = max_correspondence_distance * max_correspondence_distance;
     for (const auto &c : corres) {
-        double dis2 =
-                (source.points_[c[0]] - target.points_[c[1]]).squaredNorm();
+        double dis2 = (rotation * source.points_[c[0]] + translation -
+                       target.points_[c[1]])
+                              .squaredNorm();
         if (dis2 < max_dis2) {
             good++;
             error2 += dis2;
@@ -203,72 +241,96 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         return RegistrationResult();
     }
 
+    // The iteration count, the adaptive exit iteration and the best inlier
+    // count are shared by all threads, so that a good hypothesis found by one
+    // thread stops and prunes the others. Only the best result itself is
+    // kept per thread and reduced at the end. The iteration count is 64-bit
+    // since every thread increments it once more after the exit iteration,
+    // which would overflow an int when max_iteration_ is close to INT_MAX.
+    const int num_corres = int(corres.size());
+    std::atomic<int64_t> num_iterations(0);
+    std::atomic<int> exit_itr(criteria.max_iteration_);
+    std::atomic<int> best_num_inliers(0);
     RegistrationResult best_result;
-    int exit_itr = -1;
 
 #pragma omp parallel
     {
         CorrespondenceSet ransac_corres(ransac_n);
         RegistrationResult best_result_local;
-        int exit_itr_local = criteria.max_iteration_;
 
-#pragma omp for nowait
-        for (int itr = 0; itr < criteria.max_iteration_; itr++) {
-            if (itr < exit_itr_local) {
-                for (int j = 0; j < ransac_n; j++) {
-                    ransac_corres[j] = corres[utility::UniformRandInt(
-                            0, static_cast<int>(corres.size()) - 1)];
-                }
+        while (num_iterations.fetch_add(1) < exit_itr.load()) {
+            for (int j = 0; j < ransac_n; j++) {
+                ransac_corres[j] =
+                        corres[utility::UniformRandInt(0, num_corres - 1)];
+            }
+
+            Eigen::Matrix4d transformation = estimation.ComputeTransformation(
+                    source, target, ransac_corres);
 
-                Eigen::Matrix4d transformation =
-                        estimation.ComputeTransformation(source, target,
-                                                         ransac_corres);
-
-                // Check transformation: inexpensive
-                bool check = true;
-                for (const auto &checker : checkers) {
-                    if (!checker.get().Check(source, target, ransac_corres,
-                                             transformation)) {
-                        check = false;
-                        break;
-                    }
+            // Check transformation: inexpensive
+            bool check = true;
+            for (const auto &checker : checkers) {
+                if (!checker.get().Check(source, target, ransac_corres,
+                                         transformation)) {
+                    check = false;
+                    break;
                 }
-                if (!check) continue;
-
-                geometry::PointCloud pcd = source;
-                pcd.Transform(transformation);
-                auto result = EvaluateRANSACBasedOnCorrespondence(
-                        pcd, target, corres, max_correspondence_distance,
-                        transformation);
-
-                if (result.IsBetterRANSACThan(best_result_local)) {
-                    best_result_local = result;
-
-                    // Update exit condition if necessary
-                    double exit_itr_d =
-                            std::log(1.0 - criteria.confidence_) /
-                            std::log(1.0 - std::pow(result.fitness_, ransac_n));
-                    exit_itr_local =
-                            exit_itr_d < double(criteria.max_iteration_)
-                                    ? static_cast<int>(std::ceil(exit_itr_d))
-                                    : exit_itr_local;
+            }
+            if (!check) continue;
+
+            // Hypotheses that cannot reach the best inlier count of any
+            // thread are rejected before all correspondences are visited.
+            double error2;
+            int good = CountRANSACInliers(source, target, corres,
+                                          max_correspondence_distance,
+                                          transformation,
+                                          best_num_inliers.load(), error2);
+            if (good <= 0) continue;
+
+            RegistrationResult result(transformation);
+            result.fitness_ = (double)good / (double)num_corres;
+            result.inlier_rmse_ = std::sqrt(error2 / (double)good);
+            if (!result.IsBetterRANSACThan(best_result_local)) continue;
+            best_result_local = result;
+
+            int num_inliers = best_num_inliers.load();
+            while (good > num_inliers &&
+                   !best_num_inliers.compare_exchange_weak(num_inliers,
+                                                           good)) {
+            }
+
+            // Update exit condition if necessary
+            double exit_itr_d =
+                    std::log(1.0 - criteria.confidence_) /
+                    std::log(1.0 - std::pow(result.fitness_, ransac_n));
+            if (exit_itr_d < double(criteria.max_iteration_)) {
+                int new_exit_itr = static_cast<int>(std::ceil(exit_itr_d));
+                int old_exit_itr = exit_itr.load();
+                while (new_exit_itr < old_exit_itr &&
+                       !exit_itr.compare_exchange_weak(old_exit_itr,
+                                                       new_exit_itr)) {
                 }
-            }  // if < exit_itr_local
-        }      // for loop
+            }
+        }
 #pragma omp critical
         {
             if (best_result_local.IsBetterRANSACThan(best_result)) {
                 best_result = best_result_local;
             }
-            if (exit_itr_local > exit_itr) {
-                exit_itr = exit_itr_local;
-            }
         }
     }
+    // Only the transformation is kept during the iterations, the inlier set
+    // is collected once for the best one.
+    if (best_result.fitness_ > 0.0) {
+        best_result = EvaluateRANSACBasedOnCorrespondence(
+                source, target, corres, max_correspondence_distance,
+                best_result.transformation_);
+    }
     utility::LogDebug(
             "RANSAC exits at {:d}-th iteration: inlier ratio {:e}, "
             "RMSE {:e}",
-            exit_itr, best_result.fitness_, best_result.inlier_rmse_);
+            std::min<int64_t>(num_iterations.load(), exit_itr.load()),
+            best_result.fitness_, best_result.inlier_rmse_);
     return best_result;
 }
 
@@ -296,37 +358,52 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
     geometry::KDTreeFlann kdtree_target(target_feature);
     pipelines::registration::CorrespondenceSet corres_ij(num_src_pts);
 
-#pragma omp parallel for
-    for (int i = 0; i < num_src_pts; i++) {
+#pragma omp parallel
+    {
+        Eigen::VectorXd query;
         std::vector<int> corres_tmp(1);
         std::vector<double> dist_tmp(1);
-
-        kdtree_target.SearchKNN(Eigen::VectorXd(source_feature.data_.col(i)), 1,
-                                corres_tmp, dist_tmp);
-        int j = corres_tmp[0];
-        corres_ij[i] = Eigen::Vector2i(i, j);
+#pragma omp for
+        for (int i = 0; i < num_src_pts; i++) {
+            query = source_feature.data_.col(i);
+            kdtree_target.SearchKNN(query, 1, corres_tmp, dist_tmp);
+            int j = corres_tmp[0];
+            corres_ij[i] = Eigen::Vector2i(i, j);
+        }
     }
 
-    // Do reverse check if mutual_filter is enabled
+    // Do reverse check if mutual_filter is enabled. Only target points that
+    // are the match of some source point need a reverse search.
     if (mutual_filter) {
         geometry::KDTreeFlann kdtree_source(source_feature);
-        pipelines::registration::CorrespondenceSet corres_ji(num_tgt_pts);
+        std::vector<int> corres_ji(num_tgt_pts, -1);
+        std::vector<int> matched_tgt_pts;
+        for (int i = 0; i < num_src_pts; ++i) {
+            int j = corres_ij[i](1);
+            if (corres_ji[j] == -1) {
+                corres_ji[j] = -2;
+                matched_tgt_pts.push_back(j);
+            }
+        }
 
-#pragma omp parallel for
-        for (int j = 0; j < num_tgt_pts; ++j) {
+#pragma omp parallel
+        {
+            Eigen::VectorXd query;
             std::vector<int> corres_tmp(1);
             std::vector<double> dist_tmp(1);
-            kdtree_source.SearchKNN(
-                    Eigen::VectorXd(target_feature.data_.col(j)), 1, corres_tmp,
-                    dist_tmp);
-            int i = corres_tmp[0];
-            corres_ji[j] = Eigen::Vector2i(i, j);
+#pragma omp for
+            for (int k = 0; k < int(matched_tgt_pts.size()); ++k) {
+                int j = matched_tgt_pts[k];
+                query = target_feature.data_.col(j);
+                kdtree_source.SearchKNN(query, 1, corres_tmp, dist_tmp);
+                corres_ji[j] = corres_tmp[0];
+            }
         }
 
         pipelines::registration::CorrespondenceSet corres_mutual;
         for (int i = 0; i < num_src_pts; ++i) {
             int j = corres_ij[i](1);
-            if (corres_ji[j](0) == i) {
+            if (corres_ji[j] == i) {
                 corres_mutual.emplace_back(i, j);
             }
         }
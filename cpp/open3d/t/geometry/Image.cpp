@@ -46,6 +46,17 @@ namespace geometry {
 
 using dtype_channels_pairs = std::vector<std::pair<core::Dtype, int64_t>>;
 
+/// Whether the native CPU kernels, used when IPP is not available or does not
+/// support the data type and number of channels, support \p data.
+static bool IsNativeCPUSupported(const core::Tensor &data,
+                                 const std::vector<core::Dtype> &dtypes = {
+                                         core::Dtype::UInt8,
+                                         core::Dtype::UInt16,
+                                         core::Dtype::Float32}) {
+    return data.GetDevice().GetType() == core::Device::DeviceType::CPU &&
+           std::count(dtypes.begin(), dtypes.end(), data.GetDtype()) > 0;
+}
+
 Image::Image(int64_t rows,
              int64_t cols,
              int64_t channels,
@@ -195,6 +206,8 @@ Image Image::RGBToGray() const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::RGBToGray, data_, dst_im.data_);
+    } else if (IsNativeCPUSupported(data_)) {
+        kernel::image::RGBToGrayCPU(data_, dst_im.data_);
     } else {
         utility::LogError(
                 "RGBToGray with data type {} on device {} is not implemented!",
@@ -240,6 +253,11 @@ Image Image::Resize(float sampling_rate, InterpType interp_type) const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Resize, data_, dst_im.data_, interp_type);
+    } else if (IsNativeCPUSupported(data_) &&
+               (interp_type == InterpType::Nearest ||
+                interp_type == InterpType::Linear ||
+                interp_type == InterpType::Super)) {
+        kernel::image::ResizeCPU(data_, dst_im.data_, interp_type);
     } else {
         utility::LogError(
                 "Resize with data type {} on device {} is not "
@@ -282,6 +300,10 @@ Image Image::Dilate(int kernel_size) const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Dilate, data_, dst_im.data_, kernel_size);
+    } else if (IsNativeCPUSupported(
+                       data_, {core::Dtype::Bool, core::Dtype::UInt8,
+                               core::Dtype::UInt16, core::Dtype::Float32})) {
+        kernel::image::DilateCPU(data_, dst_im.data_, kernel_size);
     } else {
         utility::LogError(
                 "Dilate with data type {} on device {} is not implemented!",
@@ -322,6 +344,9 @@ Image Image::FilterBilateral(int kernel_size,
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::FilterBilateral, data_, dst_im.data_, kernel_size,
                  value_sigma, dist_sigma);
+    } else if (IsNativeCPUSupported(data_)) {
+        kernel::image::FilterBilateralCPU(data_, dst_im.data_, kernel_size,
+                                          value_sigma, dist_sigma);
     } else {
         utility::LogError(
                 "FilterBilateral with data type {} on device {} is not "
@@ -358,6 +383,8 @@ Image Image::Filter(const core::Tensor &kernel) const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Filter, data_, dst_im.data_, kernel);
+    } else if (IsNativeCPUSupported(data_)) {
+        kernel::image::FilterCPU(data_, dst_im.data_, kernel);
     } else {
         utility::LogError(
                 "Filter with data type {} on device {} is not "
@@ -399,6 +426,9 @@ Image Image::FilterGaussian(int kernel_size, float sigma) const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::FilterGaussian, data_, dst_im.data_, kernel_size, sigma);
+    } else if (IsNativeCPUSupported(data_)) {
+        kernel::image::FilterGaussianCPU(data_, dst_im.data_, kernel_size,
+                                         sigma);
     } else {
         utility::LogError(
                 "FilterGaussian with data type {} on device {} is not "
@@ -450,6 +480,10 @@ std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::FilterSobel, data_, dst_im_dx.data_, dst_im_dy.data_,
                  kernel_size);
+    } else if (IsNativeCPUSupported(
+                       data_, {core::Dtype::UInt8, core::Dtype::Float32})) {
+        kernel::image::FilterSobelCPU(data_, dst_im_dx.data_, dst_im_dy.data_,
+                                      kernel_size);
     } else {
         utility::LogError(
                 "FilterSobel with data type {} on device {} is not "
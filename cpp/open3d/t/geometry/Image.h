@@ -212,15 +212,16 @@ public:
     /// type.
     ///
     /// Downsample if sampling rate is < 1. Upsample if sampling rate > 1.
-    /// Aspect ratio is always preserved.
+    /// Aspect ratio is always preserved. Without IPP, only the Nearest, Linear
+    /// and Super interpolation types are supported on CPU.
     Image Resize(float sampling_rate = 0.5f,
                  InterpType interp_type = InterpType::Nearest) const;
 
     /// \brief Return a new image after performing morphological dilation.
     ///
     /// Supported datatypes are UInt8, UInt16 and Float32 with {1, 3, 4}
-    /// channels. An 8-connected neighborhood is used to create the dilation
-    /// mask.
+    /// channels, and Bool on CPU. An 8-connected neighborhood is used to
+    /// create the dilation mask.
     ///
     /// \param kernel_size An odd number >= 3.
     Image Dilate(int kernel_size = 3) const;
@@ -233,8 +234,8 @@ public:
     /// \param value_sigma Standard deviation for the image content.
     /// \param distance_sigma Standard deviation for the image pixel positions.
     ///
-    /// Note: CPU (IPP) and CUDA (NPP) versions use different algorithms and
-    /// will give different results:\n
+    /// Note: CPU (IPP or native) and CUDA (NPP) versions use different
+    /// algorithms and will give different results:\n
     /// CPU uses a round kernel (radius = floor(kernel_size / 2)),\n
     /// while CUDA uses a square kernel (width = kernel_size).\n
     /// Make sure to tune parameters accordingly.
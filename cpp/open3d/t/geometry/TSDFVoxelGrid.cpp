@@ -26,15 +26,144 @@
 
 #include "open3d/t/geometry/TSDFVoxelGrid.h"
 
+#include <algorithm>
+#include <cstdio>
+
 #include "open3d/Open3D.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/kernel/TSDFVoxelGrid.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace t {
 namespace geometry {
 
+// Number of blocks copied to the host at once during eviction.
+static constexpr int64_t kEvictChunkSize = 256;
+
+static bool SeekSet(FILE *file, int64_t offset) {
+#ifdef _WIN32
+    return _fseeki64(file, offset, SEEK_SET) == 0;
+#else
+    return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+}
+
+/// Disk store of evicted voxel blocks. Each block occupies a fixed size slot
+/// of a scratch file, and slots of blocks paged back in are reused. The file
+/// is removed when the store is destroyed.
+class TSDFVoxelGrid::BlockStore {
+public:
+    BlockStore(const std::string &path, int64_t block_bytes)
+        : path_(path), block_bytes_(block_bytes) {
+        if (!file_.Open(path, "w+b")) {
+            utility::LogError(
+                    "[TSDFVoxelGrid] unable to open block store {}: {}", path,
+                    file_.GetError());
+        }
+    }
+
+    ~BlockStore() {
+        file_.Close();
+        utility::filesystem::RemoveFile(path_);
+    }
+
+    const std::string &GetPath() const { return path_; }
+
+    int64_t Size() const { return static_cast<int64_t>(slots_.size()); }
+
+    int64_t GetNumPagedOut() const { return num_paged_out_; }
+
+    int64_t GetNumPagedIn() const { return num_paged_in_; }
+
+    /// Stores n blocks. keys holds n x 3 coordinates and values n blocks of
+    /// block_bytes, both contiguous on the host.
+    void Write(const int32_t *keys, const uint8_t *values, int64_t n) {
+        for (int64_t i = 0; i < n; ++i) {
+            int64_t slot;
+            if (!free_slots_.empty()) {
+                slot = free_slots_.back();
+                free_slots_.pop_back();
+            } else {
+                slot = num_slots_++;
+            }
+            if (!SeekSet(file_.GetFILE(), slot * block_bytes_) ||
+                fwrite(values + i * block_bytes_, 1, block_bytes_,
+                       file_.GetFILE()) != static_cast<size_t>(block_bytes_)) {
+                utility::LogError(
+                        "[TSDFVoxelGrid] unable to write block store {}.",
+                        path_);
+            }
+            slots_[Eigen::Vector3i(keys[3 * i + 0], keys[3 * i + 1],
+                                   keys[3 * i + 2])] = slot;
+        }
+        num_paged_out_ += n;
+    }
+
+    /// Removes the blocks of the n x 3 keys that are in the store. Returns
+    /// their indices in keys, and fills values with their data in the same
+    /// order.
+    std::vector<int64_t> Read(const int32_t *keys,
+                              int64_t n,
+                              std::vector<uint8_t> &values) {
+        std::vector<std::pair<int64_t, int64_t>> slot_indices;
+        for (int64_t i = 0; i < n; ++i) {
+            auto it = slots_.find(Eigen::Vector3i(
+                    keys[3 * i + 0], keys[3 * i + 1], keys[3 * i + 2]));
+            if (it != slots_.end()) {
+                slot_indices.emplace_back(it->second, i);
+                free_slots_.push_back(it->second);
+                slots_.erase(it);
+            }
+        }
+        // Read in file order.
+        std::sort(slot_indices.begin(), slot_indices.end());
+
+        std::vector<int64_t> indices(slot_indices.size());
+        values.resize(slot_indices.size() * block_bytes_);
+        for (size_t j = 0; j < slot_indices.size(); ++j) {
+            const int64_t offset = slot_indices[j].first * block_bytes_;
+            if (!SeekSet(file_.GetFILE(), offset) ||
+                fread(values.data() + j * block_bytes_, 1, block_bytes_,
+                      file_.GetFILE()) != static_cast<size_t>(block_bytes_)) {
+                utility::LogError(
+                        "[TSDFVoxelGrid] unable to read block store {}.",
+                        path_);
+            }
+            indices[j] = slot_indices[j].second;
+        }
+        num_paged_in_ += static_cast<int64_t>(indices.size());
+        return indices;
+    }
+
+    /// Returns the keys of all stored blocks, flattened.
+    std::vector<int32_t> GetKeys() const {
+        std::vector<int32_t> keys;
+        keys.reserve(slots_.size() * 3);
+        for (const auto &it : slots_) {
+            keys.insert(keys.end(), it.first.data(), it.first.data() + 3);
+        }
+        return keys;
+    }
+
+private:
+    std::string path_;
+    int64_t block_bytes_;
+    utility::filesystem::CFile file_;
+
+    std::unordered_map<Eigen::Vector3i,
+                       int64_t,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            slots_;
+    std::vector<int64_t> free_slots_;
+    int64_t num_slots_ = 0;
+
+    int64_t num_paged_out_ = 0;
+    int64_t num_paged_in_ = 0;
+};
+
 TSDFVoxelGrid::TSDFVoxelGrid(
         std::unordered_map<std::string, core::Dtype> attr_dtype_map,
         float voxel_size,
@@ -152,6 +281,11 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                         block_coords, block_resolution_, voxel_size_,
                         sdf_trunc_);
 
+    // Bring back the evicted blocks that are observed again.
+    if (block_store_ != nullptr) {
+        PageIn(block_coords);
+    }
+
     // Active voxel blocks in the block hashmap.
     core::Tensor addrs, masks;
     int64_t n = block_hashmap_->Size();
@@ -209,6 +343,10 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                             block_hashmap_->GetKeyTensor(), dst, intrinsics,
                             extrinsics, block_resolution_, voxel_size_,
                             sdf_trunc_, depth_scale, depth_max);
+
+    if (block_store_ != nullptr) {
+        Evict(addrs, masks, extrinsics);
+    }
 }
 
 std::unordered_map<TSDFVoxelGrid::SurfaceMaskCode, core::Tensor>
@@ -240,12 +378,21 @@ TSDFVoxelGrid::RayCast(const core::Tensor &intrinsics,
                 core::Tensor({height, width, 3}, core::Dtype::Float32, device_);
     }
 
+    // Without a previous integration, bound the rays with all the blocks.
+    core::Tensor block_coords = active_block_coords_;
+    if (block_coords.NumElements() == 0) {
+        core::Tensor active_addrs;
+        block_hashmap_->GetActiveIndices(active_addrs);
+        block_coords = block_hashmap_->GetKeyTensor().IndexGet(
+                {active_addrs.To(core::Dtype::Int64)});
+    }
+
     core::Tensor range_minmax_map;
     int down_factor = 8;
-    kernel::tsdf::EstimateRange(active_block_coords_, range_minmax_map,
-                                intrinsics, extrinsics, height, width,
-                                down_factor, block_resolution_, voxel_size_,
-                                depth_min, depth_max);
+    kernel::tsdf::EstimateRange(block_coords, range_minmax_map, intrinsics,
+                                extrinsics, height, width, down_factor,
+                                block_resolution_, voxel_size_, depth_min,
+                                depth_max);
 
     core::Tensor block_values = block_hashmap_->GetValueTensor();
     auto device_hashmap = block_hashmap_->GetDeviceHashmap();
@@ -355,6 +502,13 @@ TSDFVoxelGrid TSDFVoxelGrid::To(const core::Device &device, bool copy) const {
         return *this;
     }
 
+    if (block_store_ != nullptr && block_store_->Size() > 0) {
+        utility::LogWarning(
+                "[TSDFVoxelGrid] {} evicted blocks are not copied, call "
+                "DisableStreaming() first to copy the full map.",
+                block_store_->Size());
+    }
+
     TSDFVoxelGrid device_tsdf_voxelgrid(attr_dtype_map_, voxel_size_,
                                         sdf_trunc_, block_resolution_,
                                         block_count_, device);
@@ -363,6 +517,176 @@ TSDFVoxelGrid TSDFVoxelGrid::To(const core::Device &device, bool copy) const {
     return device_tsdf_voxelgrid;
 }
 
+void TSDFVoxelGrid::EnableStreaming(const std::string &store_path,
+                                    int64_t max_resident_blocks) {
+    if (max_resident_blocks <= 0) {
+        utility::LogError(
+                "[TSDFVoxelGrid] max_resident_blocks must be positive, but "
+                "got {}.",
+                max_resident_blocks);
+    }
+    if (block_store_ != nullptr && block_store_->GetPath() != store_path) {
+        utility::LogError(
+                "[TSDFVoxelGrid] streaming is already enabled with store {}, "
+                "call DisableStreaming() first.",
+                block_store_->GetPath());
+    }
+    if (block_store_ == nullptr) {
+        block_store_ = std::make_shared<BlockStore>(
+                store_path, block_hashmap_->GetValueBytesize());
+    }
+    max_resident_blocks_ = max_resident_blocks;
+}
+
+void TSDFVoxelGrid::DisableStreaming() {
+    if (block_store_ == nullptr) {
+        return;
+    }
+    std::vector<int32_t> keys = block_store_->GetKeys();
+    if (!keys.empty()) {
+        int64_t n = static_cast<int64_t>(keys.size()) / 3;
+        PageIn(core::Tensor(keys, {n, 3}, core::Dtype::Int32));
+    }
+    block_store_ = nullptr;
+    max_resident_blocks_ = -1;
+}
+
+TSDFVoxelGrid::StreamingStatistics TSDFVoxelGrid::GetStreamingStatistics()
+        const {
+    const int64_t block_bytes = block_hashmap_->GetValueBytesize();
+    StreamingStatistics stats;
+    stats.num_resident_blocks_ = block_hashmap_->Size();
+    stats.resident_bytes_ = stats.num_resident_blocks_ * block_bytes;
+    if (block_store_ != nullptr) {
+        stats.num_evicted_blocks_ = block_store_->Size();
+        stats.evicted_bytes_ = stats.num_evicted_blocks_ * block_bytes;
+        stats.num_blocks_paged_out_ = block_store_->GetNumPagedOut();
+        stats.num_blocks_paged_in_ = block_store_->GetNumPagedIn();
+    }
+    return stats;
+}
+
+void TSDFVoxelGrid::PageIn(const core::Tensor &block_coords) {
+    if (block_store_->Size() == 0) {
+        return;
+    }
+
+    core::Device host("CPU:0");
+    core::Tensor coords = block_coords.To(host).Contiguous();
+    std::vector<uint8_t> values;
+    std::vector<int64_t> indices = block_store_->Read(
+            coords.GetDataPtr<int32_t>(), coords.GetLength(), values);
+    int64_t n = static_cast<int64_t>(indices.size());
+    if (n == 0) {
+        return;
+    }
+
+    core::Tensor keys = coords.IndexGet(
+            {core::Tensor(indices, {n}, core::Dtype::Int64)});
+    int64_t voxel_bytes = block_hashmap_->GetValueBytesize() /
+                          (block_resolution_ * block_resolution_ *
+                           block_resolution_);
+    core::Tensor blocks(values,
+                        {n, block_resolution_, block_resolution_,
+                         block_resolution_, voxel_bytes},
+                        core::Dtype::UInt8);
+
+    core::Tensor addrs, masks;
+    block_hashmap_->Insert(keys.To(device_), blocks.To(device_), addrs,
+                           masks);
+}
+
+void TSDFVoxelGrid::Evict(const core::Tensor &frustum_addrs,
+                          const core::Tensor &frustum_masks,
+                          const core::Tensor &extrinsics) {
+    int64_t num_evict = block_hashmap_->Size() - max_resident_blocks_;
+    if (num_evict <= 0) {
+        return;
+    }
+
+    core::Device host("CPU:0");
+    core::Tensor active_addrs;
+    block_hashmap_->GetActiveIndices(active_addrs);
+    active_addrs = active_addrs.To(core::Dtype::Int64);
+    core::Tensor active_keys =
+            block_hashmap_->GetKeyTensor().IndexGet({active_addrs}).To(host);
+    active_addrs = active_addrs.To(host);
+
+    std::vector<bool> in_frustum(block_hashmap_->GetCapacity(), false);
+    core::Tensor kept_addrs = frustum_addrs.To(core::Dtype::Int64)
+                                      .IndexGet({frustum_masks})
+                                      .To(host);
+    const int64_t *kept_addrs_ptr = kept_addrs.GetDataPtr<int64_t>();
+    for (int64_t i = 0; i < kept_addrs.GetLength(); ++i) {
+        in_frustum[kept_addrs_ptr[i]] = true;
+    }
+
+    // Camera center in the world frame, from the world to camera extrinsics.
+    core::Tensor T = extrinsics.To(host, core::Dtype::Float64).Contiguous();
+    const double *T_ptr = T.GetDataPtr<double>();
+    Eigen::Vector3d center;
+    for (int j = 0; j < 3; ++j) {
+        center(j) = -(T_ptr[j] * T_ptr[3] + T_ptr[4 + j] * T_ptr[7] +
+                      T_ptr[8 + j] * T_ptr[11]);
+    }
+
+    // Evict the blocks outside of the frustum, farthest first.
+    const int64_t *addrs_ptr = active_addrs.GetDataPtr<int64_t>();
+    const int32_t *keys_ptr = active_keys.GetDataPtr<int32_t>();
+    const double block_size = block_resolution_ * voxel_size_;
+    std::vector<std::pair<double, int64_t>> candidates;
+    for (int64_t i = 0; i < active_addrs.GetLength(); ++i) {
+        if (in_frustum[addrs_ptr[i]]) {
+            continue;
+        }
+        Eigen::Vector3d block_center(keys_ptr[3 * i + 0] + 0.5,
+                                     keys_ptr[3 * i + 1] + 0.5,
+                                     keys_ptr[3 * i + 2] + 0.5);
+        candidates.emplace_back(
+                (block_center * block_size - center).squaredNorm(), i);
+    }
+    const int64_t num_candidates = static_cast<int64_t>(candidates.size());
+    if (num_candidates < num_evict) {
+        utility::LogWarning(
+                "[TSDFVoxelGrid] {} blocks are observed by the current frame, "
+                "exceeding the streaming budget of {} blocks.",
+                block_hashmap_->Size() - num_candidates, max_resident_blocks_);
+        num_evict = num_candidates;
+    }
+    if (num_evict == 0) {
+        return;
+    }
+    std::partial_sort(candidates.begin(), candidates.begin() + num_evict,
+                      candidates.end(),
+                      std::greater<std::pair<double, int64_t>>());
+
+    std::vector<int64_t> evict_indices(num_evict);
+    for (int64_t i = 0; i < num_evict; ++i) {
+        evict_indices[i] = candidates[i].second;
+    }
+    core::Tensor evict_indices_t(evict_indices, {num_evict},
+                                 core::Dtype::Int64);
+    core::Tensor evict_keys = active_keys.IndexGet({evict_indices_t});
+    core::Tensor evict_addrs =
+            active_addrs.IndexGet({evict_indices_t}).To(device_);
+
+    // Copy the blocks to the store in chunks, to bound the host memory. The
+    // value buffer holds one element per block.
+    const core::Tensor &values = block_hashmap_->GetValueBuffer();
+    for (int64_t start = 0; start < num_evict; start += kEvictChunkSize) {
+        const int64_t end = std::min(start + kEvictChunkSize, num_evict);
+        core::Tensor chunk = values.IndexGet({evict_addrs.Slice(0, start, end)})
+                                     .To(host)
+                                     .Contiguous();
+        block_store_->Write(evict_keys[start].GetDataPtr<int32_t>(),
+                            static_cast<const uint8_t *>(chunk.GetDataPtr()),
+                            end - start);
+    }
+
+    core::Tensor erase_masks;
+    block_hashmap_->Erase(evict_keys.To(device_), erase_masks);
+}
+
 std::pair<core::Tensor, core::Tensor> TSDFVoxelGrid::BufferRadiusNeighbors(
         const core::Tensor &active_addrs) {
     // Fixed radius search for spatially hashed voxel blocks.
@@ -56,6 +56,21 @@ namespace geometry {
 /// internal Tensor.
 class TSDFVoxelGrid {
 public:
+    /// Counters of the out-of-core streaming mode, see EnableStreaming().
+    struct StreamingStatistics {
+        /// Number of blocks held in the block hashmap.
+        int64_t num_resident_blocks_ = 0;
+        /// Number of blocks held in the disk store.
+        int64_t num_evicted_blocks_ = 0;
+        /// Voxel bytes of the resident and evicted blocks.
+        int64_t resident_bytes_ = 0;
+        int64_t evicted_bytes_ = 0;
+        /// Number of blocks written to and read back from the store since
+        /// streaming was enabled.
+        int64_t num_blocks_paged_out_ = 0;
+        int64_t num_blocks_paged_in_ = 0;
+    };
+
     /// \brief Default Constructor.
     TSDFVoxelGrid(std::unordered_map<std::string, core::Dtype> attr_dtype_map =
                           {{"tsdf", core::Dtype::Float32},
@@ -102,6 +117,9 @@ public:
     /// interpolated along the ray, but color map is not trilinearly
     /// interpolated due to performance requirements. Colormap is only used for
     /// a reference now.
+    /// The ray range is estimated from the blocks touched by the last
+    /// integration, or from all blocks if nothing has been integrated, e.g.
+    /// for a grid read from a file.
     std::unordered_map<SurfaceMaskCode, core::Tensor> RayCast(
             const core::Tensor &intrinsics,
             const core::Tensor &extrinsics,
@@ -153,9 +171,55 @@ public:
 
     core::Device GetDevice() const { return device_; }
 
-    std::shared_ptr<core::Hashmap> GetBlockHashmap() { return block_hashmap_; }
+    float GetVoxelSize() const { return voxel_size_; }
+
+    float GetSDFTrunc() const { return sdf_trunc_; }
+
+    int64_t GetBlockResolution() const { return block_resolution_; }
+
+    int64_t GetBlockCount() const { return block_count_; }
+
+    std::unordered_map<std::string, core::Dtype> GetAttrDtypeMap() const {
+        return attr_dtype_map_;
+    }
+
+    std::shared_ptr<core::Hashmap> GetBlockHashmap() const {
+        return block_hashmap_;
+    }
+
+    /// Enables out-of-core streaming for scenes that do not fit in memory.
+    /// After each integration, blocks outside of the camera frustum are
+    /// evicted to a disk store at \p store_path, farthest from the camera
+    /// first, until at most \p max_resident_blocks blocks remain in the
+    /// hashmap. Blocks of the frustum are never evicted, so the budget must
+    /// cover the blocks observed by one frame. Evicted blocks are paged back
+    /// in when a later frame observes them again.
+    /// RayCast, ExtractSurfacePoints and ExtractSurfaceMesh only see the
+    /// resident blocks; call DisableStreaming() to bring back the full map.
+    /// Calling it again with the same \p store_path updates the budget.
+    void EnableStreaming(const std::string &store_path,
+                         int64_t max_resident_blocks);
+
+    /// Pages all evicted blocks back in and removes the disk store.
+    void DisableStreaming();
+
+    bool IsStreamingEnabled() const { return block_store_ != nullptr; }
+
+    StreamingStatistics GetStreamingStatistics() const;
 
 protected:
+    class BlockStore;
+
+    /// Moves the blocks of \p block_coords that are in the disk store back to
+    /// the hashmap.
+    void PageIn(const core::Tensor &block_coords);
+
+    /// Evicts blocks to the disk store until the budget is met. Blocks at
+    /// \p frustum_addrs are kept.
+    void Evict(const core::Tensor &frustum_addrs,
+               const core::Tensor &frustum_masks,
+               const core::Tensor &extrinsics);
+
     /// Return  addrs and masks for radius (3) neighbor entries.
     /// We first find all active entries in the hashmap with there coordinates.
     /// We then query these coordinates and their 3^3 neighbors.
@@ -184,6 +248,10 @@ protected:
     core::Tensor active_block_coords_;
 
     std::unordered_map<std::string, core::Dtype> attr_dtype_map_;
+
+    // Disk store of evicted blocks, only set in streaming mode.
+    std::shared_ptr<BlockStore> block_store_;
+    int64_t max_resident_blocks_ = -1;
 };
 }  // namespace geometry
 }  // namespace t
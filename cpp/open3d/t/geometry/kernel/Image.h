@@ -27,6 +27,7 @@
 #pragma once
 
 #include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
 
 namespace open3d {
 namespace t {
@@ -88,6 +89,37 @@ void ColorizeDepthCPU(const core::Tensor &src,
                       float min_value,
                       float max_value);
 
+/// Native CPU implementations of the Image filters that otherwise require
+/// IPP. Borders are replicated. Like IPP, Filter computes a correlation and
+/// FilterBilateral uses a round window.
+void RGBToGrayCPU(const core::Tensor &src, core::Tensor &dst);
+
+void ResizeCPU(const core::Tensor &src,
+               core::Tensor &dst,
+               Image::InterpType interp_type);
+
+void DilateCPU(const core::Tensor &src, core::Tensor &dst, int kernel_size);
+
+void FilterCPU(const core::Tensor &src,
+               core::Tensor &dst,
+               const core::Tensor &kernel);
+
+void FilterBilateralCPU(const core::Tensor &src,
+                        core::Tensor &dst,
+                        int kernel_size,
+                        float value_sigma,
+                        float distance_sigma);
+
+void FilterGaussianCPU(const core::Tensor &src,
+                       core::Tensor &dst,
+                       int kernel_size,
+                       float sigma);
+
+void FilterSobelCPU(const core::Tensor &src,
+                    core::Tensor &dst_dx,
+                    core::Tensor &dst_dy,
+                    int kernel_size);
+
 #ifdef BUILD_CUDA_MODULE
 void ClipTransformCUDA(const core::Tensor &src,
                        core::Tensor &dst,
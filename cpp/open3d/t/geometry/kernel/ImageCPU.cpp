@@ -24,5 +24,611 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/t/geometry/kernel/Image.h"
 #include "open3d/t/geometry/kernel/ImageImpl.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace image {
+
+// Native CPU kernels for the image filters, used when IPP is not available.
+// Images are processed in tiles of rows, one tile per task. Each tile converts
+// the source rows it needs to float once, with replicated borders, and all
+// inner loops run over contiguous (column, channel) elements of a row so that
+// they are vectorized by the compiler.
+namespace {
+
+constexpr int64_t kRowsPerTile = 16;
+
+template <typename T>
+inline T SaturateCast(float value) {
+    if (std::is_floating_point<T>::value) {
+        return static_cast<T>(value);
+    }
+    // Round half to even, like IPP.
+    value = std::nearbyint(value);
+    value = std::max(value, float(std::numeric_limits<T>::lowest()));
+    value = std::min(value, float(std::numeric_limits<T>::max()));
+    return static_cast<T>(value);
+}
+
+template <>
+inline bool SaturateCast<bool>(float value) {
+    return value != 0;
+}
+
+/// Converts a row to float and pads it with \p pad_left and \p pad_right
+/// replicated border pixels.
+template <typename scalar_t>
+void LoadPaddedRow(const scalar_t* row,
+                   int64_t cols,
+                   int64_t channels,
+                   int64_t pad_left,
+                   int64_t pad_right,
+                   float* padded_row) {
+    for (int64_t x = -pad_left; x < cols + pad_right; ++x) {
+        const scalar_t* pixel =
+                row + std::min(std::max(x, int64_t(0)), cols - 1) * channels;
+        float* padded_pixel = padded_row + (x + pad_left) * channels;
+        for (int64_t c = 0; c < channels; ++c) {
+            padded_pixel[c] = static_cast<float>(pixel[c]);
+        }
+    }
+}
+
+/// Weighted sum of rows, for linear filters.
+struct SumOp {
+    static void Init(float* acc, int64_t n) { std::fill(acc, acc + n, 0.f); }
+    static void Accumulate(float* acc, const float* row, float w, int64_t n) {
+        for (int64_t i = 0; i < n; ++i) {
+            acc[i] += w * row[i];
+        }
+    }
+};
+
+/// Maximum of rows, for dilation. Weights are ignored.
+struct MaxOp {
+    static void Init(float* acc, int64_t n) {
+        std::fill(acc, acc + n, -std::numeric_limits<float>::infinity());
+    }
+    static void Accumulate(float* acc, const float* row, float, int64_t n) {
+        for (int64_t i = 0; i < n; ++i) {
+            acc[i] = std::max(acc[i], row[i]);
+        }
+    }
+};
+
+/// Separable filter with replicated borders, computing
+/// dst(y, x) = sum_i sum_j kernel_y[i] kernel_x[j] src(y + i - ay, x + j - ax)
+/// for SumOp (a correlation), where the anchors are a = (size - 1) / 2.
+/// Each tile first filters its source rows horizontally and then combines
+/// them vertically.
+template <typename src_t, typename dst_t, typename Op>
+void FilterSeparable(const core::Tensor& src,
+                     core::Tensor& dst,
+                     const std::vector<float>& kernel_x,
+                     const std::vector<float>& kernel_y) {
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t row_size = cols * channels;
+    const int64_t size_x = int64_t(kernel_x.size());
+    const int64_t size_y = int64_t(kernel_y.size());
+    const int64_t anchor_x = (size_x - 1) / 2;
+    const int64_t anchor_y = (size_y - 1) / 2;
+    const src_t* src_ptr = src.GetDataPtr<src_t>();
+    dst_t* dst_ptr = dst.GetDataPtr<dst_t>();
+    const int64_t num_tiles = (rows + kRowsPerTile - 1) / kRowsPerTile;
+
+#pragma omp parallel
+    {
+        std::vector<float> padded_row((cols + size_x - 1) * channels);
+        std::vector<float> tile_rows((kRowsPerTile + size_y - 1) * row_size);
+        std::vector<float> acc(row_size);
+#pragma omp for schedule(static)
+        for (int64_t tile = 0; tile < num_tiles; ++tile) {
+            const int64_t y_begin = tile * kRowsPerTile;
+            const int64_t y_end = std::min(rows, y_begin + kRowsPerTile);
+            const int64_t num_src_rows = y_end - y_begin + size_y - 1;
+            for (int64_t r = 0; r < num_src_rows; ++r) {
+                const int64_t y = std::min(
+                        std::max(y_begin + r - anchor_y, int64_t(0)), rows - 1);
+                LoadPaddedRow(src_ptr + y * row_size, cols, channels, anchor_x,
+                              size_x - 1 - anchor_x, padded_row.data());
+                float* tile_row = tile_rows.data() + r * row_size;
+                Op::Init(tile_row, row_size);
+                for (int64_t j = 0; j < size_x; ++j) {
+                    Op::Accumulate(tile_row, padded_row.data() + j * channels,
+                                   kernel_x[j], row_size);
+                }
+            }
+            for (int64_t y = y_begin; y < y_end; ++y) {
+                Op::Init(acc.data(), row_size);
+                for (int64_t i = 0; i < size_y; ++i) {
+                    const float* tile_row =
+                            tile_rows.data() + (y - y_begin + i) * row_size;
+                    Op::Accumulate(acc.data(), tile_row, kernel_y[i], row_size);
+                }
+                dst_t* dst_row = dst_ptr + y * row_size;
+                for (int64_t i = 0; i < row_size; ++i) {
+                    dst_row[i] = SaturateCast<dst_t>(acc[i]);
+                }
+            }
+        }
+    }
+}
+
+/// Non-separable correlation with a (size_y, size_x) kernel in row-major
+/// order and replicated borders, with anchors a = (size - 1) / 2.
+template <typename scalar_t>
+void Filter2D(const core::Tensor& src,
+              core::Tensor& dst,
+              const std::vector<float>& kernel,
+              int64_t size_y,
+              int64_t size_x) {
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t row_size = cols * channels;
+    const int64_t padded_size = (cols + size_x - 1) * channels;
+    const int64_t anchor_x = (size_x - 1) / 2;
+    const int64_t anchor_y = (size_y - 1) / 2;
+    const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+    scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+    const int64_t num_tiles = (rows + kRowsPerTile - 1) / kRowsPerTile;
+
+#pragma omp parallel
+    {
+        std::vector<float> tile_rows((kRowsPerTile + size_y - 1) *
+                                     padded_size);
+        std::vector<float> acc(row_size);
+#pragma omp for schedule(static)
+        for (int64_t tile = 0; tile < num_tiles; ++tile) {
+            const int64_t y_begin = tile * kRowsPerTile;
+            const int64_t y_end = std::min(rows, y_begin + kRowsPerTile);
+            const int64_t num_src_rows = y_end - y_begin + size_y - 1;
+            for (int64_t r = 0; r < num_src_rows; ++r) {
+                const int64_t y = std::min(
+                        std::max(y_begin + r - anchor_y, int64_t(0)), rows - 1);
+                LoadPaddedRow(src_ptr + y * row_size, cols, channels, anchor_x,
+                              size_x - 1 - anchor_x,
+                              tile_rows.data() + r * padded_size);
+            }
+            for (int64_t y = y_begin; y < y_end; ++y) {
+                SumOp::Init(acc.data(), row_size);
+                for (int64_t i = 0; i < size_y; ++i) {
+                    const float* tile_row =
+                            tile_rows.data() + (y - y_begin + i) * padded_size;
+                    for (int64_t j = 0; j < size_x; ++j) {
+                        const float w = kernel[i * size_x + j];
+                        if (w != 0) {
+                            SumOp::Accumulate(acc.data(),
+                                              tile_row + j * channels, w,
+                                              row_size);
+                        }
+                    }
+                }
+                scalar_t* dst_row = dst_ptr + y * row_size;
+                for (int64_t i = 0; i < row_size; ++i) {
+                    dst_row[i] = SaturateCast<scalar_t>(acc[i]);
+                }
+            }
+        }
+    }
+}
+
+/// Sampling positions and weights of a resampling filter along one axis,
+/// stored as compressed rows: the output index i reads the input indices
+/// indices[begins[i]:begins[i + 1]].
+struct ResampleTaps {
+    std::vector<int64_t> begins;
+    std::vector<int64_t> indices;
+    std::vector<float> weights;
+};
+
+/// Taps mapping \p src_size pixels to \p dst_size pixels with pixel centers
+/// aligned, i.e. dst pixel i is located at src coordinate
+/// (i + 0.5) * src_size / dst_size - 0.5.
+ResampleTaps ComputeResampleTaps(int64_t src_size,
+                                 int64_t dst_size,
+                                 Image::InterpType interp_type) {
+    ResampleTaps taps;
+    taps.begins.push_back(0);
+    const double scale = double(src_size) / double(dst_size);
+    auto AddTap = [&](int64_t index, double weight) {
+        taps.indices.push_back(std::min(std::max(index, int64_t(0)),
+                                        src_size - 1));
+        taps.weights.push_back(float(weight));
+    };
+    for (int64_t i = 0; i < dst_size; ++i) {
+        const double center = (i + 0.5) * scale - 0.5;
+        if (interp_type == Image::InterpType::Super && scale > 1) {
+            // Average of the source pixels covered by the destination pixel
+            const double begin = i * scale;
+            const double end = (i + 1) * scale;
+            for (int64_t k = int64_t(std::floor(begin)); k < end; ++k) {
+                const double coverage = std::min(end, double(k + 1)) -
+                                        std::max(begin, double(k));
+                if (coverage > 1e-6) {
+                    AddTap(k, coverage / scale);
+                }
+            }
+        } else if (interp_type == Image::InterpType::Nearest) {
+            // Ties are rounded down
+            AddTap(int64_t(std::ceil(center - 0.5)), 1.0);
+        } else {
+            const double clamped =
+                    std::min(std::max(center, 0.0), double(src_size - 1));
+            const int64_t k = int64_t(std::floor(clamped));
+            const double t = clamped - k;
+            AddTap(k, 1.0 - t);
+            if (t > 0) {
+                AddTap(k + 1, t);
+            }
+        }
+        taps.begins.push_back(int64_t(taps.indices.size()));
+    }
+    return taps;
+}
+
+template <typename scalar_t>
+void ResizeSeparable(const core::Tensor& src,
+                     core::Tensor& dst,
+                     Image::InterpType interp_type) {
+    const int64_t src_rows = src.GetShape(0);
+    const int64_t src_cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t dst_rows = dst.GetShape(0);
+    const int64_t dst_cols = dst.GetShape(1);
+    const int64_t src_row_size = src_cols * channels;
+    const int64_t dst_row_size = dst_cols * channels;
+    const ResampleTaps taps_x =
+            ComputeResampleTaps(src_cols, dst_cols, interp_type);
+    const ResampleTaps taps_y =
+            ComputeResampleTaps(src_rows, dst_rows, interp_type);
+    const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+    scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+    const int64_t num_tiles = (dst_rows + kRowsPerTile - 1) / kRowsPerTile;
+
+#pragma omp parallel
+    {
+        std::vector<float> tile_rows;
+        std::vector<float> acc(dst_row_size);
+#pragma omp for schedule(static)
+        for (int64_t tile = 0; tile < num_tiles; ++tile) {
+            const int64_t y_begin = tile * kRowsPerTile;
+            const int64_t y_end = std::min(dst_rows, y_begin + kRowsPerTile);
+            // Source rows are clamped indices, so they are sorted.
+            const int64_t src_y_begin = taps_y.indices[taps_y.begins[y_begin]];
+            const int64_t src_y_end =
+                    taps_y.indices[taps_y.begins[y_end] - 1] + 1;
+            tile_rows.assign((src_y_end - src_y_begin) * dst_row_size, 0.f);
+            for (int64_t src_y = src_y_begin; src_y < src_y_end; ++src_y) {
+                const scalar_t* src_row = src_ptr + src_y * src_row_size;
+                float* tile_row =
+                        tile_rows.data() + (src_y - src_y_begin) * dst_row_size;
+                for (int64_t x = 0; x < dst_cols; ++x) {
+                    for (int64_t k = taps_x.begins[x]; k < taps_x.begins[x + 1];
+                         ++k) {
+                        const scalar_t* pixel =
+                                src_row + taps_x.indices[k] * channels;
+                        for (int64_t c = 0; c < channels; ++c) {
+                            tile_row[x * channels + c] +=
+                                    taps_x.weights[k] * float(pixel[c]);
+                        }
+                    }
+                }
+            }
+            for (int64_t y = y_begin; y < y_end; ++y) {
+                SumOp::Init(acc.data(), dst_row_size);
+                for (int64_t k = taps_y.begins[y]; k < taps_y.begins[y + 1];
+                     ++k) {
+                    const float* tile_row =
+                            tile_rows.data() +
+                            (taps_y.indices[k] - src_y_begin) * dst_row_size;
+                    SumOp::Accumulate(acc.data(), tile_row, taps_y.weights[k],
+                                      dst_row_size);
+                }
+                scalar_t* dst_row = dst_ptr + y * dst_row_size;
+                for (int64_t i = 0; i < dst_row_size; ++i) {
+                    dst_row[i] = SaturateCast<scalar_t>(acc[i]);
+                }
+            }
+        }
+    }
+}
+
+template <typename scalar_t>
+void ResizeNearest(const core::Tensor& src, core::Tensor& dst) {
+    const int64_t channels = src.GetShape(2);
+    const int64_t dst_rows = dst.GetShape(0);
+    const int64_t dst_cols = dst.GetShape(1);
+    const int64_t src_row_size = src.GetShape(1) * channels;
+    const ResampleTaps taps_x = ComputeResampleTaps(
+            src.GetShape(1), dst_cols, Image::InterpType::Nearest);
+    const ResampleTaps taps_y = ComputeResampleTaps(
+            src.GetShape(0), dst_rows, Image::InterpType::Nearest);
+    const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+    scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+
+#pragma omp parallel for schedule(static)
+    for (int64_t y = 0; y < dst_rows; ++y) {
+        const scalar_t* src_row = src_ptr + taps_y.indices[y] * src_row_size;
+        scalar_t* dst_row = dst_ptr + y * dst_cols * channels;
+        for (int64_t x = 0; x < dst_cols; ++x) {
+            std::copy(src_row + taps_x.indices[x] * channels,
+                      src_row + (taps_x.indices[x] + 1) * channels,
+                      dst_row + x * channels);
+        }
+    }
+}
+
+/// Bilateral filter with a round window of the given radius and replicated
+/// borders. The value distance of multi-channel pixels is the L1 norm of their
+/// difference, as in IPP.
+template <typename scalar_t>
+void FilterBilateralTiled(const core::Tensor& src,
+                          core::Tensor& dst,
+                          int64_t radius,
+                          float value_sigma,
+                          float distance_sigma) {
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t row_size = cols * channels;
+    const int64_t padded_size = (cols + 2 * radius) * channels;
+    const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+    scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+
+    struct Offset {
+        int64_t dy;
+        int64_t dx;
+        float weight;
+    };
+    std::vector<Offset> offsets;
+    for (int64_t dy = -radius; dy <= radius; ++dy) {
+        for (int64_t dx = -radius; dx <= radius; ++dx) {
+            if (dy * dy + dx * dx <= radius * radius) {
+                offsets.push_back(
+                        {dy, dx,
+                         std::exp(-float(dy * dy + dx * dx) /
+                                  (2 * distance_sigma * distance_sigma))});
+            }
+        }
+    }
+
+    // Value weights are tabulated for 8-bit images.
+    const float value_coeff = -1.f / (2 * value_sigma * value_sigma);
+    std::vector<float> value_weights;
+    if (std::is_same<scalar_t, uint8_t>::value) {
+        value_weights.resize(255 * channels + 1);
+        for (size_t d = 0; d < value_weights.size(); ++d) {
+            value_weights[d] = std::exp(float(d * d) * value_coeff);
+        }
+    }
+
+    const int64_t num_tiles = (rows + kRowsPerTile - 1) / kRowsPerTile;
+#pragma omp parallel
+    {
+        std::vector<float> tile_rows((kRowsPerTile + 2 * radius) *
+                                     padded_size);
+        std::vector<float> sum_weights(cols);
+        std::vector<float> sum_values(row_size);
+        std::vector<float> weights(cols);
+#pragma omp for schedule(static)
+        for (int64_t tile = 0; tile < num_tiles; ++tile) {
+            const int64_t y_begin = tile * kRowsPerTile;
+            const int64_t y_end = std::min(rows, y_begin + kRowsPerTile);
+            const int64_t num_src_rows = y_end - y_begin + 2 * radius;
+            for (int64_t r = 0; r < num_src_rows; ++r) {
+                const int64_t y = std::min(
+                        std::max(y_begin + r - radius, int64_t(0)), rows - 1);
+                LoadPaddedRow(src_ptr + y * row_size, cols, channels, radius,
+                              radius, tile_rows.data() + r * padded_size);
+            }
+            for (int64_t y = y_begin; y < y_end; ++y) {
+                const float* center = tile_rows.data() +
+                                      (y - y_begin + radius) * padded_size +
+                                      radius * channels;
+                std::fill(sum_weights.begin(), sum_weights.end(), 0.f);
+                std::fill(sum_values.begin(), sum_values.end(), 0.f);
+                for (const Offset& offset : offsets) {
+                    const float* neighbor =
+                            center + offset.dy * padded_size +
+                            offset.dx * channels;
+                    for (int64_t x = 0; x < cols; ++x) {
+                        float dist = 0;
+                        for (int64_t c = 0; c < channels; ++c) {
+                            dist += std::abs(neighbor[x * channels + c] -
+                                             center[x * channels + c]);
+                        }
+                        weights[x] = offset.weight *
+                                     (value_weights.empty()
+                                              ? std::exp(dist * dist *
+                                                         value_coeff)
+                                              : value_weights[int64_t(dist)]);
+                    }
+                    for (int64_t x = 0; x < cols; ++x) {
+                        sum_weights[x] += weights[x];
+                        for (int64_t c = 0; c < channels; ++c) {
+                            sum_values[x * channels + c] +=
+                                    weights[x] * neighbor[x * channels + c];
+                        }
+                    }
+                }
+                scalar_t* dst_row = dst_ptr + y * row_size;
+                for (int64_t x = 0; x < cols; ++x) {
+                    for (int64_t c = 0; c < channels; ++c) {
+                        dst_row[x * channels + c] = SaturateCast<scalar_t>(
+                                sum_values[x * channels + c] / sum_weights[x]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <typename scalar_t>
+void RGBToGrayPixels(const core::Tensor& src, core::Tensor& dst) {
+    const int64_t num_pixels = src.GetShape(0) * src.GetShape(1);
+    const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+    scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_pixels; ++i) {
+        dst_ptr[i] = SaturateCast<scalar_t>(0.299f * float(src_ptr[3 * i]) +
+                                            0.587f * float(src_ptr[3 * i + 1]) +
+                                            0.114f * float(src_ptr[3 * i + 2]));
+    }
+}
+
+}  // namespace
+
+void RGBToGrayCPU(const core::Tensor& src, core::Tensor& dst) {
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(),
+                               [&]() { RGBToGrayPixels<scalar_t>(src, dst); });
+}
+
+void ResizeCPU(const core::Tensor& src,
+               core::Tensor& dst,
+               Image::InterpType interp_type) {
+    if (interp_type != Image::InterpType::Nearest &&
+        interp_type != Image::InterpType::Linear &&
+        interp_type != Image::InterpType::Super) {
+        utility::LogError("Unsupported interp type {} on CPU.",
+                          static_cast<int>(interp_type));
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        if (interp_type == Image::InterpType::Nearest) {
+            ResizeNearest<scalar_t>(src, dst);
+        } else {
+            ResizeSeparable<scalar_t>(src, dst, interp_type);
+        }
+    });
+}
+
+void DilateCPU(const core::Tensor& src, core::Tensor& dst, int kernel_size) {
+    const std::vector<float> kernel(kernel_size, 1.f);
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        FilterSeparable<scalar_t, scalar_t, MaxOp>(src, dst, kernel, kernel);
+    });
+}
+
+void FilterCPU(const core::Tensor& src,
+               core::Tensor& dst,
+               const core::Tensor& kernel) {
+    const int64_t size_y = kernel.GetShape(0);
+    const int64_t size_x = kernel.GetShape(1);
+    // Like IPP and NPP, the kernel is applied as a correlation.
+    const std::vector<float> kernel_data =
+            kernel.To(core::Device("CPU:0"), core::Dtype::Float32)
+                    .Contiguous()
+                    .ToFlatVector<float>();
+
+    // Use two 1D passes if the kernel is the outer product of a column and a
+    // row vector, e.g. for box filters.
+    int64_t max_idx = 0;
+    for (int64_t i = 0; i < size_y * size_x; ++i) {
+        if (std::abs(kernel_data[i]) > std::abs(kernel_data[max_idx])) {
+            max_idx = i;
+        }
+    }
+    const float max_value = kernel_data[max_idx];
+    std::vector<float> kernel_y(size_y);
+    std::vector<float> kernel_x(size_x);
+    for (int64_t i = 0; i < size_y; ++i) {
+        kernel_y[i] = kernel_data[i * size_x + max_idx % size_x];
+    }
+    for (int64_t j = 0; j < size_x; ++j) {
+        kernel_x[j] = kernel_data[(max_idx / size_x) * size_x + j] / max_value;
+    }
+    bool is_separable = max_value != 0;
+    for (int64_t i = 0; i < size_y && is_separable; ++i) {
+        for (int64_t j = 0; j < size_x && is_separable; ++j) {
+            is_separable = std::abs(kernel_data[i * size_x + j] -
+                                    kernel_y[i] * kernel_x[j]) <=
+                           1e-6f * std::abs(max_value);
+        }
+    }
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        if (is_separable) {
+            FilterSeparable<scalar_t, scalar_t, SumOp>(src, dst, kernel_x,
+                                                       kernel_y);
+        } else {
+            Filter2D<scalar_t>(src, dst, kernel_data, size_y, size_x);
+        }
+    });
+}
+
+void FilterBilateralCPU(const core::Tensor& src,
+                        core::Tensor& dst,
+                        int kernel_size,
+                        float value_sigma,
+                        float distance_sigma) {
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        FilterBilateralTiled<scalar_t>(src, dst, kernel_size / 2, value_sigma,
+                                       distance_sigma);
+    });
+}
+
+void FilterGaussianCPU(const core::Tensor& src,
+                       core::Tensor& dst,
+                       int kernel_size,
+                       float sigma) {
+    std::vector<float> kernel(kernel_size);
+    float sum = 0;
+    for (int i = 0; i < kernel_size; ++i) {
+        const float x = float(i - kernel_size / 2);
+        kernel[i] = std::exp(-x * x / (2 * sigma * sigma));
+        sum += kernel[i];
+    }
+    for (float& w : kernel) {
+        w /= sum;
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        FilterSeparable<scalar_t, scalar_t, SumOp>(src, dst, kernel, kernel);
+    });
+}
+
+void FilterSobelCPU(const core::Tensor& src,
+                    core::Tensor& dst_dx,
+                    core::Tensor& dst_dy,
+                    int kernel_size) {
+    const std::vector<float> smooth =
+            kernel_size == 3 ? std::vector<float>{1, 2, 1}
+                             : std::vector<float>{1, 4, 6, 4, 1};
+    const std::vector<float> derivative =
+            kernel_size == 3 ? std::vector<float>{-1, 0, 1}
+                             : std::vector<float>{-1, -2, 0, 2, 1};
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        if (dst_dx.GetDtype() == core::Dtype::Int16) {
+            FilterSeparable<scalar_t, int16_t, SumOp>(src, dst_dx, derivative,
+                                                      smooth);
+            FilterSeparable<scalar_t, int16_t, SumOp>(src, dst_dy, smooth,
+                                                      derivative);
+        } else {
+            FilterSeparable<scalar_t, scalar_t, SumOp>(src, dst_dx, derivative,
+                                                       smooth);
+            FilterSeparable<scalar_t, scalar_t, SumOp>(src, dst_dy, smooth,
+                                                       derivative);
+        }
+    });
+}
+
+}  // namespace image
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
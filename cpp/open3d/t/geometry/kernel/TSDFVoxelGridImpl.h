@@ -40,12 +40,61 @@
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Timer.h"
 
+#if !defined(__CUDACC__)
+#include "open3d/core/hashmap/CPU/OpenAddressingHashmap.h"
+#include "open3d/core/hashmap/CPU/TBBHashmap.h"
+#endif
+
 namespace open3d {
 namespace t {
 namespace geometry {
 namespace kernel {
 namespace tsdf {
 
+#if !defined(__CUDACC__)
+/// Read-only lookup view of the CPU hashmap backends for raycasting, with the
+/// find() / end() interface of OpenAddressingHashmapImpl. The TBB map is
+/// referenced rather than copied, and must outlive the view.
+template <typename Key, typename Hash>
+class CPUHashmapLookup {
+public:
+    using Iterator =
+            typename core::OpenAddressingHashmapImpl<Key, Hash>::Iterator;
+
+    explicit CPUHashmapLookup(
+            const std::shared_ptr<core::DeviceHashmap>& hashmap) {
+        if (auto open_addressing_hashmap = std::dynamic_pointer_cast<
+                    core::OpenAddressingHashmap<Key, Hash>>(hashmap)) {
+            open_addressing_impl_ = open_addressing_hashmap->GetImpl();
+        } else if (auto tbb_hashmap = std::dynamic_pointer_cast<
+                           core::TBBHashmap<Key, Hash>>(hashmap)) {
+            tbb_impl_ = tbb_hashmap->GetImpl().get();
+        } else {
+            utility::LogError(
+                    "Unsupported backend: CPU raycasting only supports "
+                    "OpenAddressing and TBB.");
+        }
+    }
+
+    Iterator find(const Key& key) const {
+        if (tbb_impl_ == nullptr) {
+            return open_addressing_impl_.find(key);
+        }
+        auto iter = tbb_impl_->find(key);
+        if (iter == tbb_impl_->end()) {
+            return end();
+        }
+        return Iterator{iter->second, true};
+    }
+    Iterator end() const { return Iterator{0, false}; }
+
+private:
+    core::OpenAddressingHashmapImpl<Key, Hash> open_addressing_impl_;
+    const tbb::concurrent_unordered_map<Key, core::addr_t, Hash>* tbb_impl_ =
+            nullptr;
+};
+#endif
+
 #if defined(__CUDACC__)
 void IntegrateCUDA
 #else
@@ -1186,9 +1235,7 @@ void RayCastCPU
     }
     auto hashmap_impl = cuda_hashmap->GetImpl();
 #else
-    auto cpu_hashmap =
-            std::dynamic_pointer_cast<core::TBBHashmap<Key, Hash>>(hashmap);
-    auto hashmap_impl = *cpu_hashmap->GetImpl();
+    CPUHashmapLookup<Key, Hash> hashmap_impl(hashmap);
 #endif
 
     NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
@@ -0,0 +1,355 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PLYChunkReader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Helper.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+static core::Dtype PLYTypeToDtype(const std::string &type) {
+    if (type == "char" || type == "int8") {
+        return core::Dtype::Int8;
+    } else if (type == "uchar" || type == "uint8") {
+        return core::Dtype::UInt8;
+    } else if (type == "short" || type == "int16") {
+        return core::Dtype::Int16;
+    } else if (type == "ushort" || type == "uint16") {
+        return core::Dtype::UInt16;
+    } else if (type == "int" || type == "int32") {
+        return core::Dtype::Int32;
+    } else if (type == "uint" || type == "uint32") {
+        return core::Dtype::UInt32;
+    } else if (type == "float" || type == "float32") {
+        return core::Dtype::Float32;
+    } else if (type == "double" || type == "float64") {
+        return core::Dtype::Float64;
+    } else {
+        return core::Dtype::Undefined;
+    }
+}
+
+static bool ReadLine(FILE *file, std::string &line) {
+    line.clear();
+    int c;
+    while ((c = fgetc(file)) != EOF && c != '\n') {
+        line.push_back(static_cast<char>(c));
+    }
+    return c != EOF || !line.empty();
+}
+
+static bool SeekForward(FILE *file, int64_t num_bytes) {
+#ifdef _WIN32
+    return _fseeki64(file, num_bytes, SEEK_CUR) == 0;
+#else
+    return fseeko(file, static_cast<off_t>(num_bytes), SEEK_CUR) == 0;
+#endif
+}
+
+static bool IsLittleEndianHost() {
+    uint16_t x = 1;
+    return *reinterpret_cast<uint8_t *>(&x) == 1;
+}
+
+/// Copies rows [begin, end) of one column of interleaved vertex data into a
+/// strided destination, optionally reversing the byte order of each value.
+template <typename T>
+static void ScatterColumn(const char *src,
+                          int64_t src_stride,
+                          char *dst,
+                          int64_t dst_stride,
+                          int64_t begin,
+                          int64_t end,
+                          bool swap_bytes) {
+    for (int64_t i = begin; i < end; ++i) {
+        T value;
+        std::memcpy(&value, src + i * src_stride, sizeof(T));
+        if (swap_bytes) {
+            T swapped = 0;
+            for (size_t b = 0; b < sizeof(T); ++b) {
+                swapped = static_cast<T>((swapped << 8) | (value & 0xFF));
+                value = static_cast<T>(value >> 8);
+            }
+            value = swapped;
+        }
+        std::memcpy(dst + i * dst_stride, &value, sizeof(T));
+    }
+}
+
+bool PLYChunkReader::Open(const std::string &filename, int64_t chunk_size) {
+    Close();
+    if (chunk_size <= 0) {
+        utility::LogWarning("Read PLY failed: chunk_size must be positive.");
+        return false;
+    }
+    file_ = fopen(filename.c_str(), "rb");
+    if (!file_) {
+        utility::LogWarning("Read PLY failed: unable to open file: {}.",
+                            filename);
+        return false;
+    }
+    auto fail = [this](const std::string &message) {
+        utility::LogWarning("Read PLY failed: {}", message);
+        Close();
+        return false;
+    };
+
+    std::string line;
+    if (!ReadLine(file_, line) || utility::StripString(line) != "ply") {
+        return fail("not a PLY file.");
+    }
+    std::string format;
+    std::string element;
+    int64_t element_count = 0;
+    int64_t element_stride = 0;
+    bool element_has_list = false;
+    bool found_vertex = false;
+    // Bytes of the elements stored before the vertices.
+    int64_t skip_bytes = 0;
+    // Returns false if the element before the vertices has variable size.
+    auto finish_element = [&]() {
+        if (element == "vertex" && !found_vertex) {
+            found_vertex = true;
+            num_points_ = element_count;
+            stride_ = element_stride;
+            return !element_has_list;
+        } else if (!found_vertex) {
+            skip_bytes += element_count * element_stride;
+            return !element_has_list;
+        }
+        return true;
+    };
+    try {
+        while (true) {
+            if (!ReadLine(file_, line)) {
+                return fail("unexpected end of header.");
+            }
+            std::vector<std::string> tokens =
+                    utility::SplitString(line, " \t\r");
+            if (tokens.empty() || tokens[0] == "comment" ||
+                tokens[0] == "obj_info") {
+                continue;
+            } else if (tokens[0] == "format" && tokens.size() >= 2) {
+                format = tokens[1];
+            } else if (tokens[0] == "element" && tokens.size() >= 3) {
+                if (!element.empty() && !finish_element()) {
+                    return fail("list properties are not supported.");
+                }
+                element = tokens[1];
+                element_count = std::stoll(tokens[2]);
+                element_stride = 0;
+                element_has_list = false;
+            } else if (tokens[0] == "property" && tokens.size() >= 3 &&
+                       !element.empty()) {
+                if (tokens[1] == "list") {
+                    element_has_list = true;
+                    continue;
+                }
+                core::Dtype dtype = PLYTypeToDtype(tokens[1]);
+                if (dtype == core::Dtype::Undefined) {
+                    return fail(fmt::format("unsupported property type {}.",
+                                            tokens[1]));
+                }
+                if (element == "vertex" && !found_vertex) {
+                    properties_.push_back({tokens[2], dtype, element_stride});
+                }
+                element_stride += dtype.ByteSize();
+            } else if (tokens[0] == "end_header") {
+                if (!element.empty() && !finish_element()) {
+                    return fail("list properties are not supported.");
+                }
+                break;
+            } else {
+                return fail(fmt::format("invalid header line \"{}\".", line));
+            }
+        }
+    } catch (const std::exception &) {
+        return fail(fmt::format("invalid header line \"{}\".", line));
+    }
+
+    if (format == "binary_little_endian") {
+        big_endian_ = false;
+    } else if (format == "binary_big_endian") {
+        big_endian_ = true;
+    } else {
+        return fail(fmt::format(
+                "format {} is not supported, use ReadPointCloud() instead.",
+                format));
+    }
+    if (!found_vertex) {
+        return fail("no vertex element.");
+    }
+    if (!SeekForward(file_, skip_bytes)) {
+        return fail("unable to seek to the vertex element.");
+    }
+
+    // Combine x/y/z, nx/ny/nz and red/green/blue like ReadPointCloud().
+    std::unordered_map<std::string, size_t> name_to_property;
+    for (size_t i = 0; i < properties_.size(); ++i) {
+        name_to_property.emplace(properties_[i].name_, i);
+    }
+    std::vector<bool> used(properties_.size(), false);
+    const std::vector<std::pair<std::string, std::vector<std::string>>>
+            vector_attributes = {{"points", {"x", "y", "z"}},
+                                 {"normals", {"nx", "ny", "nz"}},
+                                 {"colors", {"red", "green", "blue"}}};
+    for (const auto &it : vector_attributes) {
+        Attribute attribute{it.first, core::Dtype::Undefined, {}};
+        for (const std::string &name : it.second) {
+            if (name_to_property.count(name) != 0) {
+                attribute.columns_.push_back(name_to_property.at(name));
+            }
+        }
+        if (attribute.columns_.size() != 3) {
+            continue;
+        }
+        attribute.dtype_ = properties_[attribute.columns_[0]].dtype_;
+        for (size_t column : attribute.columns_) {
+            if (properties_[column].dtype_ != attribute.dtype_) {
+                return fail(fmt::format("datatype mismatch in {}.",
+                                        attribute.name_));
+            }
+            used[column] = true;
+        }
+        attributes_.push_back(attribute);
+    }
+    for (size_t i = 0; i < properties_.size(); ++i) {
+        if (!used[i]) {
+            attributes_.push_back(
+                    {properties_[i].name_, properties_[i].dtype_, {i}});
+        }
+    }
+
+    filename_ = filename;
+    chunk_size_ = chunk_size;
+    num_points_read_ = 0;
+    return true;
+}
+
+void PLYChunkReader::Close() {
+    if (file_) {
+        fclose(file_);
+        file_ = nullptr;
+    }
+    filename_.clear();
+    num_points_ = 0;
+    num_points_read_ = 0;
+    stride_ = 0;
+    properties_.clear();
+    attributes_.clear();
+    buffer_.clear();
+    buffer_.shrink_to_fit();
+}
+
+geometry::PointCloud PLYChunkReader::NextChunk() {
+    if (!IsOpened()) {
+        utility::LogError("Read PLY failed: no file is opened.");
+    }
+    geometry::PointCloud pointcloud;
+    const int64_t num_points =
+            std::min(chunk_size_, num_points_ - num_points_read_);
+    if (num_points <= 0) {
+        return pointcloud;
+    }
+    const size_t num_bytes = static_cast<size_t>(num_points * stride_);
+    buffer_.resize(num_bytes);
+    if (fread(buffer_.data(), 1, num_bytes, file_) != num_bytes) {
+        utility::LogError("Read PLY failed: unexpected end of file {}.",
+                          filename_);
+    }
+    num_points_read_ += num_points;
+
+    struct Column {
+        int64_t src_offset_;
+        int64_t byte_size_;
+        char *dst_;
+        int64_t dst_stride_;
+    };
+    std::vector<Column> columns;
+    for (const Attribute &attribute : attributes_) {
+        const int64_t num_columns =
+                static_cast<int64_t>(attribute.columns_.size());
+        const int64_t byte_size = attribute.dtype_.ByteSize();
+        core::Tensor tensor = core::Tensor::Empty({num_points, num_columns},
+                                                  attribute.dtype_);
+        char *dst = static_cast<char *>(tensor.GetDataPtr());
+        for (int64_t j = 0; j < num_columns; ++j) {
+            columns.push_back({properties_[attribute.columns_[j]].offset_,
+                               byte_size, dst + j * byte_size,
+                               num_columns * byte_size});
+        }
+        pointcloud.SetPointAttr(attribute.name_, tensor);
+    }
+
+    // Scatter blocks of rows so that the raw data of a block stays in cache
+    // while its columns are copied.
+    const char *src = buffer_.data();
+    const bool swap_bytes = big_endian_ == IsLittleEndianHost();
+    const int64_t block_size = 4096;
+    const int64_t num_blocks = (num_points + block_size - 1) / block_size;
+#pragma omp parallel for schedule(static)
+    for (int64_t b = 0; b < num_blocks; ++b) {
+        const int64_t begin = b * block_size;
+        const int64_t end = std::min(begin + block_size, num_points);
+        for (const Column &c : columns) {
+            const char *col_src = src + c.src_offset_;
+            switch (c.byte_size_) {
+                case 1:
+                    ScatterColumn<uint8_t>(col_src, stride_, c.dst_,
+                                           c.dst_stride_, begin, end, false);
+                    break;
+                case 2:
+                    ScatterColumn<uint16_t>(col_src, stride_, c.dst_,
+                                            c.dst_stride_, begin, end,
+                                            swap_bytes);
+                    break;
+                case 4:
+                    ScatterColumn<uint32_t>(col_src, stride_, c.dst_,
+                                            c.dst_stride_, begin, end,
+                                            swap_bytes);
+                    break;
+                default:
+                    ScatterColumn<uint64_t>(col_src, stride_, c.dst_,
+                                            c.dst_stride_, begin, end,
+                                            swap_bytes);
+                    break;
+            }
+        }
+    }
+    return pointcloud;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,130 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class PLYChunkReader
+/// \brief Reads the vertices of a binary PLY file as a sequence of point
+/// clouds of at most a fixed number of points.
+///
+/// Each chunk is read with a single block read and scattered into the
+/// attribute tensors, so memory use only depends on the chunk size. The
+/// attributes are named as in ReadPointCloud(): x/y/z, nx/ny/nz and
+/// red/green/blue are combined into "points", "normals" and "colors", every
+/// other scalar vertex property becomes an {N, 1} attribute of its own name.
+///
+/// Example:
+///     PLYChunkReader reader;
+///     reader.Open("survey.ply", 1 << 20);
+///     while (!reader.IsEOF()) {
+///         geometry::PointCloud chunk = reader.NextChunk();
+///         ...
+///     }
+class PLYChunkReader {
+public:
+    PLYChunkReader() {}
+    ~PLYChunkReader() { Close(); }
+    PLYChunkReader(const PLYChunkReader &) = delete;
+    PLYChunkReader &operator=(const PLYChunkReader &) = delete;
+
+    /// Open a binary PLY file and parse its header.
+    ///
+    /// \param filename Path to the PLY file.
+    /// \param chunk_size Maximum number of points per chunk.
+    /// \return false if the file cannot be opened, is not a binary PLY file,
+    /// or its vertex element has list properties or is preceded by an
+    /// element with list properties.
+    bool Open(const std::string &filename, int64_t chunk_size = 1 << 20);
+
+    /// Close the opened file.
+    void Close();
+
+    /// Check if a file is opened.
+    bool IsOpened() const { return file_ != nullptr; }
+
+    /// Check if all points have been read.
+    bool IsEOF() const { return num_points_read_ >= num_points_; }
+
+    /// Read the next chunk of at most GetChunkSize() points. Returns an empty
+    /// point cloud once all points have been read.
+    geometry::PointCloud NextChunk();
+
+    /// Return the total number of points in the file.
+    int64_t GetNumPoints() const { return num_points_; }
+
+    /// Return the number of points read so far.
+    int64_t GetNumPointsRead() const { return num_points_read_; }
+
+    /// Return the maximum number of points per chunk.
+    int64_t GetChunkSize() const { return chunk_size_; }
+
+    /// Return filename being read.
+    std::string GetFilename() const { return filename_; }
+
+private:
+    struct Property {
+        std::string name_;
+        core::Dtype dtype_;
+        /// Byte offset of the property within a vertex.
+        int64_t offset_;
+    };
+
+    /// A point cloud attribute built from one or three vertex properties.
+    struct Attribute {
+        std::string name_;
+        core::Dtype dtype_;
+        /// Indices into properties_, one per column of the attribute.
+        std::vector<size_t> columns_;
+    };
+
+    FILE *file_ = nullptr;
+    std::string filename_;
+    bool big_endian_ = false;
+    int64_t chunk_size_ = 0;
+    int64_t num_points_ = 0;
+    int64_t num_points_read_ = 0;
+    /// Size of one vertex in bytes.
+    int64_t stride_ = 0;
+    std::vector<Property> properties_;
+    std::vector<Attribute> attributes_;
+    /// Staging buffer for the raw vertex data of one chunk.
+    std::vector<char> buffer_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
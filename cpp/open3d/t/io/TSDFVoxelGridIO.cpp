@@ -0,0 +1,317 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/TSDFVoxelGridIO.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <vector>
+
+#include "open3d/core/Blob.h"
+#include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+static const char kTSDFVoxelGridMagic[8] = {'O', '3', 'D', 'T',
+                                            'S', 'D', 'F', '\0'};
+static const uint32_t kTSDFVoxelGridVersion = 1;
+
+// Sections start at multiples of the alignment, so the mapped keys and values
+// can be used as Tensors in place.
+static const int64_t kTSDFVoxelGridAlignment = 64;
+
+// Number of blocks copied to host and written at once.
+static const int64_t kTSDFVoxelGridWriteChunkSize = 256;
+
+static int64_t AlignUp(int64_t offset) {
+    return (offset + kTSDFVoxelGridAlignment - 1) / kTSDFVoxelGridAlignment *
+           kTSDFVoxelGridAlignment;
+}
+
+template <typename T>
+static void AppendValue(std::vector<char> &buffer, const T &value) {
+    const char *bytes = reinterpret_cast<const char *>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+static void AppendString(std::vector<char> &buffer, const std::string &str) {
+    AppendValue(buffer, static_cast<uint32_t>(str.size()));
+    buffer.insert(buffer.end(), str.begin(), str.end());
+}
+
+/// Bounds checked sequential reads from a mapped file.
+class MappedFileReader {
+public:
+    MappedFileReader(const char *data, int64_t size)
+        : data_(data), size_(size) {}
+
+    template <typename T>
+    bool ReadValue(T &value) {
+        if (offset_ + static_cast<int64_t>(sizeof(T)) > size_) {
+            return false;
+        }
+        std::memcpy(&value, data_ + offset_, sizeof(T));
+        offset_ += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(std::string &str) {
+        uint32_t length;
+        if (!ReadValue(length) || offset_ + length > size_) {
+            return false;
+        }
+        str.assign(data_ + offset_, length);
+        offset_ += length;
+        return true;
+    }
+
+    int64_t GetOffset() const { return offset_; }
+
+private:
+    const char *data_;
+    int64_t size_;
+    int64_t offset_ = 0;
+};
+
+static bool DtypeFromString(const std::string &name, core::Dtype &dtype) {
+    for (const core::Dtype &candidate :
+         {core::Dtype::Float32, core::Dtype::Float64, core::Dtype::Int8,
+          core::Dtype::Int16, core::Dtype::Int32, core::Dtype::Int64,
+          core::Dtype::UInt8, core::Dtype::UInt16, core::Dtype::UInt32,
+          core::Dtype::UInt64, core::Dtype::Bool}) {
+        if (candidate.ToString() == name) {
+            dtype = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::shared_ptr<geometry::TSDFVoxelGrid> CreateTSDFVoxelGridFromFile(
+        const std::string &filename, const core::Device &device) {
+    auto voxelgrid = std::make_shared<geometry::TSDFVoxelGrid>();
+    ReadTSDFVoxelGrid(filename, *voxelgrid, device);
+    return voxelgrid;
+}
+
+bool ReadTSDFVoxelGrid(const std::string &filename,
+                       geometry::TSDFVoxelGrid &voxelgrid,
+                       const core::Device &device) {
+    auto file = std::make_shared<utility::filesystem::MappedFile>();
+    if (!file->Open(filename)) {
+        utility::LogWarning(
+                "Read TSDFVoxelGrid failed: unable to open file {}: {}",
+                filename, file->GetError());
+        return false;
+    }
+
+    MappedFileReader reader(file->GetData(), file->GetSize());
+    char magic[8];
+    uint32_t version;
+    if (!reader.ReadValue(magic) ||
+        std::memcmp(magic, kTSDFVoxelGridMagic, sizeof(magic)) != 0 ||
+        !reader.ReadValue(version)) {
+        utility::LogWarning(
+                "Read TSDFVoxelGrid failed: {} is not a TSDFVoxelGrid file.",
+                filename);
+        return false;
+    }
+    if (version != kTSDFVoxelGridVersion) {
+        utility::LogWarning(
+                "Read TSDFVoxelGrid failed: unsupported version {} in {}.",
+                version, filename);
+        return false;
+    }
+
+    float voxel_size, sdf_trunc;
+    int64_t block_resolution, block_count, num_blocks;
+    uint32_t num_attrs;
+    std::unordered_map<std::string, core::Dtype> attr_dtype_map;
+    bool success = reader.ReadValue(voxel_size) &&
+                   reader.ReadValue(sdf_trunc) &&
+                   reader.ReadValue(block_resolution) &&
+                   reader.ReadValue(block_count) &&
+                   reader.ReadValue(num_blocks) && reader.ReadValue(num_attrs);
+    for (uint32_t i = 0; success && i < num_attrs; ++i) {
+        std::string name, dtype_name;
+        core::Dtype dtype;
+        success = reader.ReadString(name) && reader.ReadString(dtype_name) &&
+                  DtypeFromString(dtype_name, dtype);
+        attr_dtype_map.emplace(name, dtype);
+    }
+    if (!success || block_resolution <= 0 || num_blocks < 0) {
+        utility::LogWarning(
+                "Read TSDFVoxelGrid failed: invalid header in {}.", filename);
+        return false;
+    }
+
+    try {
+        geometry::TSDFVoxelGrid voxelgrid_read(
+                attr_dtype_map, voxel_size, sdf_trunc, block_resolution,
+                std::max(std::max(block_count, num_blocks), int64_t(1)),
+                device);
+        std::shared_ptr<core::Hashmap> hashmap =
+                voxelgrid_read.GetBlockHashmap();
+
+        const int64_t block_bytes = hashmap->GetValueBytesize();
+        const int64_t keys_offset = AlignUp(reader.GetOffset());
+        const int64_t values_offset =
+                AlignUp(keys_offset + num_blocks * 3 * sizeof(int32_t));
+        if (values_offset + num_blocks * block_bytes > file->GetSize()) {
+            utility::LogWarning("Read TSDFVoxelGrid failed: {} is truncated.",
+                                filename);
+            return false;
+        }
+
+        if (num_blocks > 0) {
+            // The tensors share the mapping, which is released with them.
+            auto blob = std::make_shared<core::Blob>(
+                    core::Device("CPU:0"), file->GetData(),
+                    [file](void *) {});
+            core::SizeVector keys_shape{num_blocks, 3};
+            core::Tensor keys(keys_shape,
+                              core::shape_util::DefaultStrides(keys_shape),
+                              file->GetData() + keys_offset,
+                              core::Dtype::Int32, blob);
+            core::SizeVector values_shape{
+                    num_blocks, block_resolution, block_resolution,
+                    block_resolution,
+                    block_bytes / (block_resolution * block_resolution *
+                                   block_resolution)};
+            core::Tensor values(values_shape,
+                                core::shape_util::DefaultStrides(values_shape),
+                                file->GetData() + values_offset,
+                                core::Dtype::UInt8, blob);
+
+            core::Tensor addrs, masks;
+            hashmap->Insert(keys.To(device), values.To(device), addrs, masks);
+            if (hashmap->Size() != num_blocks) {
+                utility::LogWarning(
+                        "Read TSDFVoxelGrid failed: duplicate blocks in {}.",
+                        filename);
+                return false;
+            }
+        }
+        voxelgrid = voxelgrid_read;
+    } catch (const std::runtime_error &e) {
+        utility::LogWarning("Read TSDFVoxelGrid failed: {}", e.what());
+        return false;
+    }
+    return true;
+}
+
+bool WriteTSDFVoxelGrid(const std::string &filename,
+                        const geometry::TSDFVoxelGrid &voxelgrid) {
+    std::shared_ptr<core::Hashmap> hashmap = voxelgrid.GetBlockHashmap();
+    core::Tensor active_addrs;
+    hashmap->GetActiveIndices(active_addrs);
+    active_addrs = active_addrs.To(core::Dtype::Int64);
+    const int64_t num_blocks = active_addrs.GetLength();
+    const int64_t num_evicted_blocks =
+            voxelgrid.GetStreamingStatistics().num_evicted_blocks_;
+    if (num_evicted_blocks > 0) {
+        utility::LogWarning(
+                "Write TSDFVoxelGrid: {} evicted blocks are not written, call "
+                "DisableStreaming() first to write the full map.",
+                num_evicted_blocks);
+    }
+    const int64_t block_bytes = hashmap->GetValueBytesize();
+
+    std::vector<char> header;
+    header.insert(header.end(), kTSDFVoxelGridMagic,
+                  kTSDFVoxelGridMagic + sizeof(kTSDFVoxelGridMagic));
+    AppendValue(header, kTSDFVoxelGridVersion);
+    AppendValue(header, voxelgrid.GetVoxelSize());
+    AppendValue(header, voxelgrid.GetSDFTrunc());
+    AppendValue(header, voxelgrid.GetBlockResolution());
+    AppendValue(header, voxelgrid.GetBlockCount());
+    AppendValue(header, num_blocks);
+    // Sorted, so that equal grids are written to identical files.
+    std::map<std::string, core::Dtype> attr_dtype_map;
+    for (const auto &kv : voxelgrid.GetAttrDtypeMap()) {
+        attr_dtype_map.emplace(kv.first, kv.second);
+    }
+    AppendValue(header, static_cast<uint32_t>(attr_dtype_map.size()));
+    for (const auto &kv : attr_dtype_map) {
+        AppendString(header, kv.first);
+        AppendString(header, kv.second.ToString());
+    }
+    header.resize(AlignUp(header.size()), 0);
+
+    core::Tensor keys = hashmap->GetKeyTensor()
+                                .IndexGet({active_addrs})
+                                .To(core::Device("CPU:0"))
+                                .Contiguous();
+    std::vector<char> keys_padding(
+            AlignUp(keys.NumElements() * sizeof(int32_t)) -
+                    keys.NumElements() * sizeof(int32_t),
+            0);
+
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "wb")) {
+        utility::LogWarning(
+                "Write TSDFVoxelGrid failed: unable to open file {}: {}",
+                filename, file.GetError());
+        return false;
+    }
+    FILE *fp = file.GetFILE();
+    bool success =
+            fwrite(header.data(), 1, header.size(), fp) == header.size() &&
+            fwrite(keys.GetDataPtr(), sizeof(int32_t), keys.NumElements(),
+                   fp) == static_cast<size_t>(keys.NumElements()) &&
+            fwrite(keys_padding.data(), 1, keys_padding.size(), fp) ==
+                    keys_padding.size();
+
+    // Gather the blocks in chunks, to bound the extra host memory. The value
+    // buffer holds one element per block, so each block is copied at once.
+    const core::Tensor &values = hashmap->GetValueBuffer();
+    for (int64_t start = 0; success && start < num_blocks;
+         start += kTSDFVoxelGridWriteChunkSize) {
+        const int64_t end =
+                std::min(start + kTSDFVoxelGridWriteChunkSize, num_blocks);
+        core::Tensor chunk =
+                values.IndexGet({active_addrs.Slice(0, start, end)})
+                        .To(core::Device("CPU:0"))
+                        .Contiguous();
+        success = fwrite(chunk.GetDataPtr(), block_bytes, end - start, fp) ==
+                  static_cast<size_t>(end - start);
+    }
+    if (!success) {
+        utility::LogWarning("Write TSDFVoxelGrid failed: unable to write {}.",
+                            filename);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,73 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+
+#include "open3d/core/Device.h"
+#include "open3d/t/geometry/TSDFVoxelGrid.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Factory function to create a TSDFVoxelGrid from a file.
+/// Return an empty TSDFVoxelGrid if fail to read the file.
+std::shared_ptr<geometry::TSDFVoxelGrid> CreateTSDFVoxelGridFromFile(
+        const std::string &filename,
+        const core::Device &device = core::Device("CPU:0"));
+
+/// \brief Reads a TSDFVoxelGrid written by WriteTSDFVoxelGrid.
+///
+/// The file is memory mapped and the voxel blocks are inserted into the block
+/// hashmap straight from the mapping, so no reintegration or intermediate
+/// read buffer is needed. The grid can be queried with RayCast and the
+/// surface extraction functions right away.
+///
+/// \param filename Path to the file.
+/// \param voxelgrid Output TSDFVoxelGrid. Its block count is the larger of the
+/// saved block count and the number of saved blocks.
+/// \param device Device of the output TSDFVoxelGrid.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadTSDFVoxelGrid(const std::string &filename,
+                       geometry::TSDFVoxelGrid &voxelgrid,
+                       const core::Device &device = core::Device("CPU:0"));
+
+/// \brief Writes a TSDFVoxelGrid to a binary file.
+///
+/// The file holds the grid parameters and the voxel attribute dtypes, followed
+/// by the Int32 {N, 3} coordinates of the N active blocks and their voxel
+/// buffers, each section stored contiguously. Numbers are stored in the byte
+/// order of the host. In streaming mode, only the resident blocks are written.
+///
+/// \return return true if the write function is successful, false otherwise.
+bool WriteTSDFVoxelGrid(const std::string &filename,
+                        const geometry::TSDFVoxelGrid &voxelgrid);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -164,6 +164,74 @@ std::tuple<core::Tensor, core::Tensor> ComputeRtPointToPoint(
     return std::make_tuple(R, t);
 }
 
+core::Tensor SearchAndComputePosePointToPlane(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::nns::NanoFlannIndex &target_index,
+        double max_correspondence_distance,
+        int64_t &num_correspondences,
+        double &squared_error) {
+    core::Dtype dtype = core::Dtype::Float32;
+    core::Device device = source_points.GetDevice();
+
+    source_points.AssertDtype(dtype);
+    target_points.AssertDtype(dtype);
+    target_normals.AssertDtype(dtype);
+    target_points.AssertDevice(device);
+    target_normals.AssertDevice(device);
+    if (device.GetType() != core::Device::DeviceType::CPU) {
+        utility::LogError("Only CPU is supported, but got {}.",
+                          device.ToString());
+    }
+
+    core::Tensor pose = core::Tensor::Empty({6}, core::Dtype::Float64, device);
+    core::Tensor source_points_contiguous = source_points.Contiguous();
+    core::Tensor target_points_contiguous = target_points.Contiguous();
+    core::Tensor target_normals_contiguous = target_normals.Contiguous();
+
+    SearchAndComputePosePointToPlaneCPU(
+            source_points_contiguous.GetDataPtr<float>(),
+            target_points_contiguous.GetDataPtr<float>(),
+            target_normals_contiguous.GetDataPtr<float>(), target_index,
+            source_points.GetLength(),
+            static_cast<float>(max_correspondence_distance), pose,
+            num_correspondences, squared_error);
+    return pose;
+}
+
+std::tuple<core::Tensor, core::Tensor> SearchAndComputeRtPointToPoint(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::nns::NanoFlannIndex &target_index,
+        double max_correspondence_distance,
+        int64_t &num_correspondences,
+        double &squared_error) {
+    core::Dtype dtype = core::Dtype::Float32;
+    core::Device device = source_points.GetDevice();
+
+    source_points.AssertDtype(dtype);
+    target_points.AssertDtype(dtype);
+    target_points.AssertDevice(device);
+    if (device.GetType() != core::Device::DeviceType::CPU) {
+        utility::LogError("Only CPU is supported, but got {}.",
+                          device.ToString());
+    }
+
+    core::Tensor R;
+    core::Tensor t;
+    core::Tensor source_points_contiguous = source_points.Contiguous();
+    core::Tensor target_points_contiguous = target_points.Contiguous();
+
+    SearchAndComputeRtPointToPointCPU(
+            source_points_contiguous.GetDataPtr<float>(),
+            target_points_contiguous.GetDataPtr<float>(), target_index,
+            source_points.GetLength(),
+            static_cast<float>(max_correspondence_distance), R, t,
+            num_correspondences, squared_error);
+    return std::make_tuple(R, t);
+}
+
 }  // namespace kernel
 }  // namespace pipelines
 }  // namespace t
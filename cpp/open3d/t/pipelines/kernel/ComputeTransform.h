@@ -27,6 +27,7 @@
 #pragma once
 
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
 #include "open3d/t/pipelines/registration/Registration.h"
 
 namespace open3d {
@@ -60,6 +61,47 @@ std::tuple<core::Tensor, core::Tensor> ComputeRtPointToPoint(
         const core::Tensor &target_points,
         const pipelines::registration::CorrespondenceSet &correspondences);
 
+/// \brief Computes pose for point to plane registration method, searching the
+/// correspondences in the same pass.
+///
+/// Each source point is matched to its nearest target point within
+/// \p max_correspondence_distance and its contribution to the linear system
+/// is accumulated right away, so no correspondence tensors are created. Only
+/// CPU is supported.
+/// \param source_points source points of dtype Float32.
+/// \param target_points target points of dtype Float32.
+/// \param target_normals target normals of dtype Float32.
+/// \param target_index index built on \p target_points.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param num_correspondences [output] Number of correspondences found.
+/// \param squared_error [output] Sum of the squared distances of all
+/// correspondences.
+/// \return Pose [alpha beta gamma, tx, ty, tz], a shape {6} tensor of dtype
+/// Float64.
+core::Tensor SearchAndComputePosePointToPlane(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::nns::NanoFlannIndex &target_index,
+        double max_correspondence_distance,
+        int64_t &num_correspondences,
+        double &squared_error);
+
+/// \brief Computes (R) Rotation {3,3} and (t) translation {3,} for point to
+/// point registration method, searching the correspondences in the same pass.
+///
+/// See SearchAndComputePosePointToPlane for the parameters. Only CPU is
+/// supported.
+/// \return tuple of (R, t). [Dtype: Float64].
+std::tuple<core::Tensor, core::Tensor> SearchAndComputeRtPointToPoint(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::nns::NanoFlannIndex &target_index,
+        double max_correspondence_distance,
+        int64_t &num_correspondences,
+        double &squared_error);
+
 }  // namespace kernel
 }  // namespace pipelines
 }  // namespace t
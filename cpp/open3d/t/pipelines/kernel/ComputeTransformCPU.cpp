@@ -27,6 +27,7 @@
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_reduce.h>
 
+#include <array>
 #include <cmath>
 #include <functional>
 #include <vector>
@@ -41,6 +42,54 @@ namespace t {
 namespace pipelines {
 namespace kernel {
 
+/// Number of source points reduced by one task of the SearchAndCompute*
+/// kernels.
+static constexpr int64_t kSearchGrainSize = 256;
+
+/// Calls func(workload_idx, sum) for all workload_idx in [0, n) in parallel,
+/// where sum points to N doubles that func accumulates into. Each task sums
+/// into its own array and the arrays are added at the end.
+template <int N, typename Func>
+static std::array<double, N> ParallelReduceSum(int64_t n, Func func) {
+    std::array<double, N> zeros;
+    zeros.fill(0);
+    return tbb::parallel_reduce(
+            tbb::blocked_range<int64_t>(0, n, kSearchGrainSize), zeros,
+            [&](const tbb::blocked_range<int64_t> &r,
+                std::array<double, N> sum) {
+                for (int64_t i = r.begin(); i < r.end(); ++i) {
+                    func(i, sum.data());
+                }
+                return sum;
+            },
+            [](std::array<double, N> a, const std::array<double, N> &b) {
+                for (int i = 0; i < N; ++i) {
+                    a[i] += b[i];
+                }
+                return a;
+            });
+}
+
+/// Computes the rotation R {3, 3} and translation t {3,} that align the source
+/// to the target points, given their means {1, 3} and the cross-covariance
+/// Sxy = sum((t - mean_t) (s - mean_s)^T) / n, all Float64 on CPU.
+static void ComputeRtFromCovariance(const core::Tensor &mean_s,
+                                    const core::Tensor &mean_t,
+                                    const core::Tensor &Sxy,
+                                    core::Tensor &R,
+                                    core::Tensor &t) {
+    core::Device host("CPU:0");
+    core::Tensor U, D, VT;
+    std::tie(U, D, VT) = Sxy.SVD();
+    core::Tensor S = core::Tensor::Eye(3, core::Dtype::Float64, host);
+    if (U.Det() * (VT.T()).Det() < 0) {
+        S[-1][-1] = -1;
+    }
+
+    R = U.Matmul(S.Matmul(VT));
+    t = mean_t.Reshape({-1}) - R.Matmul(mean_s.T()).Reshape({-1});
+}
+
 void ComputePosePointToPlaneCPU(const float *source_points_ptr,
                                 const float *target_points_ptr,
                                 const float *target_normals_ptr,
@@ -232,15 +281,155 @@ void ComputeRtPointToPointCPU(const float *source_points_ptr,
         mean_t_ptr[j] = mean_1x6[j + 3];
     }
 
-    core::Tensor U, D, VT;
-    std::tie(U, D, VT) = Sxy.SVD();
-    core::Tensor S = core::Tensor::Eye(3, core::Dtype::Float64, host);
-    if (U.Det() * (VT.T()).Det() < 0) {
-        S[-1][-1] = -1;
+    ComputeRtFromCovariance(mean_s, mean_t, Sxy, R, t);
+}
+
+void SearchAndComputePosePointToPlaneCPU(
+        const float *source_points_ptr,
+        const float *target_points_ptr,
+        const float *target_normals_ptr,
+        const core::nns::NanoFlannIndex &target_index,
+        const int64_t n,
+        const float max_correspondence_distance,
+        core::Tensor &pose,
+        int64_t &num_correspondences,
+        double &squared_error) {
+    // Same layout as in ComputePosePointToPlaneCPU, with [27] accumulating
+    // the squared point to plane residuals and [29] the squared distances of
+    // the correspondences.
+    const std::array<double, 30> A_1x30 = ParallelReduceSum<30>(
+            n, [&](int64_t workload_idx, double *A_reduction) {
+                int64_t target_idx;
+                float distance;
+                if (!target_index.SearchNearest(
+                            source_points_ptr + 3 * workload_idx,
+                            max_correspondence_distance, target_idx,
+                            distance)) {
+                    return;
+                }
+
+                float J[6] = {0};
+                float r = 0;
+                GetJacobianPointToPlane(0, source_points_ptr,
+                                        target_points_ptr, target_normals_ptr,
+                                        &workload_idx, &target_idx, J, r);
+                for (int i = 0, j = 0; j < 6; j++) {
+                    for (int k = 0; k <= j; k++) {
+                        A_reduction[i] += J[j] * J[k];
+                        i++;
+                    }
+                    A_reduction[21 + j] += J[j] * r;
+                }
+                A_reduction[27] += r * r;
+                A_reduction[28] += 1;
+                A_reduction[29] += distance;
+            });
+
+    num_correspondences = static_cast<int64_t>(A_1x30[28]);
+    squared_error = A_1x30[29];
+    if (num_correspondences == 0) {
+        pose.Fill(0);
+        return;
     }
 
-    R = U.Matmul(S.Matmul(VT));
-    t = mean_t.Reshape({-1}) - R.Matmul(mean_s.T()).Reshape({-1});
+    core::Tensor A_reduction_tensor(
+            std::vector<double>(A_1x30.begin(), A_1x30.begin() + 29), {1, 29},
+            core::Dtype::Float64, core::Device("CPU:0"));
+    float residual;
+    int inlier_count;
+    DecodeAndSolve6x6(A_reduction_tensor, pose, residual, inlier_count);
+}
+
+void SearchAndComputeRtPointToPointCPU(
+        const float *source_points_ptr,
+        const float *target_points_ptr,
+        const core::nns::NanoFlannIndex &target_index,
+        const int64_t n,
+        const float max_correspondence_distance,
+        core::Tensor &R,
+        core::Tensor &t,
+        int64_t &num_correspondences,
+        double &squared_error) {
+    // Means and cross-covariance are accumulated in the same pass as raw sums
+    // of the points relative to the first source and target points, which
+    // keeps the sums small far from the origin: [0:2] sum of source points,
+    // [3:5] sum of target points, [6:14] sum of target * source^T (row major),
+    // [15] number of correspondences and [16] sum of squared distances.
+    double source_ref[3] = {0, 0, 0};
+    double target_ref[3] = {0, 0, 0};
+    if (n > 0) {
+        for (int j = 0; j < 3; j++) {
+            source_ref[j] = source_points_ptr[j];
+            target_ref[j] = target_points_ptr[j];
+        }
+    }
+    const std::array<double, 17> sums = ParallelReduceSum<17>(
+            n, [&](int64_t workload_idx, double *sum_reduction) {
+                const float *source_point =
+                        source_points_ptr + 3 * workload_idx;
+                int64_t target_idx;
+                float distance;
+                if (!target_index.SearchNearest(source_point,
+                                                max_correspondence_distance,
+                                                target_idx, distance)) {
+                    return;
+                }
+
+                const float *target_point = target_points_ptr + 3 * target_idx;
+                double ds[3], dt[3];
+                for (int j = 0; j < 3; j++) {
+                    ds[j] = source_point[j] - source_ref[j];
+                    dt[j] = target_point[j] - target_ref[j];
+                }
+                for (int j = 0; j < 3; j++) {
+                    sum_reduction[j] += ds[j];
+                    sum_reduction[3 + j] += dt[j];
+                    for (int k = 0; k < 3; k++) {
+                        sum_reduction[6 + 3 * j + k] += dt[j] * ds[k];
+                    }
+                }
+                sum_reduction[15] += 1;
+                sum_reduction[16] += distance;
+            });
+
+    num_correspondences = static_cast<int64_t>(sums[15]);
+    squared_error = sums[16];
+
+    core::Device host("CPU:0");
+    if (num_correspondences == 0) {
+        R = core::Tensor::Eye(3, core::Dtype::Float64, host);
+        t = core::Tensor::Zeros({3}, core::Dtype::Float64, host);
+        return;
+    }
+
+    core::Tensor mean_s =
+            core::Tensor::Empty({1, 3}, core::Dtype::Float64, host);
+    core::Tensor mean_t =
+            core::Tensor::Empty({1, 3}, core::Dtype::Float64, host);
+    core::Tensor Sxy = core::Tensor::Empty({3, 3}, core::Dtype::Float64, host);
+    double *mean_s_ptr = mean_s.GetDataPtr<double>();
+    double *mean_t_ptr = mean_t.GetDataPtr<double>();
+    double *sxy_ptr = Sxy.GetDataPtr<double>();
+
+    const double num = static_cast<double>(num_correspondences);
+    double mean_ds[3], mean_dt[3];
+    for (int j = 0; j < 3; j++) {
+        mean_ds[j] = sums[j] / num;
+        mean_dt[j] = sums[3 + j] / num;
+        mean_s_ptr[j] = source_ref[j] + mean_ds[j];
+        mean_t_ptr[j] = target_ref[j] + mean_dt[j];
+    }
+    // With ds = s - source_ref and dt = t - target_ref, the covariance
+    // sum((t - mean_t) (s - mean_s)^T) / n is
+    // sum(dt ds^T) / n - mean_dt mean_ds^T.
+    for (int j = 0; j < 3; j++) {
+        for (int k = 0; k < 3; k++) {
+            sxy_ptr[j * 3 + k] =
+                    sums[6 + 3 * j + k] / num - mean_dt[j] * mean_ds[k];
+        }
+    }
+
+    ComputeRtFromCovariance(mean_s, mean_t, Sxy, R, t);
 }
 
 }  // namespace kernel
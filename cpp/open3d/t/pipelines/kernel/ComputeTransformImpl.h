@@ -30,6 +30,7 @@
 
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
 
 namespace open3d {
 namespace t {
@@ -68,6 +69,28 @@ void ComputeRtPointToPointCPU(const float *source_points_ptr,
                               const core::Dtype dtype,
                               const core::Device device);
 
+void SearchAndComputePosePointToPlaneCPU(
+        const float *source_points_ptr,
+        const float *target_points_ptr,
+        const float *target_normals_ptr,
+        const core::nns::NanoFlannIndex &target_index,
+        const int64_t n,
+        const float max_correspondence_distance,
+        core::Tensor &pose,
+        int64_t &num_correspondences,
+        double &squared_error);
+
+void SearchAndComputeRtPointToPointCPU(
+        const float *source_points_ptr,
+        const float *target_points_ptr,
+        const core::nns::NanoFlannIndex &target_index,
+        const int64_t n,
+        const float max_correspondence_distance,
+        core::Tensor &R,
+        core::Tensor &t,
+        int64_t &num_correspondences,
+        double &squared_error);
+
 OPEN3D_HOST_DEVICE inline bool GetJacobianPointToPlane(
         int64_t workload_idx,
         const float *source_points_ptr,
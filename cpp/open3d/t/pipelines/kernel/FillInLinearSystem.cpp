@@ -185,6 +185,81 @@ void FillInSLACRegularizerTerm(core::Tensor &AtA,
     }
 }
 
+void FillInSLACAlignmentTerm(SparseLinearSystem &system,
+                             core::Tensor &residual,
+                             const core::Tensor &Ti_ps,
+                             const core::Tensor &Tj_qs,
+                             const core::Tensor &normal_ps,
+                             const core::Tensor &Ri_normal_ps,
+                             const core::Tensor &RjT_Ri_normal_ps,
+                             const core::Tensor &cgrid_idx_ps,
+                             const core::Tensor &cgrid_idx_qs,
+                             const core::Tensor &cgrid_ratio_qs,
+                             const core::Tensor &cgrid_ratio_ps,
+                             int i,
+                             int j,
+                             int n,
+                             float threshold) {
+    residual.AssertDtype(core::Dtype::Float32);
+    Ti_ps.AssertDtype(core::Dtype::Float32);
+    Tj_qs.AssertDtype(core::Dtype::Float32);
+    normal_ps.AssertDtype(core::Dtype::Float32);
+    Ri_normal_ps.AssertDtype(core::Dtype::Float32);
+    RjT_Ri_normal_ps.AssertDtype(core::Dtype::Float32);
+
+    core::Device device = residual.GetDevice();
+    if (device.GetType() != core::Device::DeviceType::CPU) {
+        utility::LogError(
+                "The sparse linear system is only supported on CPU.");
+    }
+    if (Ti_ps.GetDevice() != device) {
+        utility::LogError(
+                "Points i should have the same device as the linear system.");
+    }
+    if (Tj_qs.GetDevice() != device) {
+        utility::LogError(
+                "Points j should have the same device as the linear system.");
+    }
+    if (Ri_normal_ps.GetDevice() != device) {
+        utility::LogError(
+                "Normals i should have the same device as the linear system.");
+    }
+
+    FillInSLACAlignmentTermCPU(system, residual, Ti_ps, Tj_qs, normal_ps,
+                               Ri_normal_ps, RjT_Ri_normal_ps, cgrid_idx_ps,
+                               cgrid_idx_qs, cgrid_ratio_ps, cgrid_ratio_qs, i,
+                               j, n, threshold);
+}
+
+void FillInSLACRegularizerTerm(SparseLinearSystem &system,
+                               core::Tensor &residual,
+                               const core::Tensor &grid_idx,
+                               const core::Tensor &grid_nbs_idx,
+                               const core::Tensor &grid_nbs_mask,
+                               const core::Tensor &positions_init,
+                               const core::Tensor &positions_curr,
+                               float weight,
+                               int n,
+                               int anchor_idx) {
+    residual.AssertDtype(core::Dtype::Float32);
+
+    core::Device device = residual.GetDevice();
+    if (device.GetType() != core::Device::DeviceType::CPU) {
+        utility::LogError(
+                "The sparse linear system is only supported on CPU.");
+    }
+    if (positions_init.GetDevice() != device ||
+        positions_curr.GetDevice() != device) {
+        utility::LogError(
+                "Control grid should have the same device as the linear "
+                "system.");
+    }
+
+    FillInSLACRegularizerTermCPU(system, residual, grid_idx, grid_nbs_idx,
+                                 grid_nbs_mask, positions_init, positions_curr,
+                                 weight, n, anchor_idx);
+}
+
 }  // namespace kernel
 }  // namespace pipelines
 }  // namespace t
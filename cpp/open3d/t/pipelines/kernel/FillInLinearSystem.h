@@ -26,6 +26,8 @@
 
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/SparseLinearSystem.h"
+
 namespace open3d {
 namespace t {
 namespace pipelines {
@@ -70,6 +72,36 @@ void FillInSLACRegularizerTerm(core::Tensor &AtA,
                                int n,
                                int anchor_idx);
 
+/// Sparse counterparts of FillInSLACAlignmentTerm and
+/// FillInSLACRegularizerTerm, accumulating into a SparseLinearSystem. Only
+/// implemented on the CPU; the input tensors must be CPU tensors.
+void FillInSLACAlignmentTerm(SparseLinearSystem &system,
+                             core::Tensor &residual,
+                             const core::Tensor &Ti_qs,
+                             const core::Tensor &Tj_qs,
+                             const core::Tensor &normal_ps,
+                             const core::Tensor &Ri_normal_ps,
+                             const core::Tensor &RjT_Ri_normal_ps,
+                             const core::Tensor &cgrid_idx_ps,
+                             const core::Tensor &cgrid_idx_qs,
+                             const core::Tensor &cgrid_ratio_qs,
+                             const core::Tensor &cgrid_ratio_ps,
+                             int i,
+                             int j,
+                             int n,
+                             float threshold);
+
+void FillInSLACRegularizerTerm(SparseLinearSystem &system,
+                               core::Tensor &residual,
+                               const core::Tensor &grid_idx,
+                               const core::Tensor &grid_nbs_idx,
+                               const core::Tensor &grid_nbs_mask,
+                               const core::Tensor &positions_init,
+                               const core::Tensor &positions_curr,
+                               float weight,
+                               int n,
+                               int anchor_idx);
+
 void FillInRigidAlignmentTermCPU(core::Tensor &AtA,
                                  core::Tensor &Atb,
                                  core::Tensor &residual,
@@ -109,6 +141,33 @@ void FillInSLACRegularizerTermCPU(core::Tensor &AtA,
                                   int n,
                                   int anchor_idx);
 
+void FillInSLACAlignmentTermCPU(SparseLinearSystem &system,
+                                core::Tensor &residual,
+                                const core::Tensor &Ti_qs,
+                                const core::Tensor &Tj_qs,
+                                const core::Tensor &normal_ps,
+                                const core::Tensor &Ri_normal_ps,
+                                const core::Tensor &RjT_Ri_normal_ps,
+                                const core::Tensor &cgrid_idx_ps,
+                                const core::Tensor &cgrid_idx_qs,
+                                const core::Tensor &cgrid_ratio_qs,
+                                const core::Tensor &cgrid_ratio_ps,
+                                int i,
+                                int j,
+                                int n,
+                                float threshold);
+
+void FillInSLACRegularizerTermCPU(SparseLinearSystem &system,
+                                  core::Tensor &residual,
+                                  const core::Tensor &grid_idx,
+                                  const core::Tensor &grid_nbs_idx,
+                                  const core::Tensor &grid_nbs_mask,
+                                  const core::Tensor &positions_init,
+                                  const core::Tensor &positions_curr,
+                                  float weight,
+                                  int n,
+                                  int anchor_idx);
+
 #ifdef BUILD_CUDA_MODULE
 void FillInRigidAlignmentTermCUDA(core::Tensor &AtA,
                                   core::Tensor &Atb,
@@ -157,6 +157,83 @@ void FillInRigidAlignmentTermCPU
     Atb.IndexSet({indices}, Atb_sub + Atb_local.View({12, 1}));
 }
 
+// Computes the residual r of correspondence workload_idx and, if it is within
+// the threshold, fills in its Jacobian J of the 60 variables in idx:
+// 2 x (6 + 8 x 3) for the two poses and the 8 control grid points of p and q.
+inline OPEN3D_HOST_DEVICE bool GetSLACAlignmentJacobian(
+        int64_t workload_idx,
+        const float *Ti_Cps_ptr,
+        const float *Tj_Cqs_ptr,
+        const float *Cnormal_ps_ptr,
+        const float *Ri_Cnormal_ps_ptr,
+        const float *RjT_Ri_Cnormal_ps_ptr,
+        const int *cgrid_idx_ps_ptr,
+        const int *cgrid_idx_qs_ptr,
+        const float *cgrid_ratio_ps_ptr,
+        const float *cgrid_ratio_qs_ptr,
+        int i,
+        int j,
+        int n_frags,
+        float threshold,
+        float *J,
+        int *idx,
+        float &r) {
+    const float *Ti_Cp = Ti_Cps_ptr + 3 * workload_idx;
+    const float *Tj_Cq = Tj_Cqs_ptr + 3 * workload_idx;
+    const float *Cnormal_p = Cnormal_ps_ptr + 3 * workload_idx;
+    const float *Ri_Cnormal_p = Ri_Cnormal_ps_ptr + 3 * workload_idx;
+    const float *RjTRi_Cnormal_p = RjT_Ri_Cnormal_ps_ptr + 3 * workload_idx;
+
+    const int *cgrid_idx_p = cgrid_idx_ps_ptr + 8 * workload_idx;
+    const int *cgrid_idx_q = cgrid_idx_qs_ptr + 8 * workload_idx;
+    const float *cgrid_ratio_p = cgrid_ratio_ps_ptr + 8 * workload_idx;
+    const float *cgrid_ratio_q = cgrid_ratio_qs_ptr + 8 * workload_idx;
+
+    r = (Ti_Cp[0] - Tj_Cq[0]) * Ri_Cnormal_p[0] +
+        (Ti_Cp[1] - Tj_Cq[1]) * Ri_Cnormal_p[1] +
+        (Ti_Cp[2] - Tj_Cq[2]) * Ri_Cnormal_p[2];
+    if (abs(r) > threshold) return false;
+
+    // Jacobian w.r.t. Ti: 0-6
+    J[0] = -Tj_Cq[2] * Ri_Cnormal_p[1] + Tj_Cq[1] * Ri_Cnormal_p[2];
+    J[1] = Tj_Cq[2] * Ri_Cnormal_p[0] - Tj_Cq[0] * Ri_Cnormal_p[2];
+    J[2] = -Tj_Cq[1] * Ri_Cnormal_p[0] + Tj_Cq[0] * Ri_Cnormal_p[1];
+    J[3] = Ri_Cnormal_p[0];
+    J[4] = Ri_Cnormal_p[1];
+    J[5] = Ri_Cnormal_p[2];
+
+    // Jacobian w.r.t. Tj: 6-12
+    for (int k = 0; k < 6; ++k) {
+        J[k + 6] = -J[k];
+
+        idx[k + 0] = 6 * i + k;
+        idx[k + 6] = 6 * j + k;
+    }
+
+    // Jacobian w.r.t. C over p: 12-36
+    for (int k = 0; k < 8; ++k) {
+        J[12 + k * 3 + 0] = cgrid_ratio_p[k] * Cnormal_p[0];
+        J[12 + k * 3 + 1] = cgrid_ratio_p[k] * Cnormal_p[1];
+        J[12 + k * 3 + 2] = cgrid_ratio_p[k] * Cnormal_p[2];
+
+        idx[12 + k * 3 + 0] = 6 * n_frags + cgrid_idx_p[k] * 3 + 0;
+        idx[12 + k * 3 + 1] = 6 * n_frags + cgrid_idx_p[k] * 3 + 1;
+        idx[12 + k * 3 + 2] = 6 * n_frags + cgrid_idx_p[k] * 3 + 2;
+    }
+
+    // Jacobian w.r.t. C over q: 36-60
+    for (int k = 0; k < 8; ++k) {
+        J[36 + k * 3 + 0] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[0];
+        J[36 + k * 3 + 1] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[1];
+        J[36 + k * 3 + 2] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[2];
+
+        idx[36 + k * 3 + 0] = 6 * n_frags + cgrid_idx_q[k] * 3 + 0;
+        idx[36 + k * 3 + 1] = 6 * n_frags + cgrid_idx_q[k] * 3 + 1;
+        idx[36 + k * 3 + 2] = 6 * n_frags + cgrid_idx_q[k] * 3 + 2;
+    }
+    return true;
+}
+
 #if defined(__CUDACC__)
 void FillInSLACAlignmentTermCUDA
 #else
@@ -218,62 +295,16 @@ void FillInSLACAlignmentTermCPU
     core::kernel::CPULauncher launcher;
 #endif
     launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
-        const float *Ti_Cp = Ti_Cps_ptr + 3 * workload_idx;
-        const float *Tj_Cq = Tj_Cqs_ptr + 3 * workload_idx;
-        const float *Cnormal_p = Cnormal_ps_ptr + 3 * workload_idx;
-        const float *Ri_Cnormal_p = Ri_Cnormal_ps_ptr + 3 * workload_idx;
-        const float *RjTRi_Cnormal_p = RjT_Ri_Cnormal_ps_ptr + 3 * workload_idx;
-
-        const int *cgrid_idx_p = cgrid_idx_ps_ptr + 8 * workload_idx;
-        const int *cgrid_idx_q = cgrid_idx_qs_ptr + 8 * workload_idx;
-        const float *cgrid_ratio_p = cgrid_ratio_ps_ptr + 8 * workload_idx;
-        const float *cgrid_ratio_q = cgrid_ratio_qs_ptr + 8 * workload_idx;
-
-        float r = (Ti_Cp[0] - Tj_Cq[0]) * Ri_Cnormal_p[0] +
-                  (Ti_Cp[1] - Tj_Cq[1]) * Ri_Cnormal_p[1] +
-                  (Ti_Cp[2] - Tj_Cq[2]) * Ri_Cnormal_p[2];
-        if (abs(r) > threshold) return;
-
         // Now we fill in a 60 x 60 sub-matrix: 2 x (6 + 8 x 3)
         float J[60];
         int idx[60];
-
-        // Jacobian w.r.t. Ti: 0-6
-        J[0] = -Tj_Cq[2] * Ri_Cnormal_p[1] + Tj_Cq[1] * Ri_Cnormal_p[2];
-        J[1] = Tj_Cq[2] * Ri_Cnormal_p[0] - Tj_Cq[0] * Ri_Cnormal_p[2];
-        J[2] = -Tj_Cq[1] * Ri_Cnormal_p[0] + Tj_Cq[0] * Ri_Cnormal_p[1];
-        J[3] = Ri_Cnormal_p[0];
-        J[4] = Ri_Cnormal_p[1];
-        J[5] = Ri_Cnormal_p[2];
-
-        // Jacobian w.r.t. Tj: 6-12
-        for (int k = 0; k < 6; ++k) {
-            J[k + 6] = -J[k];
-
-            idx[k + 0] = 6 * i + k;
-            idx[k + 6] = 6 * j + k;
-        }
-
-        // Jacobian w.r.t. C over p: 12-36
-        for (int k = 0; k < 8; ++k) {
-            J[12 + k * 3 + 0] = cgrid_ratio_p[k] * Cnormal_p[0];
-            J[12 + k * 3 + 1] = cgrid_ratio_p[k] * Cnormal_p[1];
-            J[12 + k * 3 + 2] = cgrid_ratio_p[k] * Cnormal_p[2];
-
-            idx[12 + k * 3 + 0] = 6 * n_frags + cgrid_idx_p[k] * 3 + 0;
-            idx[12 + k * 3 + 1] = 6 * n_frags + cgrid_idx_p[k] * 3 + 1;
-            idx[12 + k * 3 + 2] = 6 * n_frags + cgrid_idx_p[k] * 3 + 2;
-        }
-
-        // Jacobian w.r.t. C over q: 36-60
-        for (int k = 0; k < 8; ++k) {
-            J[36 + k * 3 + 0] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[0];
-            J[36 + k * 3 + 1] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[1];
-            J[36 + k * 3 + 2] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[2];
-
-            idx[36 + k * 3 + 0] = 6 * n_frags + cgrid_idx_q[k] * 3 + 0;
-            idx[36 + k * 3 + 1] = 6 * n_frags + cgrid_idx_q[k] * 3 + 1;
-            idx[36 + k * 3 + 2] = 6 * n_frags + cgrid_idx_q[k] * 3 + 2;
+        float r;
+        if (!GetSLACAlignmentJacobian(
+                    workload_idx, Ti_Cps_ptr, Tj_Cqs_ptr, Cnormal_ps_ptr,
+                    Ri_Cnormal_ps_ptr, RjT_Ri_Cnormal_ps_ptr, cgrid_idx_ps_ptr,
+                    cgrid_idx_qs_ptr, cgrid_ratio_ps_ptr, cgrid_ratio_qs_ptr, i,
+                    j, n_frags, threshold, J, idx, r)) {
+            return;
         }
 
         // Not optimized; Switch to reduction if necessary.
@@ -372,6 +403,152 @@ inline OPEN3D_HOST_DEVICE float det3x3(float m00,
            m20 * (m01 * m12 - m02 * m11);
 }
 
+// Estimates the local rotation R of control grid point idx_i that best maps
+// the initial offsets to its valid neighbors onto the current ones. Returns
+// false if there are fewer than 3 valid neighbors.
+inline OPEN3D_HOST_DEVICE bool GetSLACRegularizerRotation(
+        int idx_i,
+        const int *idx_nbs,
+        const bool *mask_nbs,
+        const float *positions_init_ptr,
+        const float *positions_curr_ptr,
+        int anchor_idx,
+        float R[3][3]) {
+    // Build a 3x3 linear system to compute the local R
+    float cov[3][3] = {{0}};
+    float U[3][3], V[3][3], S[3];
+
+    int cnt = 0;
+    for (int k = 0; k < 6; ++k) {
+        bool mask_k = mask_nbs[k];
+        if (!mask_k) continue;
+
+        int idx_k = idx_nbs[k];
+
+        // Now build linear systems
+        float diff_ik_init[3] = {positions_init_ptr[idx_i * 3 + 0] -
+                                         positions_init_ptr[idx_k * 3 + 0],
+                                 positions_init_ptr[idx_i * 3 + 1] -
+                                         positions_init_ptr[idx_k * 3 + 1],
+                                 positions_init_ptr[idx_i * 3 + 2] -
+                                         positions_init_ptr[idx_k * 3 + 2]};
+        float diff_ik_curr[3] = {positions_curr_ptr[idx_i * 3 + 0] -
+                                         positions_curr_ptr[idx_k * 3 + 0],
+                                 positions_curr_ptr[idx_i * 3 + 1] -
+                                         positions_curr_ptr[idx_k * 3 + 1],
+                                 positions_curr_ptr[idx_i * 3 + 2] -
+                                         positions_curr_ptr[idx_k * 3 + 2]};
+
+        // Build linear system by computing XY^T when formulating Y = RX
+        // Y: curr
+        // X: init
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                cov[i][j] += diff_ik_init[i] * diff_ik_curr[j];
+            }
+        }
+        ++cnt;
+    }
+
+    if (cnt < 3) {
+        return false;
+    }
+
+    // clang-format off
+    svd(cov[0][0], cov[0][1], cov[0][2],
+        cov[1][0], cov[1][1], cov[1][2],
+        cov[2][0], cov[2][1], cov[2][2],
+        U[0][0], U[0][1], U[0][2],
+        U[1][0], U[1][1], U[1][2],
+        U[2][0], U[2][1], U[2][2],
+        S[0], S[1], S[2],
+        V[0][0], V[0][1], V[0][2],
+        V[1][0], V[1][1], V[1][2],
+        V[2][0], V[2][1], V[2][2]);
+
+    // TODO: det3x3 and matmul3x3
+
+    // clang-format off
+    matmul3x3_3x3(V[0][0], V[0][1], V[0][2],
+                  V[1][0], V[1][1], V[1][2],
+                  V[2][0], V[2][1], V[2][2],
+                  U[0][0], U[1][0], U[2][0],
+                  U[0][1], U[1][1], U[2][1],
+                  U[0][2], U[1][2], U[2][2],
+                  R[0][0], R[0][1], R[0][2],
+                  R[1][0], R[1][1], R[1][2],
+                  R[2][0], R[2][1], R[2][2]);
+
+    float d = det3x3(R[0][0], R[0][1], R[0][2],
+                     R[1][0], R[1][1], R[1][2],
+                     R[2][0], R[2][1], R[2][2]);
+    // clang-format on
+
+    if (d < 0) {
+        // clang-format off
+        matmul3x3_3x3(V[0][0], V[0][1], V[0][2],
+                      V[1][0], V[1][1], V[1][2],
+                      V[2][0], V[2][1], V[2][2],
+                      U[0][0], U[1][0], U[2][0],
+                      U[0][1], U[1][1], U[2][1],
+                      -U[0][2], -U[1][2], -U[2][2],
+                      R[0][0], R[0][1], R[0][2],
+                      R[1][0], R[1][1], R[1][2],
+                      R[2][0], R[2][1], R[2][2]);
+        // clang-format on
+    }
+
+    // Now we have R, we build Hessian and residuals
+    // But first, we need to anchor a point
+    if (idx_i == anchor_idx) {
+        R[0][0] = R[1][1] = R[2][2] = 1;
+        R[0][1] = R[0][2] = R[1][0] = R[1][2] = R[2][0] = R[2][1] = 0;
+    }
+    return true;
+}
+
+// Residual local_r of the edge from control grid point idx_i to its neighbor
+// idx_k under the local rotation R.
+inline OPEN3D_HOST_DEVICE void GetSLACRegularizerResidual(
+        int idx_i,
+        int idx_k,
+        const float R[3][3],
+        const float *positions_init_ptr,
+        const float *positions_curr_ptr,
+        float *local_r) {
+    float diff_ik_init[3] = {
+            positions_init_ptr[idx_i * 3 + 0] -
+                    positions_init_ptr[idx_k * 3 + 0],
+            positions_init_ptr[idx_i * 3 + 1] -
+                    positions_init_ptr[idx_k * 3 + 1],
+            positions_init_ptr[idx_i * 3 + 2] -
+                    positions_init_ptr[idx_k * 3 + 2]};
+    float diff_ik_curr[3] = {
+            positions_curr_ptr[idx_i * 3 + 0] -
+                    positions_curr_ptr[idx_k * 3 + 0],
+            positions_curr_ptr[idx_i * 3 + 1] -
+                    positions_curr_ptr[idx_k * 3 + 1],
+            positions_curr_ptr[idx_i * 3 + 2] -
+                    positions_curr_ptr[idx_k * 3 + 2]};
+    float R_diff_ik_curr[3];
+
+    // clang-format off
+    matmul3x3_3x1(R[0][0], R[0][1], R[0][2],
+                  R[1][0], R[1][1], R[1][2],
+                  R[2][0], R[2][1], R[2][2],
+                  diff_ik_init[0],
+                  diff_ik_init[1],
+                  diff_ik_init[2],
+                  R_diff_ik_curr[0],
+                  R_diff_ik_curr[1],
+                  R_diff_ik_curr[2]);
+    // clang-format on
+
+    local_r[0] = diff_ik_curr[0] - R_diff_ik_curr[0];
+    local_r[1] = diff_ik_curr[1] - R_diff_ik_curr[1];
+    local_r[2] = diff_ik_curr[2] - R_diff_ik_curr[2];
+}
+
 #if defined(__CUDACC__)
 void FillInSLACRegularizerTermCUDA
 #else
@@ -419,135 +596,22 @@ void FillInSLACRegularizerTermCPU
         const int *idx_nbs = grid_nbs_idx_ptr + 6 * workload_idx;
         const bool *mask_nbs = grid_nbs_mask_ptr + 6 * workload_idx;
 
-        // Build a 3x3 linear system to compute the local R
-        float cov[3][3] = {{0}};
-        float U[3][3], V[3][3], S[3];
-
-        int cnt = 0;
-        for (int k = 0; k < 6; ++k) {
-            bool mask_k = mask_nbs[k];
-            if (!mask_k) continue;
-
-            int idx_k = idx_nbs[k];
-
-            // Now build linear systems
-            float diff_ik_init[3] = {positions_init_ptr[idx_i * 3 + 0] -
-                                             positions_init_ptr[idx_k * 3 + 0],
-                                     positions_init_ptr[idx_i * 3 + 1] -
-                                             positions_init_ptr[idx_k * 3 + 1],
-                                     positions_init_ptr[idx_i * 3 + 2] -
-                                             positions_init_ptr[idx_k * 3 + 2]};
-            float diff_ik_curr[3] = {positions_curr_ptr[idx_i * 3 + 0] -
-                                             positions_curr_ptr[idx_k * 3 + 0],
-                                     positions_curr_ptr[idx_i * 3 + 1] -
-                                             positions_curr_ptr[idx_k * 3 + 1],
-                                     positions_curr_ptr[idx_i * 3 + 2] -
-                                             positions_curr_ptr[idx_k * 3 + 2]};
-
-            // Build linear system by computing XY^T when formulating Y = RX
-            // Y: curr
-            // X: init
-            for (int i = 0; i < 3; ++i) {
-                for (int j = 0; j < 3; ++j) {
-                    cov[i][j] += diff_ik_init[i] * diff_ik_curr[j];
-                }
-            }
-            ++cnt;
-        }
-
-        if (cnt < 3) {
-            return;
-        }
-
-        // clang-format off
-        svd(cov[0][0], cov[0][1], cov[0][2],
-            cov[1][0], cov[1][1], cov[1][2],
-            cov[2][0], cov[2][1], cov[2][2],
-            U[0][0], U[0][1], U[0][2],
-            U[1][0], U[1][1], U[1][2],
-            U[2][0], U[2][1], U[2][2],
-            S[0], S[1], S[2],
-            V[0][0], V[0][1], V[0][2],
-            V[1][0], V[1][1], V[1][2],
-            V[2][0], V[2][1], V[2][2]);
-
-        // TODO: det3x3 and matmul3x3
         float R[3][3];
-
-        // clang-format off
-        matmul3x3_3x3(V[0][0], V[0][1], V[0][2],
-                      V[1][0], V[1][1], V[1][2],
-                      V[2][0], V[2][1], V[2][2],
-                      U[0][0], U[1][0], U[2][0],
-                      U[0][1], U[1][1], U[2][1],
-                      U[0][2], U[1][2], U[2][2],
-                      R[0][0], R[0][1], R[0][2],
-                      R[1][0], R[1][1], R[1][2],
-                      R[2][0], R[2][1], R[2][2]);
-
-        float d = det3x3(R[0][0], R[0][1], R[0][2],
-                         R[1][0], R[1][1], R[1][2],
-                         R[2][0], R[2][1], R[2][2]);
-        // clang-format on
-
-        if (d < 0) {
-            // clang-format off
-            matmul3x3_3x3(V[0][0], V[0][1], V[0][2],
-                          V[1][0], V[1][1], V[1][2],
-                          V[2][0], V[2][1], V[2][2],
-                          U[0][0], U[1][0], U[2][0],
-                          U[0][1], U[1][1], U[2][1],
-                          -U[0][2], -U[1][2], -U[2][2],
-                          R[0][0], R[0][1], R[0][2],
-                          R[1][0], R[1][1], R[1][2],
-                          R[2][0], R[2][1], R[2][2]);
-            // clang-format on
+        if (!GetSLACRegularizerRotation(idx_i, idx_nbs, mask_nbs,
+                                        positions_init_ptr, positions_curr_ptr,
+                                        anchor_idx, R)) {
+            return;
         }
 
-        // Now we have R, we build Hessian and residuals
-        // But first, we need to anchor a point
-        if (idx_i == anchor_idx) {
-            R[0][0] = R[1][1] = R[2][2] = 1;
-            R[0][1] = R[0][2] = R[1][0] = R[1][2] = R[2][0] = R[2][1] = 0;
-        }
         for (int k = 0; k < 6; ++k) {
             bool mask_k = mask_nbs[k];
 
             if (mask_k) {
                 int idx_k = idx_nbs[k];
 
-                float diff_ik_init[3] = {
-                        positions_init_ptr[idx_i * 3 + 0] -
-                                positions_init_ptr[idx_k * 3 + 0],
-                        positions_init_ptr[idx_i * 3 + 1] -
-                                positions_init_ptr[idx_k * 3 + 1],
-                        positions_init_ptr[idx_i * 3 + 2] -
-                                positions_init_ptr[idx_k * 3 + 2]};
-                float diff_ik_curr[3] = {
-                        positions_curr_ptr[idx_i * 3 + 0] -
-                                positions_curr_ptr[idx_k * 3 + 0],
-                        positions_curr_ptr[idx_i * 3 + 1] -
-                                positions_curr_ptr[idx_k * 3 + 1],
-                        positions_curr_ptr[idx_i * 3 + 2] -
-                                positions_curr_ptr[idx_k * 3 + 2]};
-                float R_diff_ik_curr[3];
-
-                // clang-format off
-                matmul3x3_3x1(R[0][0], R[0][1], R[0][2],
-                              R[1][0], R[1][1], R[1][2],
-                              R[2][0], R[2][1], R[2][2],
-                              diff_ik_init[0],
-                              diff_ik_init[1],
-                              diff_ik_init[2],
-                              R_diff_ik_curr[0],
-                              R_diff_ik_curr[1],
-                              R_diff_ik_curr[2]);
-                // clang-format on
-
                 float local_r[3];
-                local_r[0] = diff_ik_curr[0] - R_diff_ik_curr[0];
-                local_r[1] = diff_ik_curr[1] - R_diff_ik_curr[1];
-                local_r[2] = diff_ik_curr[2] - R_diff_ik_curr[2];
+                GetSLACRegularizerResidual(idx_i, idx_k, R, positions_init_ptr,
+                                           positions_curr_ptr, local_r);
 
                 int offset_idx_i = 3 * idx_i + 6 * n_frags;
                 int offset_idx_k = 3 * idx_k + 6 * n_frags;
@@ -609,6 +673,212 @@ void FillInSLACRegularizerTermCPU
         }
     });
 }
+
+#if !defined(__CUDACC__)
+// Adds J^T J to the upper triangular 3x3 blocks of AtA, where J holds the
+// Jacobian of the variables idx. Variables come in aligned triplets, i.e.
+// idx[3t + k] = idx[3t] + k with idx[3t] a multiple of 3.
+template <int N>
+static void AddJTJToBlocks(const float *J,
+                           const int *idx,
+                           int64_t num_blocks,
+                           SparseLinearSystem::BlockMap &blocks) {
+    static_assert(N % 3 == 0, "Variables must come in triplets.");
+    // Merge triplets referring to the same block, e.g. control grid points
+    // shared by p and q, and sort the blocks.
+    int64_t block_ids[N / 3];
+    float block_J[N / 3][3];
+    int num_unique = 0;
+    for (int t = 0; t < N / 3; ++t) {
+        const int64_t block_id = idx[3 * t] / 3;
+        int u = 0;
+        while (u < num_unique && block_ids[u] < block_id) ++u;
+        if (u < num_unique && block_ids[u] == block_id) {
+            for (int k = 0; k < 3; ++k) block_J[u][k] += J[3 * t + k];
+            continue;
+        }
+        for (int v = num_unique; v > u; --v) {
+            block_ids[v] = block_ids[v - 1];
+            for (int k = 0; k < 3; ++k) block_J[v][k] = block_J[v - 1][k];
+        }
+        block_ids[u] = block_id;
+        for (int k = 0; k < 3; ++k) block_J[u][k] = J[3 * t + k];
+        ++num_unique;
+    }
+    for (int a = 0; a < num_unique; ++a) {
+        for (int b = a; b < num_unique; ++b) {
+            auto &block = blocks[block_ids[a] * num_blocks + block_ids[b]];
+            for (int r = 0; r < 3; ++r) {
+                for (int c = 0; c < 3; ++c) {
+                    block[r * 3 + c] += block_J[a][r] * block_J[b][c];
+                }
+            }
+        }
+    }
+}
+
+void FillInSLACAlignmentTermCPU(SparseLinearSystem &system,
+                                core::Tensor &residual,
+                                const core::Tensor &Ti_Cps,
+                                const core::Tensor &Tj_Cqs,
+                                const core::Tensor &Cnormal_ps,
+                                const core::Tensor &Ri_Cnormal_ps,
+                                const core::Tensor &RjT_Ri_Cnormal_ps,
+                                const core::Tensor &cgrid_idx_ps,
+                                const core::Tensor &cgrid_idx_qs,
+                                const core::Tensor &cgrid_ratio_qs,
+                                const core::Tensor &cgrid_ratio_ps,
+                                int i,
+                                int j,
+                                int n_frags,
+                                float threshold) {
+    int64_t n = Ti_Cps.GetLength();
+    if (Tj_Cqs.GetLength() != n || Cnormal_ps.GetLength() != n ||
+        Ri_Cnormal_ps.GetLength() != n || RjT_Ri_Cnormal_ps.GetLength() != n ||
+        cgrid_idx_ps.GetLength() != n || cgrid_ratio_ps.GetLength() != n ||
+        cgrid_idx_qs.GetLength() != n || cgrid_ratio_qs.GetLength() != n) {
+        utility::LogError(
+                "Unable to setup linear system: input length mismatch.");
+    }
+
+    const int64_t n_vars = system.GetNumVars();
+    const int64_t n_blocks = system.GetNumBlocks();
+    float *residual_ptr = static_cast<float *>(residual.GetDataPtr());
+
+    const float *Ti_Cps_ptr = static_cast<const float *>(Ti_Cps.GetDataPtr());
+    const float *Tj_Cqs_ptr = static_cast<const float *>(Tj_Cqs.GetDataPtr());
+    const float *Cnormal_ps_ptr =
+            static_cast<const float *>(Cnormal_ps.GetDataPtr());
+    const float *Ri_Cnormal_ps_ptr =
+            static_cast<const float *>(Ri_Cnormal_ps.GetDataPtr());
+    const float *RjT_Ri_Cnormal_ps_ptr =
+            static_cast<const float *>(RjT_Ri_Cnormal_ps.GetDataPtr());
+    const int *cgrid_idx_ps_ptr =
+            static_cast<const int *>(cgrid_idx_ps.GetDataPtr());
+    const int *cgrid_idx_qs_ptr =
+            static_cast<const int *>(cgrid_idx_qs.GetDataPtr());
+    const float *cgrid_ratio_ps_ptr =
+            static_cast<const float *>(cgrid_ratio_ps.GetDataPtr());
+    const float *cgrid_ratio_qs_ptr =
+            static_cast<const float *>(cgrid_ratio_qs.GetDataPtr());
+
+    // Every thread accumulates into its own blocks, which are merged once.
+    double residual_sum = 0;
+#pragma omp parallel reduction(+ : residual_sum)
+    {
+        SparseLinearSystem::BlockMap blocks;
+        std::vector<double> Atb(n_vars, 0.0);
+#pragma omp for schedule(static)
+        for (int64_t workload_idx = 0; workload_idx < n; ++workload_idx) {
+            float J[60];
+            int idx[60];
+            float r;
+            if (!GetSLACAlignmentJacobian(
+                        workload_idx, Ti_Cps_ptr, Tj_Cqs_ptr, Cnormal_ps_ptr,
+                        Ri_Cnormal_ps_ptr, RjT_Ri_Cnormal_ps_ptr,
+                        cgrid_idx_ps_ptr, cgrid_idx_qs_ptr, cgrid_ratio_ps_ptr,
+                        cgrid_ratio_qs_ptr, i, j, n_frags, threshold, J, idx,
+                        r)) {
+                continue;
+            }
+            AddJTJToBlocks<60>(J, idx, n_blocks, blocks);
+            for (int k = 0; k < 60; ++k) {
+                Atb[idx[k]] += J[k] * r;
+            }
+            residual_sum += r * r;
+        }
+#pragma omp critical
+        {
+            system.AddBlocks(blocks);
+            system.AddAtb(Atb);
+        }
+    }
+    *residual_ptr += residual_sum;
+}
+
+void FillInSLACRegularizerTermCPU(SparseLinearSystem &system,
+                                  core::Tensor &residual,
+                                  const core::Tensor &grid_idx,
+                                  const core::Tensor &grid_nbs_idx,
+                                  const core::Tensor &grid_nbs_mask,
+                                  const core::Tensor &positions_init,
+                                  const core::Tensor &positions_curr,
+                                  float weight,
+                                  int n_frags,
+                                  int anchor_idx) {
+    int64_t n = grid_idx.GetLength();
+    const int64_t n_vars = system.GetNumVars();
+    const int64_t n_blocks = system.GetNumBlocks();
+    float *residual_ptr = static_cast<float *>(residual.GetDataPtr());
+
+    const int *grid_idx_ptr = static_cast<const int *>(grid_idx.GetDataPtr());
+    const int *grid_nbs_idx_ptr =
+            static_cast<const int *>(grid_nbs_idx.GetDataPtr());
+    const bool *grid_nbs_mask_ptr =
+            static_cast<const bool *>(grid_nbs_mask.GetDataPtr());
+    const float *positions_init_ptr =
+            static_cast<const float *>(positions_init.GetDataPtr());
+    const float *positions_curr_ptr =
+            static_cast<const float *>(positions_curr.GetDataPtr());
+
+    double residual_sum = 0;
+#pragma omp parallel reduction(+ : residual_sum)
+    {
+        SparseLinearSystem::BlockMap blocks;
+        std::vector<double> Atb(n_vars, 0.0);
+#pragma omp for schedule(static)
+        for (int64_t workload_idx = 0; workload_idx < n; ++workload_idx) {
+            int idx_i = grid_idx_ptr[workload_idx];
+            const int *idx_nbs = grid_nbs_idx_ptr + 6 * workload_idx;
+            const bool *mask_nbs = grid_nbs_mask_ptr + 6 * workload_idx;
+
+            float R[3][3];
+            if (!GetSLACRegularizerRotation(idx_i, idx_nbs, mask_nbs,
+                                            positions_init_ptr,
+                                            positions_curr_ptr, anchor_idx,
+                                            R)) {
+                continue;
+            }
+
+            for (int k = 0; k < 6; ++k) {
+                if (!mask_nbs[k]) continue;
+                int idx_k = idx_nbs[k];
+
+                float local_r[3];
+                GetSLACRegularizerResidual(idx_i, idx_k, R, positions_init_ptr,
+                                           positions_curr_ptr, local_r);
+                residual_sum += weight * (local_r[0] * local_r[0] +
+                                          local_r[1] * local_r[1] +
+                                          local_r[2] * local_r[2]);
+
+                // The Jacobian is [I, -I] over the points i and k.
+                const int64_t block_i = idx_i + 2 * n_frags;
+                const int64_t block_k = idx_k + 2 * n_frags;
+                auto &block_ii = blocks[block_i * n_blocks + block_i];
+                auto &block_kk = blocks[block_k * n_blocks + block_k];
+                // SVD3x3CPU.h defines a max macro, hence no std::min/max.
+                auto &block_ik = block_i < block_k
+                                         ? blocks[block_i * n_blocks + block_k]
+                                         : blocks[block_k * n_blocks + block_i];
+                for (int axis = 0; axis < 3; ++axis) {
+                    block_ii[axis * 4] += weight;
+                    block_kk[axis * 4] += weight;
+                    block_ik[axis * 4] -= weight;
+                    Atb[3 * block_i + axis] += weight * local_r[axis];
+                    Atb[3 * block_k + axis] -= weight * local_r[axis];
+                }
+            }
+        }
+#pragma omp critical
+        {
+            system.AddBlocks(blocks);
+            system.AddAtb(Atb);
+        }
+    }
+    *residual_ptr += residual_sum;
+}
+#endif
+
 }  // namespace kernel
 }  // namespace pipelines
 }  // namespace t
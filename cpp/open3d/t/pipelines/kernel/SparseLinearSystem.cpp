@@ -0,0 +1,223 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/SparseLinearSystem.h"
+
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/SparseCholesky>
+#include <algorithm>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+using SparseMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor, int64_t>;
+
+SparseLinearSystem::SparseLinearSystem(int64_t num_vars)
+    : num_vars_(num_vars) {
+    if (num_vars < 0 || num_vars % 3 != 0) {
+        utility::LogError(
+                "Number of variables must be a non-negative multiple of 3, "
+                "but got {}.",
+                num_vars);
+    }
+    Atb_.resize(num_vars, 0.0);
+}
+
+void SparseLinearSystem::AddBlocks(const BlockMap &blocks) {
+    for (const auto &kv : blocks) {
+        auto &block = blocks_[kv.first];
+        for (int k = 0; k < 9; ++k) {
+            block[k] += kv.second[k];
+        }
+    }
+}
+
+void SparseLinearSystem::AddAtb(const std::vector<double> &Atb) {
+    if (static_cast<int64_t>(Atb.size()) != num_vars_) {
+        utility::LogError("Atb has {} entries, but expected {}.", Atb.size(),
+                          num_vars_);
+    }
+    for (int64_t k = 0; k < num_vars_; ++k) {
+        Atb_[k] += Atb[k];
+    }
+}
+
+void SparseLinearSystem::AddDiagonal(int64_t begin, int64_t end, double value) {
+    if (begin < 0 || end > num_vars_ || begin > end) {
+        utility::LogError("Invalid diagonal range [{}, {}) for {} variables.",
+                          begin, end, num_vars_);
+    }
+    const int64_t num_blocks = GetNumBlocks();
+    for (int64_t k = begin; k < end; ++k) {
+        const int64_t b = k / 3;
+        blocks_[b * num_blocks + b][(k % 3) * 4] += value;
+    }
+}
+
+/// Expands the upper triangular blocks to the full symmetric matrix in CSR.
+static SparseMatrix ToSparseMatrix(const SparseLinearSystem::BlockMap &blocks,
+                                   int64_t num_vars) {
+    struct BlockEntry {
+        int64_t col;
+        const std::array<double, 9> *block;
+        bool transposed;
+    };
+    const int64_t num_blocks = num_vars / 3;
+    std::vector<std::vector<BlockEntry>> block_rows(num_blocks);
+    for (const auto &kv : blocks) {
+        const int64_t r = kv.first / num_blocks;
+        const int64_t c = kv.first % num_blocks;
+        block_rows[r].push_back({c, &kv.second, false});
+        if (r != c) {
+            block_rows[c].push_back({r, &kv.second, true});
+        }
+    }
+
+    SparseMatrix A(num_vars, num_vars);
+    int64_t *outer = A.outerIndexPtr();
+    outer[0] = 0;
+    for (int64_t r = 0; r < num_blocks; ++r) {
+        const int64_t row_nnz = 3 * block_rows[r].size();
+        for (int l = 0; l < 3; ++l) {
+            outer[3 * r + l + 1] = outer[3 * r + l] + row_nnz;
+        }
+    }
+    A.resizeNonZeros(outer[num_vars]);
+    int64_t *inner = A.innerIndexPtr();
+    double *values = A.valuePtr();
+
+#pragma omp parallel for schedule(static)
+    for (int64_t r = 0; r < num_blocks; ++r) {
+        std::vector<BlockEntry> &entries = block_rows[r];
+        std::sort(entries.begin(), entries.end(),
+                  [](const BlockEntry &a, const BlockEntry &b) {
+                      return a.col < b.col;
+                  });
+        for (int l = 0; l < 3; ++l) {
+            int64_t ptr = outer[3 * r + l];
+            for (const BlockEntry &entry : entries) {
+                for (int m = 0; m < 3; ++m) {
+                    inner[ptr] = 3 * entry.col + m;
+                    values[ptr] = entry.transposed ? (*entry.block)[m * 3 + l]
+                                                   : (*entry.block)[l * 3 + m];
+                    ++ptr;
+                }
+            }
+        }
+    }
+    return A;
+}
+
+std::tuple<core::Tensor, core::Tensor, core::Tensor>
+SparseLinearSystem::GetAtACSR() const {
+    SparseMatrix A = ToSparseMatrix(blocks_, num_vars_);
+    const int64_t nnz = A.nonZeros();
+
+    core::Tensor row_offsets(std::vector<int64_t>(A.outerIndexPtr(),
+                                                  A.outerIndexPtr() +
+                                                          num_vars_ + 1),
+                             {num_vars_ + 1}, core::Dtype::Int64);
+    core::Tensor col_indices(
+            std::vector<int64_t>(A.innerIndexPtr(), A.innerIndexPtr() + nnz),
+            {nnz}, core::Dtype::Int64);
+    core::Tensor values(std::vector<double>(A.valuePtr(), A.valuePtr() + nnz),
+                        {nnz}, core::Dtype::Float64);
+    return std::make_tuple(row_offsets, col_indices,
+                           values.To(core::Dtype::Float32));
+}
+
+core::Tensor SparseLinearSystem::GetAtb() const {
+    return core::Tensor(Atb_, {num_vars_, 1}, core::Dtype::Float64)
+            .To(core::Dtype::Float32);
+}
+
+static Eigen::VectorXd TensorToVector(const core::Tensor &b, int64_t n) {
+    if (b.NumElements() != n) {
+        utility::LogError("b has {} elements, but expected {}.",
+                          b.NumElements(), n);
+    }
+    core::Tensor b_cpu = b.To(core::Device("CPU:0"), core::Dtype::Float64)
+                                 .Contiguous();
+    return Eigen::Map<const Eigen::VectorXd>(
+            static_cast<const double *>(b_cpu.GetDataPtr()), n);
+}
+
+static core::Tensor VectorToTensor(const Eigen::VectorXd &x,
+                                   const core::SizeVector &shape) {
+    return core::Tensor(std::vector<double>(x.data(), x.data() + x.size()),
+                        {x.size()}, core::Dtype::Float64)
+            .Reshape(shape)
+            .To(core::Dtype::Float32);
+}
+
+core::Tensor SparseLinearSystem::SolvePCG(const core::Tensor &b,
+                                          int max_iterations,
+                                          double tolerance) const {
+    Eigen::VectorXd b_vec = TensorToVector(b, num_vars_);
+    SparseMatrix A = ToSparseMatrix(blocks_, num_vars_);
+
+    // Using both triangles of a row major matrix lets Eigen run the
+    // matrix-vector products with OpenMP.
+    Eigen::ConjugateGradient<SparseMatrix, Eigen::Lower | Eigen::Upper,
+                             Eigen::DiagonalPreconditioner<double>>
+            solver;
+    solver.setMaxIterations(max_iterations);
+    solver.setTolerance(tolerance);
+    solver.compute(A);
+    Eigen::VectorXd x = solver.solve(b_vec);
+    if (solver.info() != Eigen::Success) {
+        utility::LogWarning(
+                "PCG did not converge within {} iterations, relative error "
+                "{}.",
+                solver.iterations(), solver.error());
+    } else {
+        utility::LogDebug("PCG converged in {} iterations, relative error {}.",
+                          solver.iterations(), solver.error());
+    }
+    return VectorToTensor(x, b.GetShape());
+}
+
+core::Tensor SparseLinearSystem::SolveCholesky(const core::Tensor &b) const {
+    Eigen::VectorXd b_vec = TensorToVector(b, num_vars_);
+    Eigen::SparseMatrix<double, Eigen::ColMajor, int64_t> A =
+            ToSparseMatrix(blocks_, num_vars_);
+
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double, Eigen::ColMajor, int64_t>>
+            solver(A);
+    if (solver.info() != Eigen::Success) {
+        utility::LogError("Sparse LDLT factorization failed.");
+    }
+    return VectorToTensor(solver.solve(b_vec), b.GetShape());
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
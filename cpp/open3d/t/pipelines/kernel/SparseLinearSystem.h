@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// \class SparseLinearSystem
+///
+/// Symmetric linear system AtA x = Atb assembled on the CPU, for problems too
+/// large for a dense AtA. AtA is stored as 3x3 blocks, block (r, c) covering
+/// rows [3r, 3r + 3) and columns [3c, 3c + 3). This matches the variables of
+/// SLAC, where every fragment pose spans two blocks and every control grid
+/// point one block. Only blocks with r <= c are stored.
+class SparseLinearSystem {
+public:
+    /// Row major 3x3 blocks keyed by r * GetNumBlocks() + c, with r <= c.
+    using BlockMap = std::unordered_map<int64_t, std::array<double, 9>>;
+
+    /// \param num_vars Number of variables, must be a multiple of 3.
+    explicit SparseLinearSystem(int64_t num_vars);
+
+    int64_t GetNumVars() const { return num_vars_; }
+    int64_t GetNumBlocks() const { return num_vars_ / 3; }
+    /// Number of stored (upper triangular) nonzero blocks.
+    int64_t GetNumStoredBlocks() const { return blocks_.size(); }
+
+    /// Adds blocks to AtA, summing up blocks with the same key.
+    void AddBlocks(const BlockMap &blocks);
+    /// Adds values to Atb. \p Atb must have GetNumVars() entries.
+    void AddAtb(const std::vector<double> &Atb);
+    /// Adds \p value to the diagonal entries [begin, end) of AtA.
+    void AddDiagonal(int64_t begin, int64_t end, double value);
+
+    /// Returns the full symmetric AtA in CSR format, i.e. the row offsets
+    /// {num_vars + 1} and column indices {nnz} in Int64, and the values {nnz}
+    /// in Float32. Column indices are sorted within each row.
+    std::tuple<core::Tensor, core::Tensor, core::Tensor> GetAtACSR() const;
+    /// Returns Atb as a {num_vars, 1} Float32 tensor.
+    core::Tensor GetAtb() const;
+
+    /// Solves AtA x = b with the conjugate gradient method and a Jacobi
+    /// preconditioner. The matrix-vector products run in parallel.
+    ///
+    /// \param b Right hand side of shape {num_vars, 1} or {num_vars}.
+    /// \param max_iterations Maximum number of iterations.
+    /// \param tolerance Tolerance on the relative residual |AtA x - b| / |b|.
+    /// \return Solution x with the shape of b in Float32, on the CPU.
+    core::Tensor SolvePCG(const core::Tensor &b,
+                          int max_iterations = 1000,
+                          double tolerance = 1e-6) const;
+
+    /// Solves AtA x = b with a sparse LDLT factorization. Exact, but the
+    /// factorization fills in quickly for large 3D grids.
+    core::Tensor SolveCholesky(const core::Tensor &b) const;
+
+private:
+    int64_t num_vars_;
+    BlockMap blocks_;
+    std::vector<double> Atb_;
+};
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -27,8 +27,11 @@
 #include "open3d/t/pipelines/registration/Registration.h"
 
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/kernel/ComputeTransform.h"
+#include "open3d/t/pipelines/kernel/TransformationConverter.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
 
@@ -37,20 +40,119 @@ namespace t {
 namespace pipelines {
 namespace registration {
 
+RegistrationTarget::RegistrationTarget(const geometry::PointCloud &target,
+                                       const std::vector<double> &voxel_sizes)
+    : voxel_sizes_(voxel_sizes) {
+    target.GetPoints().AssertDtype(core::Dtype::Float32,
+                                   " RegistrationTarget: Only Float32 Point "
+                                   "cloud are supported currently.");
+
+    const int64_t num_scales = GetNumScales();
+    if (num_scales == 0) {
+        utility::LogError(" [RegistrationTarget] voxel_sizes is empty.");
+    }
+    for (int64_t i = 1; i < num_scales; i++) {
+        if (voxel_sizes_[i] >= voxel_sizes_[i - 1]) {
+            utility::LogError(
+                    " [MultiScaleICP] Voxel sizes must be in strictly "
+                    "decreasing order.");
+        }
+    }
+
+    target_down_pyramid_.resize(num_scales);
+    if (voxel_sizes_[num_scales - 1] == -1) {
+        target_down_pyramid_[num_scales - 1] = target;
+    } else {
+        target_down_pyramid_[num_scales - 1] =
+                target.VoxelDownSample(voxel_sizes_[num_scales - 1]);
+    }
+    for (int64_t k = num_scales - 2; k >= 0; k--) {
+        target_down_pyramid_[k] =
+                target_down_pyramid_[k + 1].VoxelDownSample(voxel_sizes_[k]);
+    }
+
+    if (target.GetDevice().GetType() == core::Device::DeviceType::CPU) {
+        for (int64_t k = 0; k < num_scales; k++) {
+            nanoflann_indices_.push_back(
+                    std::make_shared<core::nns::NanoFlannIndex>(
+                            target_down_pyramid_[k].GetPoints()));
+        }
+    } else {
+        fixed_radius_nns_.resize(num_scales);
+        fixed_radius_nns_radii_.resize(num_scales, 0.0);
+    }
+}
+
+const geometry::PointCloud &RegistrationTarget::GetPointCloud(
+        int64_t scale) const {
+    if (scale < 0 || scale >= GetNumScales()) {
+        utility::LogError(
+                " [RegistrationTarget] Scale {} out of range, the target has "
+                "{} scales.",
+                scale, GetNumScales());
+    }
+    return target_down_pyramid_[scale];
+}
+
+const core::nns::NanoFlannIndex &RegistrationTarget::GetNanoFlannIndex(
+        int64_t scale) const {
+    GetPointCloud(scale);
+    if (nanoflann_indices_.empty()) {
+        utility::LogError(
+                " [RegistrationTarget] The KD-tree index is only available "
+                "on CPU.");
+    }
+    return *nanoflann_indices_[scale];
+}
+
+std::pair<core::Tensor, core::Tensor> RegistrationTarget::SearchNearest(
+        const core::Tensor &query_points,
+        int64_t scale,
+        double max_correspondence_distance) const {
+    const geometry::PointCloud &target = GetPointCloud(scale);
+    if (!nanoflann_indices_.empty()) {
+        return nanoflann_indices_[scale]->SearchHybrid(
+                query_points, max_correspondence_distance, 1);
+    }
+
+    // The fixed radius index is only valid for the radius it was built with.
+    std::shared_ptr<core::nns::NearestNeighborSearch> target_nns;
+    {
+        std::lock_guard<std::mutex> lock(*fixed_radius_nns_mutex_);
+        if (!fixed_radius_nns_[scale] ||
+            fixed_radius_nns_radii_[scale] != max_correspondence_distance) {
+            auto nns = std::make_shared<core::nns::NearestNeighborSearch>(
+                    target.GetPoints());
+            bool check = nns->HybridIndex(max_correspondence_distance);
+            if (!check) {
+                utility::LogError(
+                        "[Tensor: RegistrationTarget: SearchNearest: "
+                        "NearestNeighborSearch::HybridIndex] "
+                        "Index is not set.");
+            }
+            fixed_radius_nns_[scale] = nns;
+            fixed_radius_nns_radii_[scale] = max_correspondence_distance;
+        }
+        target_nns = fixed_radius_nns_[scale];
+    }
+    return target_nns->HybridSearch(query_points, max_correspondence_distance,
+                                    1);
+}
+
 static RegistrationResult GetRegistrationResultAndCorrespondences(
         const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
-        open3d::core::nns::NearestNeighborSearch &target_nns,
+        const RegistrationTarget &target,
+        int64_t scale,
         double max_correspondence_distance,
         const core::Tensor &transformation) {
     core::Device device = source.GetDevice();
     core::Dtype dtype = core::Dtype::Float32;
     source.GetPoints().AssertDtype(dtype);
-    target.GetPoints().AssertDtype(dtype);
-    if (target.GetDevice() != device) {
+    if (target.GetPointCloud(scale).GetDevice() != device) {
         utility::LogError(
                 "Target Pointcloud device {} != Source Pointcloud's device {}.",
-                target.GetDevice().ToString(), device.ToString());
+                target.GetPointCloud(scale).GetDevice().ToString(),
+                device.ToString());
     }
     transformation.AssertShape({4, 4});
 
@@ -62,19 +164,10 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
         return result;
     }
 
-    bool check = target_nns.HybridIndex(max_correspondence_distance);
-    if (!check) {
-        utility::LogError(
-                "[Tensor: EvaluateRegistration: "
-                "GetRegistrationResultAndCorrespondences: "
-                "NearestNeighborSearch::HybridSearch] "
-                "Index is not set.");
-    }
-
     core::Tensor distances;
     std::tie(result.correspondence_set_.second, distances) =
-            target_nns.HybridSearch(source.GetPoints(),
-                                    max_correspondence_distance, 1);
+            target.SearchNearest(source.GetPoints(), scale,
+                                 max_correspondence_distance);
 
     core::Tensor valid = result.correspondence_set_.second.Ne(-1).Reshape({-1});
     // correpondence_set : (i, corres[i]).
@@ -101,28 +194,87 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
     return result;
 }
 
+/// Whether RegistrationMultiScaleICP searches correspondences and reduces the
+/// linear system in one pass, instead of materializing the correspondences.
+static bool UseFusedICP(const core::Device &device,
+                        const TransformationEstimation &estimation) {
+    const TransformationEstimationType type =
+            estimation.GetTransformationEstimationType();
+    return device.GetType() == core::Device::DeviceType::CPU &&
+           (type == TransformationEstimationType::PointToPoint ||
+            type == TransformationEstimationType::PointToPlane);
+}
+
+/// Computes the transformation update for the current source, searching the
+/// correspondences in the same pass. Also returns the fitness and inlier RMSE
+/// of the current source, as GetRegistrationResultAndCorrespondences would.
+static std::tuple<core::Tensor, double, double> SearchAndComputeTransformation(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::nns::NanoFlannIndex &target_index,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation) {
+    core::Tensor update;
+    int64_t num_correspondences;
+    double squared_error;
+    if (estimation.GetTransformationEstimationType() ==
+        TransformationEstimationType::PointToPlane) {
+        core::Tensor pose = kernel::SearchAndComputePosePointToPlane(
+                source.GetPoints(), target.GetPoints(),
+                target.GetPointNormals(), target_index,
+                max_correspondence_distance, num_correspondences,
+                squared_error);
+        update = kernel::PoseToTransformation(pose);
+    } else {
+        core::Tensor R, t;
+        std::tie(R, t) = kernel::SearchAndComputeRtPointToPoint(
+                source.GetPoints(), target.GetPoints(), target_index,
+                max_correspondence_distance, num_correspondences,
+                squared_error);
+        update = kernel::RtToTransformation(R, t);
+    }
+
+    const double fitness = static_cast<double>(num_correspondences) /
+                           static_cast<double>(source.GetPoints().GetLength());
+    const double inlier_rmse = std::sqrt(
+            squared_error / static_cast<double>(num_correspondences));
+    return std::make_tuple(update, fitness, inlier_rmse);
+}
+
 RegistrationResult EvaluateRegistration(const geometry::PointCloud &source,
                                         const geometry::PointCloud &target,
                                         double max_correspondence_distance,
                                         const core::Tensor &transformation) {
+    if (target.GetDevice() != source.GetDevice()) {
+        utility::LogError(
+                "Target Pointcloud device {} != Source Pointcloud's device {}.",
+                target.GetDevice().ToString(), source.GetDevice().ToString());
+    }
+    return EvaluateRegistration(source, RegistrationTarget(target),
+                                max_correspondence_distance, transformation);
+}
+
+RegistrationResult EvaluateRegistration(const geometry::PointCloud &source,
+                                        const RegistrationTarget &target,
+                                        double max_correspondence_distance,
+                                        const core::Tensor &transformation) {
     core::Device device = source.GetDevice();
     core::Dtype dtype = core::Dtype::Float32;
     source.GetPoints().AssertDtype(dtype);
-    target.GetPoints().AssertDtype(dtype);
-    if (target.GetDevice() != device) {
+    const int64_t scale = target.GetNumScales() - 1;
+    if (target.GetPointCloud(scale).GetDevice() != device) {
         utility::LogError(
                 "Target Pointcloud device {} != Source Pointcloud's device {}.",
-                target.GetDevice().ToString(), device.ToString());
+                target.GetPointCloud(scale).GetDevice().ToString(),
+                device.ToString());
     }
     transformation.AssertShape({4, 4});
 
     geometry::PointCloud source_transformed = source.Clone();
     source_transformed.Transform(transformation.To(device, dtype));
 
-    open3d::core::nns::NearestNeighborSearch target_nns(target.GetPoints());
-
     return GetRegistrationResultAndCorrespondences(
-            source_transformed, target, target_nns, max_correspondence_distance,
+            source_transformed, target, scale, max_correspondence_distance,
             transformation);
 }
 
@@ -145,23 +297,19 @@ RegistrationResult RegistrationMultiScaleICP(
         const std::vector<double> &max_correspondence_distances,
         const core::Tensor &init_source_to_target,
         const TransformationEstimation &estimation) {
-    core::Device device = source.GetDevice();
-    core::Dtype dtype = core::Dtype::Float32;
-
-    source.GetPoints().AssertDtype(dtype,
+    source.GetPoints().AssertDtype(core::Dtype::Float32,
                                    " RegistrationICP: Only Float32 Point cloud "
                                    "are supported currently.");
-    target.GetPoints().AssertDtype(dtype,
+    target.GetPoints().AssertDtype(core::Dtype::Float32,
                                    " RegistrationICP: Only Float32 Point cloud "
                                    "are supported currently.");
 
-    if (target.GetDevice() != device) {
+    if (target.GetDevice() != source.GetDevice()) {
         utility::LogError(
                 "Target Pointcloud device {} != Source Pointcloud's device {}.",
-                target.GetDevice().ToString(), device.ToString());
+                target.GetDevice().ToString(), source.GetDevice().ToString());
     }
 
-    int64_t num_iterations = int64_t(criterias.size());
     if (!(criterias.size() == voxel_sizes.size() &&
           criterias.size() == max_correspondence_distances.size())) {
         utility::LogError(
@@ -169,30 +317,54 @@ RegistrationResult RegistrationMultiScaleICP(
                 " max_correspondence_distances vectors must be same.");
     }
 
+    return RegistrationMultiScaleICP(
+            source, RegistrationTarget(target, voxel_sizes), criterias,
+            max_correspondence_distances, init_source_to_target, estimation);
+}
+
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        const std::vector<ICPConvergenceCriteria> &criterias,
+        const std::vector<double> &max_correspondence_distances,
+        const core::Tensor &init_source_to_target,
+        const TransformationEstimation &estimation) {
+    core::Device device = source.GetDevice();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    source.GetPoints().AssertDtype(dtype,
+                                   " RegistrationICP: Only Float32 Point cloud "
+                                   "are supported currently.");
+
+    const std::vector<double> &voxel_sizes = target.GetVoxelSizes();
+    int64_t num_iterations = int64_t(criterias.size());
+    if (!(num_iterations == target.GetNumScales() &&
+          criterias.size() == max_correspondence_distances.size())) {
+        utility::LogError(
+                " [RegistrationMultiScaleICP]: Size of criterias, target "
+                "scales, max_correspondence_distances vectors must be same.");
+    }
+
+    const geometry::PointCloud &target_finest =
+            target.GetPointCloud(num_iterations - 1);
+    if (target_finest.GetDevice() != device) {
+        utility::LogError(
+                "Target Pointcloud device {} != Source Pointcloud's device {}.",
+                target_finest.GetDevice().ToString(), device.ToString());
+    }
+
     if ((estimation.GetTransformationEstimationType() ==
                  TransformationEstimationType::PointToPlane ||
          estimation.GetTransformationEstimationType() ==
                  TransformationEstimationType::ColoredICP) &&
-        (!target.HasPointNormals())) {
+        (!target_finest.HasPointNormals())) {
         utility::LogError(
                 "TransformationEstimationPointToPlane and "
                 "TransformationEstimationColoredICP "
                 "require pre-computed normal vectors for target PointCloud.");
     }
 
-    if (max_correspondence_distances[0] <= 0.0) {
-        utility::LogError(
-                " Max correspondence distance must be greater than 0, but"
-                " got {} in scale: {}.",
-                max_correspondence_distances[0], 0);
-    }
-
-    for (int64_t i = 1; i < num_iterations; i++) {
-        if (voxel_sizes[i] >= voxel_sizes[i - 1]) {
-            utility::LogError(
-                    " [MultiScaleICP] Voxel sizes must be in strictly "
-                    "decreasing order.");
-        }
+    for (int64_t i = 0; i < num_iterations; i++) {
         if (max_correspondence_distances[i] <= 0.0) {
             utility::LogError(
                     " Max correspondence distance must be greater than 0, but"
@@ -207,35 +379,72 @@ RegistrationResult RegistrationMultiScaleICP(
             core::Device("CPU:0"), core::Dtype::Float64);
 
     std::vector<t::geometry::PointCloud> source_down_pyramid(num_iterations);
-    std::vector<t::geometry::PointCloud> target_down_pyramid(num_iterations);
 
     if (voxel_sizes[num_iterations - 1] == -1) {
         source_down_pyramid[num_iterations - 1] = source.Clone();
-        target_down_pyramid[num_iterations - 1] = target;
     } else {
         source_down_pyramid[num_iterations - 1] =
                 source.Clone().VoxelDownSample(voxel_sizes[num_iterations - 1]);
-        target_down_pyramid[num_iterations - 1] =
-                target.Clone().VoxelDownSample(voxel_sizes[num_iterations - 1]);
     }
 
     for (int k = num_iterations - 2; k >= 0; k--) {
         source_down_pyramid[k] =
                 source_down_pyramid[k + 1].VoxelDownSample(voxel_sizes[k]);
-        target_down_pyramid[k] =
-                target_down_pyramid[k + 1].VoxelDownSample(voxel_sizes[k]);
     }
 
     RegistrationResult result(transformation);
 
+    if (UseFusedICP(device, estimation)) {
+        for (int64_t i = 0; i < num_iterations; i++) {
+            source_down_pyramid[i].Transform(transformation.To(device, dtype));
+
+            // Pass j evaluates the source transformed by the first j updates,
+            // which matches the iterations of the unfused loop below.
+            double prev_fitness = 0.0;
+            double prev_inlier_rmse = 0.0;
+            for (int j = 0; j <= criterias[i].max_iteration_; j++) {
+                core::Tensor update;
+                std::tie(update, result.fitness_, result.inlier_rmse_) =
+                        SearchAndComputeTransformation(
+                                source_down_pyramid[i],
+                                target.GetPointCloud(i),
+                                target.GetNanoFlannIndex(i),
+                                max_correspondence_distances[i], estimation);
+
+                if (j == criterias[i].max_iteration_ ||
+                    (j > 1 &&
+                     std::abs(prev_fitness - result.fitness_) <
+                             criterias[i].relative_fitness_ &&
+                     std::abs(prev_inlier_rmse - result.inlier_rmse_) <
+                             criterias[i].relative_rmse_)) {
+                    break;
+                }
+                utility::LogDebug(
+                        " ICP Scale #{:d} Iteration #{:d}: Fitness {:.4f}, "
+                        "RMSE {:.4f}",
+                        i + 1, j, result.fitness_, result.inlier_rmse_);
+
+                transformation = update.Matmul(transformation);
+                source_down_pyramid[i].Transform(update.To(device, dtype));
+                prev_fitness = result.fitness_;
+                prev_inlier_rmse = result.inlier_rmse_;
+            }
+        }
+
+        // The fused passes do not keep the correspondences, so evaluate the
+        // final transformation once more to return them.
+        return GetRegistrationResultAndCorrespondences(
+                source_down_pyramid[num_iterations - 1], target,
+                num_iterations - 1,
+                max_correspondence_distances[num_iterations - 1],
+                transformation);
+    }
+
     for (int64_t i = 0; i < num_iterations; i++) {
         source_down_pyramid[i].Transform(transformation.To(device, dtype));
 
-        core::nns::NearestNeighborSearch target_nns(
-                target_down_pyramid[i].GetPoints());
-
         result = GetRegistrationResultAndCorrespondences(
-                source_down_pyramid[i], target_down_pyramid[i], target_nns,
+                source_down_pyramid[i], target, i,
                 max_correspondence_distances[i], transformation);
 
         for (int j = 0; j < criterias[i].max_iteration_; j++) {
@@ -247,7 +456,7 @@ RegistrationResult RegistrationMultiScaleICP(
             // ComputeTransformation returns transformation matrix of
             // dtype Float64.
             core::Tensor update = estimation.ComputeTransformation(
-                    source_down_pyramid[i], target_down_pyramid[i],
+                    source_down_pyramid[i], target.GetPointCloud(i),
                     result.correspondence_set_);
 
             // Multiply the transform to the cumulative transformation (update).
@@ -259,7 +468,7 @@ RegistrationResult RegistrationMultiScaleICP(
             double prev_inliner_rmse_ = result.inlier_rmse_;
 
             result = GetRegistrationResultAndCorrespondences(
-                    source_down_pyramid[i], target_down_pyramid[i], target_nns,
+                    source_down_pyramid[i], target, i,
                     max_correspondence_distances[i], transformation);
 
             // ICPConvergenceCriteria, to terminate iteration.
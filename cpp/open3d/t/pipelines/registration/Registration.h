@@ -26,19 +26,24 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <tuple>
 #include <vector>
 
 #include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 
 namespace open3d {
-namespace t {
-
-namespace geometry {
-class PointCloud;
-}
+namespace core {
+namespace nns {
+class NanoFlannIndex;
+class NearestNeighborSearch;
+}  // namespace nns
+}  // namespace core
 
+namespace t {
 namespace pipelines {
 namespace registration {
 class Feature;
@@ -110,6 +115,67 @@ public:
     double fitness_;
 };
 
+/// \class RegistrationTarget
+///
+/// \brief Target point cloud of registration, together with its downsampled
+/// scales and their search indices.
+///
+/// Building the target once and passing it to EvaluateRegistration and
+/// RegistrationMultiScaleICP skips the downsampling and the index build of
+/// every call, e.g. when tracking a sequence of scans against a fixed map.
+///
+/// On CPU the KD-tree of every scale is built by the constructor. On CUDA the
+/// index of a scale depends on the search radius, so it is built by the first
+/// search and rebuilt only when the max correspondence distance changes.
+/// Copies share the indices. A target can be searched from several threads
+/// at once.
+class RegistrationTarget {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param target The target point cloud of dtype Float32.
+    /// \param voxel_sizes Voxel sizes of the scales, with the same constraints
+    /// as for RegistrationMultiScaleICP. The default {-1} keeps the target as
+    /// a single scale without downsampling.
+    RegistrationTarget(const geometry::PointCloud &target,
+                       const std::vector<double> &voxel_sizes = {-1});
+
+    /// Returns the number of scales.
+    int64_t GetNumScales() const {
+        return static_cast<int64_t>(voxel_sizes_.size());
+    }
+
+    /// Returns the voxel sizes of the scales, from coarse to fine.
+    const std::vector<double> &GetVoxelSizes() const { return voxel_sizes_; }
+
+    /// Returns the target point cloud downsampled at \p scale.
+    const geometry::PointCloud &GetPointCloud(int64_t scale) const;
+
+    /// Returns the KD-tree of the target at \p scale. CPU only.
+    const core::nns::NanoFlannIndex &GetNanoFlannIndex(int64_t scale) const;
+
+    /// \brief Finds the nearest target point at \p scale of each query point.
+    ///
+    /// \return Pair of indices and squared distances of shape {N, 1}, as
+    /// NearestNeighborSearch::HybridSearch with max_knn = 1. The index is -1
+    /// where no target point is within \p max_correspondence_distance.
+    std::pair<core::Tensor, core::Tensor> SearchNearest(
+            const core::Tensor &query_points,
+            int64_t scale,
+            double max_correspondence_distance) const;
+
+protected:
+    std::vector<double> voxel_sizes_;
+    std::vector<geometry::PointCloud> target_down_pyramid_;
+    std::vector<std::shared_ptr<core::nns::NanoFlannIndex>> nanoflann_indices_;
+    mutable std::vector<std::shared_ptr<core::nns::NearestNeighborSearch>>
+            fixed_radius_nns_;
+    mutable std::vector<double> fixed_radius_nns_radii_;
+    // Guards the lazily built CUDA indices, shared by copies.
+    std::shared_ptr<std::mutex> fixed_radius_nns_mutex_ =
+            std::make_shared<std::mutex>();
+};
+
 /// \brief Function for evaluating registration between point clouds.
 ///
 /// \param source The source point cloud.
@@ -125,6 +191,23 @@ RegistrationResult EvaluateRegistration(
         const core::Tensor &transformation = core::Tensor::Eye(
                 4, core::Dtype::Float64, core::Device("CPU:0")));
 
+/// \brief Function for evaluating registration against a prebuilt target.
+///
+/// The source is evaluated against the finest scale of \p target.
+///
+/// \param source The source point cloud.
+/// \param target The prebuilt target.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param transformation The 4x4 transformation matrix to transform
+/// source to target of dtype Float64 on CPU device.
+RegistrationResult EvaluateRegistration(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const core::Tensor &transformation = core::Tensor::Eye(
+                4, core::Dtype::Float64, core::Device("CPU:0")));
+
 /// \brief Functions for ICP registration.
 ///
 /// \param source The source point cloud.
@@ -155,6 +238,11 @@ RegistrationResult RegistrationICP(
 /// higher is the resolution]. Only the last value of the voxel_sizes vector can
 /// be {-1}, as it allows to run on the original scale without downsampling.
 ///
+/// On CPU, the PointToPoint and PointToPlane estimations search the
+/// correspondences and accumulate the linear system in a single parallel pass
+/// per iteration, without materializing the correspondences. Only the final
+/// result contains a correspondence set.
+///
 /// \param source The source point cloud.
 /// \param target The target point cloud.
 /// \param voxel_sizes VectorDouble of voxel scales of type double.
@@ -177,6 +265,33 @@ RegistrationResult RegistrationMultiScaleICP(
         const TransformationEstimation &estimation =
                 TransformationEstimationPointToPoint());
 
+/// \brief Functions for Multi-Scale ICP registration against a prebuilt
+/// target.
+///
+/// Same as above, with the scales and search indices of \p target reused
+/// instead of rebuilt. The source is downsampled with the voxel sizes of
+/// \p target.
+///
+/// \param source The source point cloud.
+/// \param target The prebuilt target.
+/// \param criteria_list Vector of ICPConvergenceCriteria objects for each
+/// scale.
+/// \param max_correspondence_distances VectorDouble of maximum
+/// correspondence points-pair distances of type double, for each scale.
+/// Must be of same length as criteria_list and the scales of target.
+/// \param init_source_to_target Initial transformation estimation of type
+/// Float64 on CPU.
+/// \param estimation Estimation method.
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        const std::vector<ICPConvergenceCriteria> &criteria_list,
+        const std::vector<double> &max_correspondence_distances,
+        const core::Tensor &init_source_to_target = core::Tensor::Eye(
+                4, core::Dtype::Float64, core::Device("CPU:0")),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint());
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
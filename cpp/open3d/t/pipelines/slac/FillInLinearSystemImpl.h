@@ -117,10 +117,10 @@ void FillInRigidAlignmentTerm(Tensor& AtA,
     }
 }
 
-static void FillInSLACAlignmentTerm(Tensor& AtA,
-                                    Tensor& Atb,
-                                    Tensor& residual,
-                                    ControlGrid& ctr_grid,
+// Computes the transformed correspondences of fragments i and j, and hands
+// them to fill_in, which fills in a dense or a sparse linear system.
+template <typename FillInFunc>
+static void FillInSLACAlignmentTerm(ControlGrid& ctr_grid,
                                     const PointCloud& tpcd_param_i,
                                     const PointCloud& tpcd_param_j,
                                     const Tensor& Ti,
@@ -128,7 +128,8 @@ static void FillInSLACAlignmentTerm(Tensor& AtA,
                                     const int i,
                                     const int j,
                                     const int n_fragments,
-                                    const float threshold) {
+                                    const float threshold,
+                                    FillInFunc fill_in) {
     // Parameterize: setup point cloud -> cgrid correspondences
     Tensor cgrid_index_ps =
             tpcd_param_i.GetPointAttr(ControlGrid::kGrid8NbIndices);
@@ -161,20 +162,18 @@ static void FillInSLACAlignmentTerm(Tensor& AtA,
     Tensor RjT_Ri_Cnormal_ps =
             (Rj.T().Matmul(Ri_Cnormal_ps.T())).T().Contiguous();
 
-    kernel::FillInSLACAlignmentTerm(
-            AtA, Atb, residual, Ti_Cps, Tj_Cqs, Cnormal_ps, Ri_Cnormal_ps,
-            RjT_Ri_Cnormal_ps, cgrid_index_ps, cgrid_index_qs, cgrid_ratio_ps,
-            cgrid_ratio_qs, i, j, n_fragments, threshold);
+    fill_in(Ti_Cps, Tj_Cqs, Cnormal_ps, Ri_Cnormal_ps, RjT_Ri_Cnormal_ps,
+            cgrid_index_ps, cgrid_index_qs, cgrid_ratio_ps, cgrid_ratio_qs, i,
+            j, n_fragments, threshold);
 }
 
-void FillInSLACAlignmentTerm(Tensor& AtA,
-                             Tensor& Atb,
-                             Tensor& residual,
-                             ControlGrid& ctr_grid,
-                             const std::vector<std::string>& fnames,
-                             const PoseGraph& pose_graph,
-                             const SLACOptimizerParams& params,
-                             const SLACDebugOption& debug_option) {
+template <typename FillInFunc>
+static void FillInSLACAlignmentTerm(ControlGrid& ctr_grid,
+                                    const std::vector<std::string>& fnames,
+                                    const PoseGraph& pose_graph,
+                                    const SLACOptimizerParams& params,
+                                    const SLACDebugOption& debug_option,
+                                    FillInFunc fill_in) {
     core::Device device(params.device_);
     int n_frags = pose_graph.nodes_.size();
 
@@ -217,9 +216,9 @@ void FillInSLACAlignmentTerm(Tensor& AtA,
                            .To(device, core::Dtype::Float32);
 
         // Fill In.
-        FillInSLACAlignmentTerm(AtA, Atb, residual, ctr_grid, tpcd_param_i,
-                                tpcd_param_j, Ti, Tj, i, j, n_frags,
-                                params.distance_threshold_);
+        FillInSLACAlignmentTerm(ctr_grid, tpcd_param_i, tpcd_param_j, Ti, Tj,
+                                i, j, n_frags, params.distance_threshold_,
+                                fill_in);
 
         if (debug_option.debug_ && i >= debug_option.debug_start_node_idx_) {
             VisualizePointCloudCorrespondences(tpcd_i, tpcd_j, corres_ij,
@@ -230,6 +229,35 @@ void FillInSLACAlignmentTerm(Tensor& AtA,
     }
 }
 
+void FillInSLACAlignmentTerm(Tensor& AtA,
+                             Tensor& Atb,
+                             Tensor& residual,
+                             ControlGrid& ctr_grid,
+                             const std::vector<std::string>& fnames,
+                             const PoseGraph& pose_graph,
+                             const SLACOptimizerParams& params,
+                             const SLACDebugOption& debug_option) {
+    FillInSLACAlignmentTerm(ctr_grid, fnames, pose_graph, params, debug_option,
+                            [&](const auto&... args) {
+                                kernel::FillInSLACAlignmentTerm(
+                                        AtA, Atb, residual, args...);
+                            });
+}
+
+void FillInSLACAlignmentTerm(kernel::SparseLinearSystem& system,
+                             Tensor& residual,
+                             ControlGrid& ctr_grid,
+                             const std::vector<std::string>& fnames,
+                             const PoseGraph& pose_graph,
+                             const SLACOptimizerParams& params,
+                             const SLACDebugOption& debug_option) {
+    FillInSLACAlignmentTerm(ctr_grid, fnames, pose_graph, params, debug_option,
+                            [&](const auto&... args) {
+                                kernel::FillInSLACAlignmentTerm(
+                                        system, residual, args...);
+                            });
+}
+
 void FillInSLACRegularizerTerm(Tensor& AtA,
                                Tensor& Atb,
                                Tensor& residual,
@@ -252,6 +280,26 @@ void FillInSLACRegularizerTerm(Tensor& AtA,
     }
 }
 
+void FillInSLACRegularizerTerm(kernel::SparseLinearSystem& system,
+                               Tensor& residual,
+                               ControlGrid& ctr_grid,
+                               int n_frags,
+                               const SLACOptimizerParams& params,
+                               const SLACDebugOption& debug_option) {
+    Tensor active_addrs, nb_addrs, nb_masks;
+    std::tie(active_addrs, nb_addrs, nb_masks) = ctr_grid.GetNeighborGridMap();
+
+    Tensor positions_init = ctr_grid.GetInitPositions();
+    Tensor positions_curr = ctr_grid.GetCurrPositions();
+    kernel::FillInSLACRegularizerTerm(system, residual, active_addrs, nb_addrs,
+                                      nb_masks, positions_init, positions_curr,
+                                      n_frags * params.regularizer_weight_,
+                                      n_frags, ctr_grid.GetAnchorIdx());
+    if (debug_option.debug_) {
+        VisualizeGridDeformation(ctr_grid);
+    }
+}
+
 }  // namespace slac
 }  // namespace pipelines
 }  // namespace t
@@ -343,33 +343,52 @@ std::pair<PoseGraph, ControlGrid> RunSLACOptimizerForFragments(
     PoseGraph pose_graph_update(pose_graph);
     for (int itr = 0; itr < params.max_iterations_; ++itr) {
         utility::LogInfo("Iteration {}", itr);
-        core::Tensor AtA = core::Tensor::Zeros({num_params, num_params},
-                                               core::Dtype::Float32, device);
-        core::Tensor Atb = core::Tensor::Zeros({num_params, 1},
-                                               core::Dtype::Float32, device);
-
-        core::Tensor indices_eye0 =
-                core::Tensor::Arange(0, 6, 1, core::Dtype::Int64, device);
-        AtA.IndexSet({indices_eye0, indices_eye0},
-                     core::Tensor::Ones({}, core::Dtype::Float32, device));
-
         core::Tensor residual_data =
                 core::Tensor::Zeros({1}, core::Dtype::Float32, device);
-        FillInSLACAlignmentTerm(AtA, Atb, residual_data, ctr_grid, fnames_down,
-                                pose_graph_update, params, debug_option);
-
-        utility::LogInfo("Alignment loss = {}", residual_data[0].Item<float>());
-
         core::Tensor residual_reg =
                 core::Tensor::Zeros({1}, core::Dtype::Float32, device);
-        FillInSLACRegularizerTerm(AtA, Atb, residual_reg, ctr_grid,
-                                  pose_graph_update.nodes_.size(), params,
-                                  debug_option);
+
+        core::Tensor delta;
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            // Each correspondence only couples two poses and 16 control grid
+            // points, so AtA is kept sparse and solved iteratively.
+            kernel::SparseLinearSystem system(num_params);
+            system.AddDiagonal(0, 6, 1.0);
+
+            FillInSLACAlignmentTerm(system, residual_data, ctr_grid,
+                                    fnames_down, pose_graph_update, params,
+                                    debug_option);
+            FillInSLACRegularizerTerm(system, residual_reg, ctr_grid,
+                                      pose_graph_update.nodes_.size(), params,
+                                      debug_option);
+            utility::LogDebug("Hessian has {} nonzero 3x3 blocks.",
+                              system.GetNumStoredBlocks());
+
+            delta = system.SolvePCG(system.GetAtb().Neg());
+        } else {
+            core::Tensor AtA = core::Tensor::Zeros(
+                    {num_params, num_params}, core::Dtype::Float32, device);
+            core::Tensor Atb = core::Tensor::Zeros(
+                    {num_params, 1}, core::Dtype::Float32, device);
+
+            core::Tensor indices_eye0 =
+                    core::Tensor::Arange(0, 6, 1, core::Dtype::Int64, device);
+            AtA.IndexSet({indices_eye0, indices_eye0},
+                         core::Tensor::Ones({}, core::Dtype::Float32, device));
+
+            FillInSLACAlignmentTerm(AtA, Atb, residual_data, ctr_grid,
+                                    fnames_down, pose_graph_update, params,
+                                    debug_option);
+            FillInSLACRegularizerTerm(AtA, Atb, residual_reg, ctr_grid,
+                                      pose_graph_update.nodes_.size(), params,
+                                      debug_option);
+
+            delta = AtA.Solve(Atb.Neg());
+        }
+        utility::LogInfo("Alignment loss = {}", residual_data[0].Item<float>());
         utility::LogInfo("Regularizer loss = {}",
                          residual_reg[0].Item<float>());
 
-        core::Tensor delta = AtA.Solve(Atb.Neg());
-
         core::Tensor delta_poses =
                 delta.Slice(0, 0, 6 * pose_graph_update.nodes_.size());
         core::Tensor delta_cgrids = delta.Slice(
@@ -43,6 +43,7 @@
 #else
 #include <dirent.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
@@ -561,6 +562,101 @@ size_t CFile::ReadData(void *data, size_t elem_size, size_t num_elems) {
     return elems;
 }
 
+MappedFile::~MappedFile() { Close(); }
+
+bool MappedFile::Open(const std::string &filename, bool copy_on_write) {
+    Close();
+#ifdef WINDOWS
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        error_code_ = ENOENT;
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        error_code_ = EIO;
+        CloseHandle(file);
+        return false;
+    }
+    size_ = static_cast<int64_t>(size.QuadPart);
+    file_handle_ = file;
+    if (size_ > 0) {
+        HANDLE mapping = CreateFileMappingA(
+                file, nullptr, copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY,
+                0, 0, nullptr);
+        if (mapping != nullptr) {
+            mapping_handle_ = mapping;
+            data_ = static_cast<char *>(MapViewOfFile(
+                    mapping, copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ, 0,
+                    0, 0));
+        }
+        if (data_ == nullptr) {
+            error_code_ = ENOMEM;
+            opened_ = true;
+            Close();
+            return false;
+        }
+    }
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error_code_ = errno;
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        error_code_ = errno;
+        close(fd);
+        return false;
+    }
+    size_ = static_cast<int64_t>(st.st_size);
+    if (size_ > 0) {
+        void *data = mmap(nullptr, static_cast<size_t>(size_),
+                          copy_on_write ? PROT_READ | PROT_WRITE : PROT_READ,
+                          copy_on_write ? MAP_PRIVATE : MAP_SHARED, fd, 0);
+        if (data == MAP_FAILED) {
+            error_code_ = errno;
+            close(fd);
+            size_ = 0;
+            return false;
+        }
+        data_ = static_cast<char *>(data);
+    }
+    // The mapping stays valid after the descriptor is closed.
+    close(fd);
+#endif
+    opened_ = true;
+    return true;
+}
+
+std::string MappedFile::GetError() { return GetIOErrorString(error_code_); }
+
+void MappedFile::Close() {
+    if (!opened_) {
+        return;
+    }
+#ifdef WINDOWS
+    if (data_ != nullptr) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_ != nullptr) {
+        CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    }
+    CloseHandle(static_cast<HANDLE>(file_handle_));
+    file_handle_ = nullptr;
+    mapping_handle_ = nullptr;
+#else
+    if (data_ != nullptr) {
+        munmap(data_, static_cast<size_t>(size_));
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    opened_ = false;
+}
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
@@ -147,6 +147,50 @@ private:
     std::vector<char> line_buffer_;
 };
 
+/// RAII wrapper for a memory mapping of a whole file.
+/// The mapping is either read-only, or private and writable with copy-on-write
+/// semantics. The file itself is never modified.
+class MappedFile {
+public:
+    MappedFile() {}
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /// The destructor unmaps the file automatically.
+    ~MappedFile();
+
+    /// Map a file.
+    /// \param filename Path to the file.
+    /// \param copy_on_write If true, the mapped pages are writable and writes
+    /// are only visible to this process.
+    bool Open(const std::string &filename, bool copy_on_write = false);
+
+    /// Returns the last encountered error for this file.
+    std::string GetError();
+
+    /// Unmap the file.
+    void Close();
+
+    /// Returns true if a file is mapped.
+    bool IsOpened() const { return opened_; }
+
+    /// Returns the beginning of the mapped file, nullptr for an empty file.
+    char *GetData() const { return data_; }
+
+    /// Returns the file size in bytes.
+    int64_t GetSize() const { return size_; }
+
+private:
+    char *data_ = nullptr;
+    int64_t size_ = 0;
+    bool opened_ = false;
+    int error_code_ = 0;
+#ifdef _WIN32
+    void *file_handle_ = nullptr;
+    void *mapping_handle_ = nullptr;
+#endif
+};
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
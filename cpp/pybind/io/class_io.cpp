@@ -69,6 +69,12 @@ static const std::unordered_map<std::string, std::string>
                  "If true, all points that include an infinite value are "
                  "removed from the PointCloud."},
                 {"quality", "Quality of the output file."},
+                {"read_normals",
+                 "Set to ``False`` to skip loading normals. Currently only "
+                 "honored by the PCD reader."},
+                {"read_colors",
+                 "Set to ``False`` to skip loading colors. Currently only "
+                 "honored by the PCD reader."},
                 {"write_ascii",
                  "Set to ``True`` to output in ascii format, otherwise binary "
                  "format will be used."},
@@ -178,17 +184,21 @@ void pybind_class_io(py::module &m_io) {
             "read_point_cloud",
             [](const std::string &filename, const std::string &format,
                bool remove_nan_points, bool remove_infinite_points,
-               bool print_progress) {
+               bool print_progress, bool read_normals, bool read_colors) {
                 py::gil_scoped_release release;
                 geometry::PointCloud pcd;
-                ReadPointCloud(filename, pcd,
-                               {format, remove_nan_points,
-                                remove_infinite_points, print_progress});
+                ReadPointCloudOption option(format, remove_nan_points,
+                                            remove_infinite_points,
+                                            print_progress);
+                option.read_normals = read_normals;
+                option.read_colors = read_colors;
+                ReadPointCloud(filename, pcd, option);
                 return pcd;
             },
             "Function to read PointCloud from file", "filename"_a,
             "format"_a = "auto", "remove_nan_points"_a = true,
-            "remove_infinite_points"_a = true, "print_progress"_a = false);
+            "remove_infinite_points"_a = true, "print_progress"_a = false,
+            "read_normals"_a = true, "read_colors"_a = true);
     docstring::FunctionDocInject(m_io, "read_point_cloud",
                                  map_shared_argument_docstrings);
 
@@ -67,11 +67,14 @@ void pybind_feature(py::module &m) {
 void pybind_feature_methods(py::module &m) {
     m.def("compute_fpfh_feature", &ComputeFPFHFeature,
           "Function to compute FPFH feature for a point cloud", "input"_a,
-          "search_param"_a);
+          "search_param"_a, "indices"_a = py::none());
     docstring::FunctionDocInject(
             m, "compute_fpfh_feature",
             {{"input", "The Input point cloud."},
-             {"search_param", "KDTree KNN search parameter."}});
+             {"search_param", "KDTree KNN search parameter."},
+             {"indices",
+              "Indices of the points to compute features for. All points are "
+              "used if not given."}});
 }
 
 }  // namespace registration
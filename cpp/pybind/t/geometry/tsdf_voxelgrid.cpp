@@ -49,6 +49,26 @@ void pybind_tsdf_voxelgrid(py::module& m) {
             m, "TSDFVoxelGrid",
             "A voxel grid for TSDF and/or color integration.");
 
+    py::class_<TSDFVoxelGrid::StreamingStatistics>(
+            tsdf_voxelgrid, "StreamingStatistics",
+            "Counters of the out-of-core streaming mode.")
+            .def_readonly("num_resident_blocks",
+                          &TSDFVoxelGrid::StreamingStatistics::
+                                  num_resident_blocks_)
+            .def_readonly("num_evicted_blocks",
+                          &TSDFVoxelGrid::StreamingStatistics::
+                                  num_evicted_blocks_)
+            .def_readonly("resident_bytes",
+                          &TSDFVoxelGrid::StreamingStatistics::resident_bytes_)
+            .def_readonly("evicted_bytes",
+                          &TSDFVoxelGrid::StreamingStatistics::evicted_bytes_)
+            .def_readonly("num_blocks_paged_out",
+                          &TSDFVoxelGrid::StreamingStatistics::
+                                  num_blocks_paged_out_)
+            .def_readonly("num_blocks_paged_in",
+                          &TSDFVoxelGrid::StreamingStatistics::
+                                  num_blocks_paged_in_);
+
     // Constructors.
     tsdf_voxelgrid.def(
             py::init<const std::unordered_map<std::string, core::Dtype>&, float,
@@ -102,6 +122,19 @@ void pybind_tsdf_voxelgrid(py::module& m) {
 
     tsdf_voxelgrid.def("get_block_hashmap", &TSDFVoxelGrid::GetBlockHashmap);
     tsdf_voxelgrid.def("get_device", &TSDFVoxelGrid::GetDevice);
+
+    tsdf_voxelgrid.def("enable_streaming", &TSDFVoxelGrid::EnableStreaming,
+                       "Keep at most max_resident_blocks blocks in memory and "
+                       "evict the blocks farthest from the camera to a disk "
+                       "store at store_path after each integration.",
+                       "store_path"_a, "max_resident_blocks"_a);
+    tsdf_voxelgrid.def("disable_streaming", &TSDFVoxelGrid::DisableStreaming,
+                       "Page all evicted blocks back in and remove the disk "
+                       "store.");
+    tsdf_voxelgrid.def("is_streaming_enabled",
+                       &TSDFVoxelGrid::IsStreamingEnabled);
+    tsdf_voxelgrid.def("get_streaming_statistics",
+                       &TSDFVoxelGrid::GetStreamingStatistics);
 }
 }  // namespace geometry
 }  // namespace t
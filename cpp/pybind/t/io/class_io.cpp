@@ -30,6 +30,7 @@
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/io/ImageIO.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/TSDFVoxelGridIO.h"
 #include "pybind/docstring.h"
 #include "pybind/t/io/io.h"
 
@@ -54,6 +55,8 @@ static const std::unordered_map<std::string, std::string>
                  "If true, all points that include an infinite value are "
                  "removed from the PointCloud."},
                 {"quality", "Quality of the output file."},
+                {"device", "Device of the output TSDFVoxelGrid."},
+                {"voxelgrid", "The TSDFVoxelGrid object for I/O."},
                 {"write_ascii",
                  "Set to ``True`` to output in ascii format, otherwise binary "
                  "format will be used."},
@@ -143,6 +146,34 @@ void pybind_class_io(py::module &m_io) {
             "quality"_a = kOpen3DImageIODefaultQuality);
     docstring::FunctionDocInject(m_io, "write_image",
                                  map_shared_argument_docstrings);
+
+    // open3d::t::geometry::TSDFVoxelGrid
+    m_io.def(
+            "read_tsdf_voxel_grid",
+            [](const std::string &filename, const core::Device &device) {
+                py::gil_scoped_release release;
+                geometry::TSDFVoxelGrid voxelgrid;
+                ReadTSDFVoxelGrid(filename, voxelgrid, device);
+                return voxelgrid;
+            },
+            "Function to read TSDFVoxelGrid from a file written by "
+            "write_tsdf_voxel_grid. The file is memory mapped and the voxel "
+            "blocks are inserted without reintegration.",
+            "filename"_a, "device"_a = core::Device("CPU:0"));
+    docstring::FunctionDocInject(m_io, "read_tsdf_voxel_grid",
+                                 map_shared_argument_docstrings);
+
+    m_io.def(
+            "write_tsdf_voxel_grid",
+            [](const std::string &filename,
+               const geometry::TSDFVoxelGrid &voxelgrid) {
+                py::gil_scoped_release release;
+                return WriteTSDFVoxelGrid(filename, voxelgrid);
+            },
+            "Function to write TSDFVoxelGrid to a binary file.", "filename"_a,
+            "voxelgrid"_a);
+    docstring::FunctionDocInject(m_io, "write_tsdf_voxel_grid",
+                                 map_shared_argument_docstrings);
 }
 
 }  // namespace io
@@ -133,6 +133,31 @@ void pybind_registration_classes(py::module &m) {
                         rr.correspondence_set_.second.GetLength());
             });
 
+    // open3d.t.pipelines.registration.RegistrationTarget
+    py::class_<RegistrationTarget> registration_target(
+            m, "RegistrationTarget",
+            "Target point cloud of registration, together with its "
+            "downsampled scales and their search indices. Build it once and "
+            "pass it as ``target`` to evaluate_registration and "
+            "registration_multi_scale_icp to reuse the indices across calls.");
+    py::detail::bind_copy_functions<RegistrationTarget>(registration_target);
+    registration_target
+            .def(py::init<const t::geometry::PointCloud &,
+                          const std::vector<double> &>(),
+                 py::call_guard<py::gil_scoped_release>(), "target"_a,
+                 "voxel_sizes"_a = std::vector<double>{-1})
+            .def("get_num_scales", &RegistrationTarget::GetNumScales,
+                 "Returns the number of scales.")
+            .def("get_voxel_sizes", &RegistrationTarget::GetVoxelSizes,
+                 "Returns the voxel sizes of the scales, from coarse to fine.")
+            .def("get_point_cloud", &RegistrationTarget::GetPointCloud,
+                 "Returns the target point cloud downsampled at ``scale``.",
+                 "scale"_a)
+            .def("__repr__", [](const RegistrationTarget &rt) {
+                return fmt::format("RegistrationTarget with {:d} scales.",
+                                   rt.GetNumScales());
+            });
+
     // open3d.t.pipelines.registration.TransformationEstimation
     py::class_<TransformationEstimation,
                PyTransformationEstimation<TransformationEstimation>>
@@ -229,12 +254,24 @@ static const std::unordered_map<std::string, std::string>
                  "decreasing order, for multi-scale icp."}};
 
 void pybind_registration_methods(py::module &m) {
-    m.def("evaluate_registration", &EvaluateRegistration,
+    m.def("evaluate_registration",
+          py::overload_cast<const t::geometry::PointCloud &,
+                            const t::geometry::PointCloud &, double,
+                            const core::Tensor &>(&EvaluateRegistration),
           py::call_guard<py::gil_scoped_release>(),
           "Function for evaluating registration between point clouds",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
           "transformation"_a = core::Tensor::Eye(4, core::Dtype::Float64,
                                                  core::Device("CPU:0")));
+    m.def("evaluate_registration",
+          py::overload_cast<const t::geometry::PointCloud &,
+                            const RegistrationTarget &, double,
+                            const core::Tensor &>(&EvaluateRegistration),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for evaluating registration against a prebuilt target",
+          "source"_a, "target"_a, "max_correspondence_distance"_a,
+          "transformation"_a = core::Tensor::Eye(4, core::Dtype::Float64,
+                                                 core::Device("CPU:0")));
     docstring::FunctionDocInject(m, "evaluate_registration",
                                  map_shared_argument_docstrings);
 
@@ -249,13 +286,34 @@ void pybind_registration_methods(py::module &m) {
     docstring::FunctionDocInject(m, "registration_icp",
                                  map_shared_argument_docstrings);
 
-    m.def("registration_multi_scale_icp", &RegistrationMultiScaleICP,
+    m.def("registration_multi_scale_icp",
+          py::overload_cast<const t::geometry::PointCloud &,
+                            const t::geometry::PointCloud &,
+                            const std::vector<double> &,
+                            const std::vector<ICPConvergenceCriteria> &,
+                            const std::vector<double> &, const core::Tensor &,
+                            const TransformationEstimation &>(
+                  &RegistrationMultiScaleICP),
           py::call_guard<py::gil_scoped_release>(),
           "Function for Multi-Scale ICP registration", "source"_a, "target"_a,
           "voxel_sizes"_a, "criteria_list"_a, "max_correspondence_distances"_a,
           "init_source_to_target"_a = core::Tensor::Eye(4, core::Dtype::Float64,
                                                         core::Device("CPU:0")),
           "estimation_method"_a = TransformationEstimationPointToPoint());
+    m.def("registration_multi_scale_icp",
+          py::overload_cast<const t::geometry::PointCloud &,
+                            const RegistrationTarget &,
+                            const std::vector<ICPConvergenceCriteria> &,
+                            const std::vector<double> &, const core::Tensor &,
+                            const TransformationEstimation &>(
+                  &RegistrationMultiScaleICP),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for Multi-Scale ICP registration against a prebuilt "
+          "target, reusing its scales and search indices", "source"_a,
+          "target"_a, "criteria_list"_a, "max_correspondence_distances"_a,
+          "init_source_to_target"_a = core::Tensor::Eye(4, core::Dtype::Float64,
+                                                        core::Device("CPU:0")),
+          "estimation_method"_a = TransformationEstimationPointToPoint());
     docstring::FunctionDocInject(m, "registration_multi_scale_icp",
                                  map_shared_argument_docstrings);
 }
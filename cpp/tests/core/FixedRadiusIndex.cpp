@@ -26,20 +26,28 @@
 
 #include "open3d/core/nns/FixedRadiusIndex.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <random>
 
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/utility/Helper.h"
 #include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
 
 namespace open3d {
 namespace tests {
 
-TEST(FixedRadiusIndex, SearchRadius) {
-    core::Device device = core::Device("CUDA:0");
+class FixedRadiusIndexPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(FixedRadiusIndex,
+                         FixedRadiusIndexPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FixedRadiusIndexPermuteDevices, SearchRadius) {
+    core::Device device = GetParam();
     std::vector<int> ref_indices = {1, 4};
     std::vector<float> ref_distance = {0.00626358, 0.00747938};
 
@@ -68,5 +76,87 @@ TEST(FixedRadiusIndex, SearchRadius) {
              std::vector<float>({0.00626358, 0.00747938}));
 }
 
+TEST_P(FixedRadiusIndexPermuteDevices, SearchHybrid) {
+    core::Device device = GetParam();
+
+    int size = 10;
+    std::vector<float> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0, 0.2, 0.0,
+                              0.1, 0.0, 0.0, 0.1, 0.1, 0.0, 0.1, 0.2, 0.0, 0.2,
+                              0.0, 0.0, 0.2, 0.1, 0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float32, device);
+    float radius = 0.1;
+    core::nns::FixedRadiusIndex index(ref, radius);
+
+    core::Tensor query(std::vector<float>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float32, device);
+
+    std::pair<core::Tensor, core::Tensor> result =
+            index.SearchHybrid(query, radius, 3);
+    ExpectEQ(result.first.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, -1}));
+    ExpectEQ(result.second.ToFlatVector<float>(),
+             std::vector<float>({0.00626358, 0.00747938, 0}));
+
+    result = index.SearchHybrid(query, radius, 1);
+    ExpectEQ(result.first.ToFlatVector<int64_t>(), std::vector<int64_t>({1}));
+}
+
+TEST(FixedRadiusIndex, CPUMatchesBruteForce) {
+    const core::Device device("CPU:0");
+    const int64_t num_points = 2000;
+    const int64_t num_queries = 300;
+    const double radius = 0.08;
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<double> ref_vec(num_points * 3);
+    std::vector<double> query_vec(num_queries * 3);
+    for (double &v : ref_vec) v = uniform(rng);
+    for (double &v : query_vec) v = uniform(rng);
+    core::Tensor ref(ref_vec, {num_points, 3}, core::Dtype::Float64, device);
+    core::Tensor query(query_vec, {num_queries, 3}, core::Dtype::Float64,
+                       device);
+
+    core::nns::FixedRadiusIndex index(ref, radius);
+    // A smaller search radius reuses the index built for the larger one.
+    for (double search_radius : {radius, radius / 2}) {
+        core::Tensor indices, distances, row_splits;
+        std::tie(indices, distances, row_splits) =
+                index.SearchRadius(query, search_radius, true);
+        std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+        std::vector<double> distances_vec = distances.ToFlatVector<double>();
+        std::vector<int64_t> row_splits_vec =
+                row_splits.ToFlatVector<int64_t>();
+        ASSERT_EQ(row_splits_vec.size(), size_t(num_queries + 1));
+
+        for (int64_t q = 0; q < num_queries; ++q) {
+            std::vector<std::pair<double, int64_t>> expected;
+            for (int64_t p = 0; p < num_points; ++p) {
+                double dist = 0;
+                for (int d = 0; d < 3; ++d) {
+                    double diff = ref_vec[p * 3 + d] - query_vec[q * 3 + d];
+                    dist += diff * diff;
+                }
+                if (dist <= search_radius * search_radius) {
+                    expected.emplace_back(dist, p);
+                }
+            }
+            std::sort(expected.begin(), expected.end());
+
+            ASSERT_EQ(row_splits_vec[q + 1] - row_splits_vec[q],
+                      int64_t(expected.size()));
+            for (size_t k = 0; k < expected.size(); ++k) {
+                EXPECT_EQ(indices_vec[row_splits_vec[q] + k],
+                          expected[k].second);
+                EXPECT_DOUBLE_EQ(distances_vec[row_splits_vec[q] + k],
+                                 expected[k].first);
+            }
+        }
+    }
+
+    EXPECT_THROW(index.SearchRadius(query, radius * 2), std::runtime_error);
+    EXPECT_THROW(index.SearchRadius(query, 0.0), std::runtime_error);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/FusedEW.h"
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class FusedEWPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(FusedEW,
+                         FusedEWPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FusedEWPermuteDevices, Chain) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device);
+    core::Tensor b = core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}, device);
+    core::Tensor c = core::Tensor::Init<float>({{1, 1, 1}, {1, 1, 1}}, device);
+
+    core::Tensor dst = (core::kernel::FusedEWExpr(a) * b + c).Sqrt().Eval();
+    EXPECT_TRUE(dst.AllClose(a.Mul(b).Add(c).Sqrt()));
+}
+
+TEST_P(FusedEWPermuteDevices, Broadcast) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<double>({{0, 1, 2}, {3, 4, 5}}, device);
+    core::Tensor b = core::Tensor::Init<double>({10, 20, 30}, device);
+
+    core::kernel::FusedEWExpr expr = (core::kernel::FusedEWExpr(a) - b) / 2.0;
+    EXPECT_EQ(expr.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(expr.Eval().ToFlatVector<double>(),
+              std::vector<double>({-5, -9.5, -14, -3.5, -8, -12.5}));
+
+    // Non-contiguous input.
+    core::Tensor at = a.T();
+    core::Tensor dst = (-core::kernel::FusedEWExpr(at) + 1.0).Abs().Eval();
+    EXPECT_TRUE(dst.AllClose(at.Neg().Add(1.0).Abs()));
+}
+
+TEST_P(FusedEWPermuteDevices, InPlace) {
+    core::Device device = GetParam();
+    core::Tensor a =
+            core::Tensor::Init<int32_t>({{0, 1, 2}, {3, 4, 5}}, device);
+    core::Tensor b =
+            core::Tensor::Init<int32_t>({{1, 2, 3}, {4, 5, 6}}, device);
+
+    // a = a + b * 2 + a * a, reusing a as the output.
+    core::kernel::FusedEWExpr ea(a);
+    (ea + core::kernel::FusedEWExpr(b) * 2 + ea * ea).EvalTo(a);
+    EXPECT_EQ(a.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({2, 6, 12, 20, 30, 42}));
+}
+
+TEST_P(FusedEWPermuteDevices, LongChain) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Ones({1000}, core::Dtype::Float32, device);
+
+    core::kernel::FusedEWExpr ea(a);
+    core::kernel::FusedEWExpr expr = ea;
+    core::Tensor expected = a;
+    for (int i = 0; i < 20; ++i) {
+        expr = (expr + ea) * 0.5;
+        expected = (expected + a) * 0.5;
+    }
+    EXPECT_TRUE(expr.Eval().AllClose(expected));
+}
+
+TEST_P(FusedEWPermuteDevices, ManyInputs) {
+    core::Device device = GetParam();
+
+    // More inputs than the Indexer supports, evaluated op by op.
+    core::kernel::FusedEWExpr expr(
+            core::Tensor::Zeros({100}, core::Dtype::Int64, device));
+    for (int i = 0; i < 12; ++i) {
+        expr = expr + core::Tensor::Full({100}, i, core::Dtype::Int64, device);
+    }
+    EXPECT_EQ(expr.Eval().ToFlatVector<int64_t>(),
+              std::vector<int64_t>(100, 66));
+}
+
+TEST_P(FusedEWPermuteDevices, Exceptions) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Ones({2, 3}, core::Dtype::Float32, device);
+    core::Tensor b = core::Tensor::Ones({2, 3}, core::Dtype::Float64, device);
+    core::Tensor c = core::Tensor::Ones({2, 3}, core::Dtype::Int32, device);
+
+    // Dtype mismatch.
+    EXPECT_THROW(core::kernel::FusedEWExpr(a) + core::kernel::FusedEWExpr(b),
+                 std::runtime_error);
+
+    // Float-only op on integers.
+    EXPECT_THROW(core::kernel::FusedEWExpr(c).Sqrt(), std::runtime_error);
+
+    // Output shape mismatch.
+    core::Tensor dst = core::Tensor::Ones({3, 2}, core::Dtype::Float32, device);
+    EXPECT_THROW(core::kernel::FusedEWExpr(a).Neg().EvalTo(dst),
+                 std::runtime_error);
+}
+
+}  // namespace tests
+}  // namespace open3d
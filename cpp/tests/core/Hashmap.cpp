@@ -80,6 +80,7 @@ TEST_P(HashmapPermuteDevices, SimpleInit) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     for (auto backend : backends) {
@@ -110,6 +111,7 @@ TEST_P(HashmapPermuteDevices, Find) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -154,6 +156,7 @@ TEST_P(HashmapPermuteDevices, Insert) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -207,6 +210,7 @@ TEST_P(HashmapPermuteDevices, Erase) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -272,6 +276,7 @@ TEST_P(HashmapPermuteDevices, Rehash) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -326,6 +331,7 @@ TEST_P(HashmapPermuteDevices, Clear) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -384,6 +390,55 @@ TEST_P(HashmapPermuteDevices, Clear) {
     }
 }
 
+TEST_P(HashmapPermuteDevices, EraseInsertCycles) {
+    core::Device device = GetParam();
+    std::vector<core::HashmapBackend> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashmapBackend::Slab);
+        backends.push_back(core::HashmapBackend::StdGPU);
+    } else {
+        backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
+    }
+
+    const int n = 1000;
+    const int slots = 1000;
+    int init_capacity = n;
+
+    // Repeatedly erasing and re-inserting distinct keys leaves erased slots
+    // behind in open-addressing tables, which must be reclaimed.
+    for (auto backend : backends) {
+        core::Hashmap hashmap(init_capacity, core::Dtype::Int32,
+                              core::Dtype::Int32, {1}, {1}, device, backend);
+
+        for (int cycle = 0; cycle < 10; ++cycle) {
+            HashData<int, int> data(n, slots);
+            for (int &key : data.keys_) {
+                key += cycle;
+            }
+            core::Tensor keys(data.keys_, {n}, core::Dtype::Int32, device);
+            core::Tensor values(data.vals_, {n}, core::Dtype::Int32, device);
+
+            core::Tensor addrs, masks;
+            hashmap.Insert(keys, values, addrs, masks);
+            EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+                      slots);
+            EXPECT_EQ(hashmap.Size(), slots);
+
+            hashmap.Find(keys, addrs, masks);
+            EXPECT_TRUE(masks.All());
+            core::Tensor found_values = hashmap.GetValueTensor().IndexGet(
+                    {addrs.To(core::Dtype::Int64)});
+            EXPECT_TRUE(found_values.View({n}).AllClose(values));
+
+            hashmap.Erase(keys, masks);
+            EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+                      slots);
+            EXPECT_EQ(hashmap.Size(), 0);
+        }
+    }
+}
+
 class int3 {
 public:
     int3() : x_(0), y_(0), z_(0){};
@@ -404,6 +459,7 @@ TEST_P(HashmapPermuteDevices, InsertComplexKeys) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
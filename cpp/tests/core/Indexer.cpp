@@ -189,5 +189,36 @@ TEST_P(IndexerPermuteDevices, GetPointers) {
     EXPECT_EQ(indexer.GetOutputPtr(5), output_base_ptr + 5 * dtype_byte_size);
 }
 
+TEST_P(IndexerPermuteDevices, IsContiguous) {
+    core::Device device = GetParam();
+
+    core::Tensor a({2, 3}, core::Dtype::Float32, device);
+    core::Tensor b({2, 3}, core::Dtype::Float32, device);
+    core::Tensor scalar({}, core::Dtype::Float32, device);
+    core::Tensor row({3}, core::Dtype::Float32, device);
+    core::Tensor output({2, 3}, core::Dtype::Float32, device);
+
+    core::Indexer contiguous({a, b}, output);
+    EXPECT_TRUE(contiguous.IsContiguous());
+    EXPECT_TRUE(contiguous.IsInputContiguous(0));
+    EXPECT_TRUE(contiguous.IsOutputContiguous());
+    EXPECT_FALSE(contiguous.IsInputScalar(0));
+
+    core::Indexer broadcast_scalar({a, scalar}, output);
+    EXPECT_FALSE(broadcast_scalar.IsContiguous());
+    EXPECT_TRUE(broadcast_scalar.IsInputContiguous(0));
+    EXPECT_FALSE(broadcast_scalar.IsInputContiguous(1));
+    EXPECT_TRUE(broadcast_scalar.IsInputScalar(1));
+
+    core::Indexer broadcast_row({a, row}, output);
+    EXPECT_FALSE(broadcast_row.IsInputContiguous(1));
+    EXPECT_FALSE(broadcast_row.IsInputScalar(1));
+
+    core::Tensor transposed({3, 2}, core::Dtype::Float32, device);
+    core::Indexer strided({transposed.T()}, output);
+    EXPECT_FALSE(strided.IsContiguous());
+    EXPECT_FALSE(strided.IsInputContiguous(0));
+}
+
 }  // namespace tests
 }  // namespace open3d
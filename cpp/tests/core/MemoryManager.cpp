@@ -26,10 +26,12 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <thread>
 #include <vector>
 
 #include "open3d/core/Blob.h"
 #include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
 #include "tests/UnitTest.h"
 #include "tests/core/CoreTest.h"
 
@@ -78,5 +80,133 @@ TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     core::MemoryManager::Free(src_ptr, src_device);
 }
 
+#ifdef BUILD_CACHED_CPU_MANAGER
+// The tests below go through MemoryManager, which only uses the cached CPU
+// memory manager when it is enabled in the build.
+TEST(MemoryManager, CPUCachedReuse) {
+    using Manager = core::CPUCachedMemoryManager;
+    core::Device device("CPU:0");
+    Manager::SetCacheEnabled(true);
+    Manager::ReleaseCache();
+    Manager::ResetStatistics();
+
+    void* ptr = core::MemoryManager::Malloc(1000, device);
+    core::MemoryManager::Free(ptr, device);
+    // 1000 bytes rounds up to the same size class as 1020.
+    void* ptr_reused = core::MemoryManager::Malloc(1020, device);
+    EXPECT_EQ(ptr, ptr_reused);
+    // Too large for the cached block.
+    void* ptr_other = core::MemoryManager::Malloc(2000, device);
+    EXPECT_NE(ptr, ptr_other);
+
+    Manager::Statistics stats = Manager::GetStatistics();
+    EXPECT_EQ(stats.num_malloc_, 3);
+    EXPECT_EQ(stats.num_cache_hits_, 1);
+    EXPECT_EQ(stats.num_system_malloc_, 2);
+    EXPECT_EQ(stats.cached_bytes_, 0);
+
+    core::MemoryManager::Free(ptr_reused, device);
+    core::MemoryManager::Free(ptr_other, device);
+    EXPECT_GT(Manager::GetStatistics().cached_bytes_, 0);
+    Manager::ReleaseCache();
+    stats = Manager::GetStatistics();
+    EXPECT_EQ(stats.cached_bytes_, 0);
+    EXPECT_EQ(stats.num_system_free_, 2);
+
+    Manager::SetCacheEnabled(false);
+}
+
+TEST(MemoryManager, CPUCachedToggle) {
+    using Manager = core::CPUCachedMemoryManager;
+    core::Device device("CPU:0");
+    Manager::SetCacheEnabled(false);
+    const int64_t in_use_bytes = Manager::GetStatistics().in_use_bytes_;
+
+    // Blocks may be freed in a different mode than they were allocated in.
+    void* ptr_uncached = core::MemoryManager::Malloc(100, device);
+    Manager::SetCacheEnabled(true);
+    void* ptr_cached = core::MemoryManager::Malloc(100, device);
+    core::MemoryManager::Free(ptr_uncached, device);
+    Manager::SetCacheEnabled(false);
+    core::MemoryManager::Free(ptr_cached, device);
+
+    Manager::Statistics stats = Manager::GetStatistics();
+    EXPECT_EQ(stats.in_use_bytes_, in_use_bytes);
+    EXPECT_EQ(stats.cached_bytes_, 0);
+    EXPECT_FALSE(Manager::IsCacheEnabled());
+}
+
+TEST(MemoryManager, CPUCachedMaxCachedBytes) {
+    using Manager = core::CPUCachedMemoryManager;
+    core::Device device("CPU:0");
+    Manager::SetCacheEnabled(true);
+    Manager::SetMaxCachedBytes(0);
+    Manager::ResetStatistics();
+
+    // Large blocks bypass the thread-local cache and hit the limit.
+    void* ptr = core::MemoryManager::Malloc(1 << 20, device);
+    core::MemoryManager::Free(ptr, device);
+    Manager::Statistics stats = Manager::GetStatistics();
+    EXPECT_EQ(stats.cached_bytes_, 0);
+    EXPECT_EQ(stats.num_system_free_, 1);
+
+    Manager::SetMaxCachedBytes(size_t(1) << 30);
+    Manager::SetCacheEnabled(false);
+}
+
+TEST(MemoryManager, CPUCachedMultiThread) {
+    using Manager = core::CPUCachedMemoryManager;
+    core::Device device("CPU:0");
+    Manager::SetCacheEnabled(true);
+    Manager::ReleaseCache();
+    const int64_t in_use_bytes = Manager::GetStatistics().in_use_bytes_;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&device, t]() {
+            for (int i = 0; i < 1000; ++i) {
+                const size_t byte_size = 16 << ((i + t) % 16);
+                char* ptr = static_cast<char*>(
+                        core::MemoryManager::Malloc(byte_size, device));
+                ptr[0] = ptr[byte_size - 1] = static_cast<char>(t);
+                core::MemoryManager::Free(ptr, device);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Exited threads hand their blocks back to the shared pool.
+    Manager::Statistics stats = Manager::GetStatistics();
+    EXPECT_EQ(stats.in_use_bytes_, in_use_bytes);
+    EXPECT_GT(stats.cached_bytes_, 0);
+    Manager::ReleaseCache();
+    EXPECT_EQ(Manager::GetStatistics().cached_bytes_, 0);
+
+    Manager::SetCacheEnabled(false);
+}
+
+TEST(MemoryManager, CPUCachedTensor) {
+    using Manager = core::CPUCachedMemoryManager;
+    core::Device device("CPU:0");
+    Manager::SetCacheEnabled(true);
+    Manager::ResetStatistics();
+
+    core::Tensor sum = core::Tensor::Zeros({100, 3}, core::Dtype::Float32,
+                                           device);
+    for (int i = 0; i < 10; ++i) {
+        core::Tensor ones =
+                core::Tensor::Ones({100, 3}, core::Dtype::Float32, device);
+        sum = sum + ones;
+    }
+    EXPECT_TRUE(sum.AllClose(core::Tensor::Full({100, 3}, 10.f,
+                                                core::Dtype::Float32, device)));
+    EXPECT_GT(Manager::GetStatistics().num_cache_hits_, 0);
+
+    Manager::SetCacheEnabled(false);
+}
+#endif
+
 }  // namespace tests
 }  // namespace open3d
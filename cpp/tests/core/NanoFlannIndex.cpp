@@ -26,8 +26,10 @@
 
 #include "open3d/core/nns/NanoFlannIndex.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <random>
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
@@ -79,6 +81,141 @@ TEST(NanoFlannIndex, SearchKnn) {
     EXPECT_EQ(distances.GetShape(), core::SizeVector({1, 10}));
 }
 
+TEST(NanoFlannIndex, SearchKnnPreallocated) {
+    int size = 10;
+    std::vector<double> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0,
+                               0.2, 0.0, 0.1, 0.0, 0.0, 0.1, 0.1, 0.0,
+                               0.1, 0.2, 0.0, 0.2, 0.0, 0.0, 0.2, 0.1,
+                               0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float64);
+    core::nns::NanoFlannIndex index(ref);
+
+    core::Tensor query(std::vector<double>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float64);
+
+    // Outputs with a wrong shape or dtype are rejected.
+    core::Tensor indices = core::Tensor::Empty({1, 3}, core::Dtype::Int64);
+    core::Tensor distances = core::Tensor::Empty({1, 3}, core::Dtype::Float32);
+    EXPECT_THROW(index.SearchKnn(query, 3, indices, distances),
+                 std::runtime_error);
+    distances = core::Tensor::Empty({1, 3}, core::Dtype::Float64);
+    EXPECT_THROW(index.SearchKnn(query, 4, indices, distances),
+                 std::runtime_error);
+
+    index.SearchKnn(query, 3, indices, distances);
+    ExpectEQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 4, 9}));
+    ExpectEQ(distances.ToFlatVector<double>(),
+             std::vector<double>({0.00626358, 0.00747938, 0.0108912}));
+
+    // Unsorted output holds the same neighbors.
+    index.SearchKnn(query, 3, indices, distances, false);
+    std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+    std::sort(indices_vec.begin(), indices_vec.end());
+    ExpectEQ(indices_vec, std::vector<int64_t>({1, 4, 9}));
+
+    // Rows are padded when knn is larger than the dataset.
+    indices = core::Tensor::Empty({1, 12}, core::Dtype::Int64);
+    distances = core::Tensor::Empty({1, 12}, core::Dtype::Float64);
+    index.SearchKnn(query, 12, indices, distances);
+    ExpectEQ(indices.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, 9, 0, 3, 2, 5, 7, 6, 8, -1, -1}));
+    EXPECT_EQ(distances[0][11].Item<double>(), 0);
+}
+
+TEST(NanoFlannIndex, SearchHybridPreallocated) {
+    const int64_t num_points = 1000;
+    const int64_t num_queries = 3000;
+    const int max_knn = 5;
+    const double radius = 0.1;
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    std::vector<float> ref_vec(num_points * 3);
+    std::vector<float> query_vec(num_queries * 3);
+    for (float &v : ref_vec) v = uniform(rng);
+    for (float &v : query_vec) v = uniform(rng);
+    core::Tensor ref(ref_vec, {num_points, 3}, core::Dtype::Float32);
+    core::Tensor query(query_vec, {num_queries, 3}, core::Dtype::Float32);
+    core::nns::NanoFlannIndex index(ref);
+
+    core::Tensor indices =
+            core::Tensor::Empty({num_queries, max_knn}, core::Dtype::Int64);
+    core::Tensor distances =
+            core::Tensor::Empty({num_queries, max_knn}, core::Dtype::Float32);
+    index.SearchHybrid(query, radius, max_knn, indices, distances);
+    std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+    std::vector<float> distances_vec = distances.ToFlatVector<float>();
+
+    // Compare against brute force. The queries span several chunks.
+    for (int64_t q = 0; q < num_queries; ++q) {
+        std::vector<std::pair<float, int64_t>> expected;
+        for (int64_t p = 0; p < num_points; ++p) {
+            float dist = 0;
+            for (int d = 0; d < 3; ++d) {
+                float diff = ref_vec[p * 3 + d] - query_vec[q * 3 + d];
+                dist += diff * diff;
+            }
+            if (dist < radius * radius) {
+                expected.emplace_back(dist, p);
+            }
+        }
+        std::sort(expected.begin(), expected.end());
+        for (int k = 0; k < max_knn; ++k) {
+            if (k < int(expected.size())) {
+                EXPECT_EQ(indices_vec[q * max_knn + k], expected[k].second);
+                EXPECT_FLOAT_EQ(distances_vec[q * max_knn + k],
+                                expected[k].first);
+            } else {
+                EXPECT_EQ(indices_vec[q * max_knn + k], -1);
+                EXPECT_EQ(distances_vec[q * max_knn + k], 0);
+            }
+        }
+    }
+}
+
+TEST(NanoFlannIndex, SearchNearest) {
+    const int64_t num_points = 1000;
+    const int64_t num_queries = 500;
+    const double radius = 0.05;
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<double> ref_vec(num_points * 3);
+    std::vector<double> query_vec(num_queries * 3);
+    for (double &v : ref_vec) v = uniform(rng);
+    for (double &v : query_vec) v = uniform(rng);
+    core::Tensor ref(ref_vec, {num_points, 3}, core::Dtype::Float64);
+    core::Tensor query(query_vec, {num_queries, 3}, core::Dtype::Float64);
+    core::nns::NanoFlannIndex index(ref);
+
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = index.SearchHybrid(query, radius, 1);
+    std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+    std::vector<double> distances_vec = distances.ToFlatVector<double>();
+
+    int64_t num_found = 0;
+    for (int64_t q = 0; q < num_queries; ++q) {
+        int64_t nn_index;
+        double nn_distance;
+        bool found = index.SearchNearest(query_vec.data() + 3 * q, radius,
+                                         nn_index, nn_distance);
+        EXPECT_EQ(found, indices_vec[q] != -1);
+        EXPECT_EQ(nn_index, indices_vec[q]);
+        EXPECT_DOUBLE_EQ(nn_distance, distances_vec[q]);
+        num_found += found;
+    }
+    // Both found and missing neighbors are covered.
+    EXPECT_GT(num_found, 0);
+    EXPECT_LT(num_found, num_queries);
+
+    // The query dtype must match the dataset.
+    int64_t nn_index;
+    float nn_distance;
+    const float query_float[3] = {0.5f, 0.5f, 0.5f};
+    EXPECT_THROW(index.SearchNearest(query_float, 0.1f, nn_index, nn_distance),
+                 std::runtime_error);
+}
+
 TEST(NanoFlannIndex, SearchRadius) {
     std::vector<int> ref_indices = {1, 4};
     std::vector<double> ref_distance = {0.00626358, 0.00747938};
@@ -0,0 +1,210 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/NumpyIO.h"
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class NumpyIOPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(NumpyIO,
+                         NumpyIOPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static const std::vector<core::NumpyArray::LoadMode> kLoadModes = {
+        core::NumpyArray::LoadMode::Read,
+        core::NumpyArray::LoadMode::MapReadOnly,
+        core::NumpyArray::LoadMode::MapCopyOnWrite};
+
+static std::string ReadFileToString(const std::string& file_name) {
+    std::ifstream in(file_name, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in),
+                       std::istreambuf_iterator<char>());
+}
+
+template <typename T>
+static void AppendLittleEndian(std::string& out, T value) {
+    for (size_t i = 0; i < sizeof(T); i++) {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+// Writes a zip archive whose entries are stored with the given compression
+// method, without computing CRCs. Members are (name, content) pairs.
+static void WriteZip(
+        const std::string& file_name,
+        const std::vector<std::pair<std::string, std::string>>& members,
+        uint16_t method = 0) {
+    std::string out;
+    std::string cd;
+    for (const auto& member : members) {
+        const std::string& name = member.first;
+        const std::string& data = member.second;
+        uint32_t local_offset = static_cast<uint32_t>(out.size());
+
+        AppendLittleEndian<uint32_t>(out, 0x04034b50);
+        AppendLittleEndian<uint16_t>(out, 20);  // Version needed.
+        AppendLittleEndian<uint16_t>(out, 0);   // Flags.
+        AppendLittleEndian<uint16_t>(out, method);
+        AppendLittleEndian<uint32_t>(out, 0);  // Time, date.
+        AppendLittleEndian<uint32_t>(out, 0);  // CRC-32.
+        AppendLittleEndian<uint32_t>(out, static_cast<uint32_t>(data.size()));
+        AppendLittleEndian<uint32_t>(out, static_cast<uint32_t>(data.size()));
+        AppendLittleEndian<uint16_t>(out, static_cast<uint16_t>(name.size()));
+        AppendLittleEndian<uint16_t>(out, 0);  // Extra field size.
+        out += name;
+        out += data;
+
+        AppendLittleEndian<uint32_t>(cd, 0x02014b50);
+        AppendLittleEndian<uint16_t>(cd, 20);  // Version made by.
+        AppendLittleEndian<uint16_t>(cd, 20);  // Version needed.
+        AppendLittleEndian<uint16_t>(cd, 0);   // Flags.
+        AppendLittleEndian<uint16_t>(cd, method);
+        AppendLittleEndian<uint32_t>(cd, 0);  // Time, date.
+        AppendLittleEndian<uint32_t>(cd, 0);  // CRC-32.
+        AppendLittleEndian<uint32_t>(cd, static_cast<uint32_t>(data.size()));
+        AppendLittleEndian<uint32_t>(cd, static_cast<uint32_t>(data.size()));
+        AppendLittleEndian<uint16_t>(cd, static_cast<uint16_t>(name.size()));
+        AppendLittleEndian<uint16_t>(cd, 0);  // Extra field size.
+        AppendLittleEndian<uint16_t>(cd, 0);  // Comment size.
+        AppendLittleEndian<uint16_t>(cd, 0);  // Disk number.
+        AppendLittleEndian<uint16_t>(cd, 0);  // Internal attributes.
+        AppendLittleEndian<uint32_t>(cd, 0);  // External attributes.
+        AppendLittleEndian<uint32_t>(cd, local_offset);
+        cd += name;
+    }
+    uint32_t cd_offset = static_cast<uint32_t>(out.size());
+    out += cd;
+    AppendLittleEndian<uint32_t>(out, 0x06054b50);
+    AppendLittleEndian<uint16_t>(out, 0);  // Disk number.
+    AppendLittleEndian<uint16_t>(out, 0);  // Disk with central directory.
+    AppendLittleEndian<uint16_t>(out, static_cast<uint16_t>(members.size()));
+    AppendLittleEndian<uint16_t>(out, static_cast<uint16_t>(members.size()));
+    AppendLittleEndian<uint32_t>(out, static_cast<uint32_t>(cd.size()));
+    AppendLittleEndian<uint32_t>(out, cd_offset);
+    AppendLittleEndian<uint16_t>(out, 0);  // Comment size.
+
+    std::ofstream(file_name, std::ios::binary).write(out.data(), out.size());
+}
+
+TEST_P(NumpyIOPermuteDevices, LoadModes) {
+    const core::Device& device = GetParam();
+    const std::string file_name = "numpy_io_load_modes.npy";
+
+    std::vector<float> values(300);
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = static_cast<float>(i) * 0.5f;
+    }
+    core::Tensor t(values, {100, 3}, core::Dtype::Float32, device);
+    t.Save(file_name);
+
+    for (core::NumpyArray::LoadMode mode : kLoadModes) {
+        core::Tensor t_load =
+                core::NumpyArray::Load(file_name, mode).ToTensor();
+        EXPECT_EQ(t_load.GetShape(), core::SizeVector({100, 3}));
+        EXPECT_TRUE(t_load.To(device).AllClose(t));
+    }
+
+    // Private mappings can be written to without changing the file.
+    core::Tensor t_cow =
+            core::NumpyArray::Load(file_name,
+                                   core::NumpyArray::LoadMode::MapCopyOnWrite)
+                    .ToTensor();
+    t_cow.Fill(-1);
+    EXPECT_EQ(t_cow.ToFlatVector<float>(), std::vector<float>(300, -1));
+    EXPECT_EQ(core::Tensor::Load(file_name).ToFlatVector<float>(), values);
+
+    // {0} tensor.
+    t = core::Tensor::Ones({0}, core::Dtype::Float32, device);
+    t.Save(file_name);
+    for (core::NumpyArray::LoadMode mode : kLoadModes) {
+        core::Tensor t_load =
+                core::NumpyArray::Load(file_name, mode).ToTensor();
+        EXPECT_EQ(t_load.GetShape(), core::SizeVector({0}));
+    }
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST_P(NumpyIOPermuteDevices, LoadNpz) {
+    const core::Device& device = GetParam();
+    const std::string npy_name = "numpy_io_npz_member.npy";
+    const std::string npz_name = "numpy_io.npz";
+
+    core::Tensor a = core::Tensor::Init<double>({{0, 1, 2}, {3, 4, 5}}, device);
+    core::Tensor b = core::Tensor::Init<int64_t>({-1, 2, -3, 4}, device);
+    core::Tensor c = core::Tensor::Init<uint8_t>({1, 2, 3, 4, 5}, device);
+    // The data of "alpha1" is 8-byte aligned within the archive and is mapped,
+    // the data of "bb" is not and is copied out of the mapping.
+    std::vector<std::pair<std::string, core::Tensor>> tensors = {
+            {"alpha1.npy", a}, {"bb.npy", b}, {"c", c}};
+    std::vector<std::pair<std::string, std::string>> members;
+    for (const auto& member : tensors) {
+        member.second.Save(npy_name);
+        members.emplace_back(member.first, ReadFileToString(npy_name));
+    }
+    WriteZip(npz_name, members);
+
+    for (core::NumpyArray::LoadMode mode : kLoadModes) {
+        auto arrays = core::NumpyArray::LoadNpz(npz_name, mode);
+        EXPECT_EQ(arrays.size(), 3);
+        ASSERT_EQ(arrays.count("alpha1"), 1);
+        ASSERT_EQ(arrays.count("bb"), 1);
+        ASSERT_EQ(arrays.count("c"), 1);
+        EXPECT_TRUE(arrays.at("alpha1").ToTensor().To(device).AllClose(a));
+        EXPECT_TRUE(arrays.at("bb").ToTensor().To(device).AllClose(b));
+        EXPECT_TRUE(arrays.at("c").ToTensor().To(device).AllClose(c));
+    }
+
+    // Tensors keep the shared mapping alive after the arrays are gone.
+    core::Tensor a_load =
+            core::NumpyArray::LoadNpz(npz_name,
+                                      core::NumpyArray::LoadMode::MapReadOnly)
+                    .at("alpha1")
+                    .ToTensor();
+    EXPECT_TRUE(a_load.To(device).AllClose(a));
+
+    // Compressed archives are not supported.
+    WriteZip(npz_name, members, 8);
+    EXPECT_ANY_THROW(core::NumpyArray::LoadNpz(npz_name));
+
+    utility::filesystem::RemoveFile(npy_name);
+    utility::filesystem::RemoveFile(npz_name);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,226 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "open3d/geometry/Octree.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/io/PointCloudIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+struct TraversedNode {
+    Eigen::Vector3d origin_;
+    double size_;
+    size_t depth_;
+    size_t child_index_;
+};
+
+std::vector<TraversedNode> TraverseOctree(const geometry::Octree& octree) {
+    std::vector<TraversedNode> nodes;
+    octree.Traverse([&nodes](const std::shared_ptr<geometry::OctreeNode>&,
+                             const std::shared_ptr<geometry::OctreeNodeInfo>&
+                                     info) -> bool {
+        nodes.push_back({info->origin_, info->size_, info->depth_,
+                         info->child_index_});
+        return false;
+    });
+    return nodes;
+}
+
+std::vector<TraversedNode> TraverseOctree(
+        const geometry::LinearOctree& octree) {
+    std::vector<TraversedNode> nodes;
+    octree.Traverse([&nodes](size_t,
+                             const geometry::OctreeNodeInfo& info) -> bool {
+        nodes.push_back(
+                {info.origin_, info.size_, info.depth_, info.child_index_});
+        return false;
+    });
+    return nodes;
+}
+
+}  // namespace
+
+TEST(LinearOctree, EightCubes) {
+    geometry::PointCloud pcd;
+    for (int z = 0; z < 2; ++z) {
+        for (int y = 0; y < 2; ++y) {
+            for (int x = 0; x < 2; ++x) {
+                pcd.points_.push_back(
+                        Eigen::Vector3d(x + 0.5, y + 0.5, z + 0.5));
+                pcd.colors_.push_back(Eigen::Vector3d(x, y, z));
+            }
+        }
+    }
+    geometry::LinearOctree octree(1);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+
+    EXPECT_EQ(octree.nodes_.size(), 9u);
+    EXPECT_EQ(octree.GetLevelRange(0), std::make_pair(size_t(0), size_t(1)));
+    EXPECT_EQ(octree.GetLevelRange(1), std::make_pair(size_t(1), size_t(9)));
+    ExpectEQ(octree.colors_[0], Eigen::Vector3d(0.5, 0.5, 0.5));
+    for (size_t i = 1; i < 9; ++i) {
+        // Point i lies in child i
+        EXPECT_EQ(octree.nodes_[i].code_, i - 1);
+        EXPECT_EQ(octree.point_indices_[octree.nodes_[i].point_begin_],
+                  i - 1);
+        ExpectEQ(octree.colors_[i], pcd.colors_[i - 1]);
+        EXPECT_EQ(octree.GetNodeDepth(i), 1u);
+    }
+
+    auto voxel_grid = octree.ToVoxelGrid();
+    EXPECT_EQ(voxel_grid->voxels_.size(), 8u);
+    for (const auto& it : voxel_grid->voxels_) {
+        ExpectEQ(it.second.color_, Eigen::Vector3d(it.first.cast<double>()));
+    }
+}
+
+TEST(LinearOctree, FragmentPLYMatchesOctree) {
+    geometry::PointCloud pcd;
+    io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.ply", pcd);
+    for (size_t max_depth : {0, 1, 5, 8}) {
+        geometry::Octree octree(max_depth);
+        octree.ConvertFromPointCloud(pcd, 0.01);
+        geometry::LinearOctree linear_octree(max_depth);
+        linear_octree.ConvertFromPointCloud(pcd, 0.01);
+
+        EXPECT_TRUE(*linear_octree.ToOctree() == octree);
+
+        std::vector<TraversedNode> nodes = TraverseOctree(octree);
+        std::vector<TraversedNode> linear_nodes = TraverseOctree(linear_octree);
+        ASSERT_EQ(nodes.size(), linear_nodes.size());
+        ASSERT_EQ(nodes.size(), linear_octree.nodes_.size());
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            ExpectEQ(nodes[i].origin_, linear_nodes[i].origin_);
+            EXPECT_EQ(nodes[i].size_, linear_nodes[i].size_);
+            EXPECT_EQ(nodes[i].depth_, linear_nodes[i].depth_);
+            EXPECT_EQ(nodes[i].child_index_, linear_nodes[i].child_index_);
+        }
+
+        // Converting back yields the same nodes
+        geometry::LinearOctree converted;
+        converted.CreateFromOctree(octree);
+        ASSERT_EQ(converted.nodes_.size(), linear_octree.nodes_.size());
+        EXPECT_EQ(converted.level_offsets_, linear_octree.level_offsets_);
+        EXPECT_EQ(converted.point_indices_, linear_octree.point_indices_);
+        for (size_t i = 0; i < converted.nodes_.size(); ++i) {
+            EXPECT_EQ(converted.nodes_[i].code_, linear_octree.nodes_[i].code_);
+            EXPECT_EQ(converted.nodes_[i].point_end_,
+                      linear_octree.nodes_[i].point_end_);
+            ExpectEQ(converted.colors_[i], linear_octree.colors_[i]);
+        }
+    }
+}
+
+TEST(LinearOctree, FragmentPLYLocate) {
+    geometry::PointCloud pcd;
+    io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.ply", pcd);
+    size_t max_depth = 5;
+    geometry::LinearOctree octree(max_depth);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+
+    for (size_t idx = 0; idx < pcd.points_.size(); idx += 200) {
+        const Eigen::Vector3d& point = pcd.points_[idx];
+        int64_t node_index;
+        geometry::OctreeNodeInfo node_info;
+        std::tie(node_index, node_info) = octree.LocateLeafNode(point);
+        ASSERT_GE(node_index, 0);
+        EXPECT_TRUE(geometry::Octree::IsPointInBound(point, node_info.origin_,
+                                                     node_info.size_));
+        EXPECT_EQ(node_info.depth_, max_depth);
+        EXPECT_EQ(node_info.size_, octree.size_ / pow(2, max_depth));
+
+        const geometry::LinearOctreeNode& node = octree.nodes_[node_index];
+        EXPECT_NE(std::find(octree.point_indices_.begin() + node.point_begin_,
+                            octree.point_indices_.begin() + node.point_end_,
+                            idx),
+                  octree.point_indices_.begin() + node.point_end_);
+    }
+    Eigen::Vector3d out_of_bound = octree.origin_ - Eigen::Vector3d::Ones();
+    EXPECT_EQ(octree.LocateLeafNode(out_of_bound).first, -1);
+}
+
+TEST(LinearOctree, FragmentPLYLevelOfDetail) {
+    geometry::PointCloud pcd;
+    io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.ply", pcd);
+    size_t max_depth = 6;
+    geometry::LinearOctree octree(max_depth);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+
+    for (size_t depth = 0; depth <= max_depth; ++depth) {
+        size_t begin, end;
+        std::tie(begin, end) = octree.GetLevelRange(depth);
+        ASSERT_LT(begin, end);
+        // Every level covers all points in Morton order
+        EXPECT_EQ(octree.nodes_[begin].point_begin_, 0u);
+        EXPECT_EQ(octree.nodes_[end - 1].point_end_, pcd.points_.size());
+        for (size_t i = begin; i < end; ++i) {
+            const geometry::LinearOctreeNode& node = octree.nodes_[i];
+            EXPECT_EQ(octree.GetNodeDepth(i), depth);
+            if (i > begin) {
+                EXPECT_LT(octree.nodes_[i - 1].code_, node.code_);
+                EXPECT_EQ(octree.nodes_[i - 1].point_end_, node.point_begin_);
+            }
+            if (depth == max_depth) {
+                EXPECT_EQ(node.child_begin_, node.child_end_);
+                continue;
+            }
+            Eigen::Vector3d color(0, 0, 0);
+            for (size_t c = node.child_begin_; c < node.child_end_; ++c) {
+                EXPECT_EQ(octree.nodes_[c].code_ >> 3, node.code_);
+                color += octree.colors_[c];
+            }
+            color /= double(node.child_end_ - node.child_begin_);
+            ExpectEQ(octree.colors_[i], color);
+        }
+    }
+}
+
+TEST(LinearOctree, VoxelGridMatchesOctree) {
+    geometry::PointCloud pcd;
+    io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.ply", pcd);
+    auto voxel_grid = geometry::VoxelGrid::CreateFromPointCloud(pcd, 0.05);
+
+    geometry::Octree octree(6);
+    octree.CreateFromVoxelGrid(*voxel_grid);
+    geometry::LinearOctree linear_octree(6);
+    linear_octree.CreateFromVoxelGrid(*voxel_grid);
+    EXPECT_FALSE(linear_octree.HasPointIndices());
+    EXPECT_TRUE(*linear_octree.ToOctree() == octree);
+}
+
+}  // namespace tests
+}  // namespace open3d
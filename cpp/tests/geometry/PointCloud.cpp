@@ -27,10 +27,12 @@
 #include "open3d/geometry/PointCloud.h"
 
 #include <algorithm>
+#include <queue>
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/Image.h"
+#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/io/ImageIO.h"
@@ -1021,6 +1023,72 @@ TEST(PointCloud, ClusterDBSCAN) {
     EXPECT_EQ(cluster_sum, 398580);
 }
 
+// Sequential DBSCAN with kd-tree neighbors, as ClusterDBSCAN used to be.
+static std::vector<int> ClusterDBSCANSequential(const geometry::PointCloud& pcd,
+                                                double eps,
+                                                size_t min_points) {
+    geometry::KDTreeFlann kdtree(pcd);
+    std::vector<std::vector<int>> nbs(pcd.points_.size());
+    for (size_t idx = 0; idx < pcd.points_.size(); ++idx) {
+        std::vector<double> dists2;
+        kdtree.SearchRadius(pcd.points_[idx], eps, nbs[idx], dists2);
+    }
+
+    std::vector<int> labels(pcd.points_.size(), -2);
+    int cluster_label = 0;
+    for (size_t idx = 0; idx < pcd.points_.size(); ++idx) {
+        if (labels[idx] != -2) continue;
+        if (nbs[idx].size() < min_points) {
+            labels[idx] = -1;
+            continue;
+        }
+        std::queue<int> queue;
+        queue.push(int(idx));
+        labels[idx] = cluster_label;
+        while (!queue.empty()) {
+            int core = queue.front();
+            queue.pop();
+            for (int nb : nbs[core]) {
+                if (labels[nb] == -1) labels[nb] = cluster_label;
+                if (labels[nb] != -2) continue;
+                labels[nb] = cluster_label;
+                if (nbs[nb].size() >= min_points) queue.push(nb);
+            }
+        }
+        cluster_label++;
+    }
+    return labels;
+}
+
+TEST(PointCloud, ClusterDBSCANMatchesSequential) {
+    geometry::PointCloud pcd;
+    // Dense blobs, some touching, on top of uniform noise.
+    for (int blob = 0; blob < 6; ++blob) {
+        std::vector<Eigen::Vector3d> points(400);
+        Eigen::Vector3d center(0.3 * blob, 0.1 * (blob % 2), 0);
+        Rand(points, center, center + Eigen::Vector3d(0.2, 0.2, 0.2), blob);
+        pcd.points_.insert(pcd.points_.end(), points.begin(), points.end());
+    }
+    std::vector<Eigen::Vector3d> noise(1000);
+    Rand(noise, Eigen::Vector3d(-0.5, -0.5, -0.5),
+         Eigen::Vector3d(2.0, 1.0, 1.0), 100);
+    pcd.points_.insert(pcd.points_.end(), noise.begin(), noise.end());
+
+    for (double eps : {0.02, 0.03, 0.05}) {
+        for (size_t min_points : {1, 4, 10}) {
+            std::vector<int> labels = pcd.ClusterDBSCAN(eps, min_points);
+            EXPECT_EQ(labels, ClusterDBSCANSequential(pcd, eps, min_points));
+        }
+    }
+    EXPECT_TRUE(geometry::PointCloud().ClusterDBSCAN(0.1, 1).empty());
+
+    // Invalid eps, and eps too small for the extent of the point cloud.
+    EXPECT_THROW(pcd.ClusterDBSCAN(0, 1), std::runtime_error);
+    EXPECT_THROW(pcd.ClusterDBSCAN(-0.1, 1), std::runtime_error);
+    geometry::PointCloud far_pcd({{0, 0, 0}, {1e6, 0, 0}});
+    EXPECT_THROW(far_pcd.ClusterDBSCAN(1e-9, 1), std::runtime_error);
+}
+
 TEST(PointCloud, SegmentPlane) {
     geometry::PointCloud pcd;
     io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.pcd", pcd);
@@ -1050,6 +1118,53 @@ TEST(PointCloud, SegmentPlaneKnownPlane) {
     ExpectEQ(pcd.SelectByIndex(inliers)->points_, ref);
 }
 
+TEST(PointCloud, SegmentPlanes) {
+    // Ground plane z = 0, walls x = 2 and y = 3, and uniform clutter.
+    geometry::PointCloud pcd;
+    std::vector<Eigen::Vector3d> ground(20000), wall_x(5000), wall_y(2000),
+            clutter(1000);
+    Rand(ground, Eigen::Vector3d(-5, -5, 0), Eigen::Vector3d(5, 5, 0), 0);
+    Rand(wall_x, Eigen::Vector3d(2, -5, 0.5), Eigen::Vector3d(2, 5, 3), 1);
+    Rand(wall_y, Eigen::Vector3d(-5, 3, 0.5), Eigen::Vector3d(1, 3, 3), 2);
+    Rand(clutter, Eigen::Vector3d(-1, -1, 0.5), Eigen::Vector3d(1, 1, 2), 3);
+    for (const auto* points : {&ground, &wall_x, &wall_y, &clutter}) {
+        pcd.points_.insert(pcd.points_.end(), points->begin(), points->end());
+    }
+
+    Eigen::Vector4d plane_model;
+    std::vector<size_t> inliers;
+    std::tie(plane_model, inliers) = pcd.SegmentPlane(0.01, 3, 1000);
+    EXPECT_NEAR(std::abs(plane_model(2)), 1.0, 1e-6);
+    EXPECT_NEAR(plane_model(3), 0.0, 1e-6);
+    EXPECT_GE(inliers.size(), ground.size());
+    EXPECT_TRUE(std::is_sorted(inliers.begin(), inliers.end()));
+
+    auto planes = pcd.SegmentPlanes(0.01, 3, 1000, 5, 500);
+    ASSERT_EQ(planes.size(), 3);
+    const std::vector<Eigen::Vector3d> normals = {
+            {0, 0, 1}, {1, 0, 0}, {0, 1, 0}};
+    const std::vector<double> offsets = {0, 2, 3};
+    const std::vector<size_t> sizes = {ground.size(), wall_x.size(),
+                                       wall_y.size()};
+    std::vector<bool> taken(pcd.points_.size(), false);
+    for (size_t i = 0; i < planes.size(); ++i) {
+        std::tie(plane_model, inliers) = planes[i];
+        const double sign = plane_model.head<3>().dot(normals[i]) > 0 ? 1 : -1;
+        ExpectEQ(Eigen::Vector3d(sign * plane_model.head<3>()), normals[i],
+                 1e-6);
+        EXPECT_NEAR(-sign * plane_model(3), offsets[i], 1e-6);
+        EXPECT_GE(inliers.size(), sizes[i]);
+        EXPECT_LT(inliers.size(), sizes[i] + clutter.size());
+        for (size_t idx : inliers) {
+            EXPECT_FALSE(taken[idx]);
+            taken[idx] = true;
+        }
+    }
+
+    EXPECT_ANY_THROW(pcd.SegmentPlane(0.01, 2, 100));
+    EXPECT_ANY_THROW(pcd.SegmentPlane(0.01, 3, 100, 0.0));
+}
+
 TEST(PointCloud, CreateFromDepthImage) {
     const std::string trajectory_path =
             std::string(TEST_DATA_DIR) + "/RGBD/trajectory.log";
@@ -1072,6 +1072,86 @@ TEST(TriangleMesh, GetVolume) {
                 4.0 / 3.0 * M_PI, 0.05);
 }
 
+TEST(TriangleMesh, SimplifyVertexClustering) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0.0, 0.0, 0.0},
+                      {0.1, 0.0, 0.0},
+                      {1.0, 0.0, 0.0},
+                      {0.0, 1.0, 0.0},
+                      {1.0, 1.0, 0.0}};
+    mesh.vertex_colors_ = {{0.0, 0.0, 0.0},
+                           {1.0, 0.5, 0.0},
+                           {0.0, 1.0, 0.0},
+                           {0.0, 0.0, 1.0},
+                           {1.0, 1.0, 1.0}};
+    mesh.triangles_ = {{0, 2, 3}, {1, 2, 3}, {2, 4, 3}};
+
+    // The first two vertices share a voxel, so the first two triangles
+    // collapse to the same one.
+    std::vector<Eigen::Vector3d> ref_vertices = {{0.05, 0.0, 0.0},
+                                                 {1.0, 0.0, 0.0},
+                                                 {0.0, 1.0, 0.0},
+                                                 {1.0, 1.0, 0.0}};
+    std::vector<Eigen::Vector3d> ref_colors = {{0.5, 0.25, 0.0},
+                                               {0.0, 1.0, 0.0},
+                                               {0.0, 0.0, 1.0},
+                                               {1.0, 1.0, 1.0}};
+    std::vector<Eigen::Vector3i> ref_triangles = {{0, 1, 2}, {1, 3, 2}};
+    for (auto contraction :
+         {geometry::TriangleMesh::SimplificationContraction::Average,
+          geometry::TriangleMesh::SimplificationContraction::Quadric}) {
+        auto simplified = mesh.SimplifyVertexClustering(0.5, contraction);
+        ExpectEQ(simplified->vertices_, ref_vertices);
+        ExpectEQ(simplified->vertex_colors_, ref_colors);
+        ExpectEQ(simplified->triangles_, ref_triangles);
+    }
+}
+
+TEST(TriangleMesh, SimplifyQuadricDecimation) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    sphere->ComputeVertexNormals();
+    const int target = int(sphere->triangles_.size()) / 8;
+
+    auto CheckSimplified = [&](const geometry::TriangleMesh& mesh) {
+        EXPECT_LE(int(mesh.triangles_.size()), target);
+        EXPECT_GT(int(mesh.triangles_.size()), target / 2);
+        EXPECT_EQ(mesh.vertex_normals_.size(), mesh.vertices_.size());
+        EXPECT_TRUE(mesh.IsEdgeManifold());
+        for (const auto& tria : mesh.triangles_) {
+            for (int k = 0; k < 3; ++k) {
+                EXPECT_GE(tria(k), 0);
+                EXPECT_LT(tria(k), int(mesh.vertices_.size()));
+            }
+        }
+        for (const auto& vertex : mesh.vertices_) {
+            EXPECT_NEAR(vertex.norm(), 1.0, 0.05);
+        }
+    };
+
+    auto serial = sphere->SimplifyQuadricDecimation(
+            target, std::numeric_limits<double>::infinity(), 1.0);
+    CheckSimplified(*serial);
+
+    auto parallel = sphere->SimplifyQuadricDecimationParallel(
+            target, std::numeric_limits<double>::infinity(), 1.0);
+    CheckSimplified(*parallel);
+    ExpectMeshEQ(*parallel,
+                 *sphere->SimplifyQuadricDecimationParallel(
+                         target, std::numeric_limits<double>::infinity(), 1.0));
+
+    // No edge is cheap enough to be collapsed
+    auto unchanged =
+            sphere->SimplifyQuadricDecimationParallel(target, 0.0, 1.0);
+    EXPECT_EQ(unchanged->triangles_.size(), sphere->triangles_.size());
+
+    // Collapses of a closed mesh eventually flip triangles, which must not
+    // stall the decimation
+    auto tiny = sphere->SimplifyQuadricDecimationParallel(
+            4, std::numeric_limits<double>::infinity(), 1.0);
+    EXPECT_LT(tiny->triangles_.size(), size_t(target));
+    EXPECT_GE(tiny->triangles_.size(), 4u);
+}
+
 TEST(TriangleMesh, ClusterConnectedTriangles) {
     // Test 1
 
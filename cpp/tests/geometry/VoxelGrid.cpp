@@ -26,7 +26,10 @@
 
 #include "open3d/geometry/VoxelGrid.h"
 
+#include "open3d/camera/PinholeCameraParameters.h"
+#include "open3d/geometry/Image.h"
 #include "open3d/geometry/LineSet.h"
+#include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 #include "tests/UnitTest.h"
@@ -62,6 +65,122 @@ TEST(VoxelGrid, GetVoxel) {
              Eigen::Vector3i(0, 1, 0));
 }
 
+TEST(VoxelGrid, CheckIfIncluded) {
+    geometry::VoxelGrid voxel_grid;
+    voxel_grid.origin_ = Eigen::Vector3d(-1, 2, 0.5);
+    voxel_grid.voxel_size_ = 0.25;
+    std::vector<Eigen::Vector3i> grid_indices(1000);
+    Rand(grid_indices, Eigen::Vector3i(-10, -10, -10),
+         Eigen::Vector3i(10, 10, 10), 0);
+    for (const Eigen::Vector3i& grid_index : grid_indices) {
+        voxel_grid.AddVoxel(geometry::Voxel(
+                grid_index, grid_index.cast<double>() / 10.0));
+    }
+    std::vector<Eigen::Vector3d> queries(5000);
+    Rand(queries, Eigen::Vector3d(-4, -1, -2.5), Eigen::Vector3d(2, 5, 3.5), 1);
+
+    std::vector<bool> ref(queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        ref[i] = voxel_grid.voxels_.count(voxel_grid.GetVoxel(queries[i])) > 0;
+    }
+    // Large batches go through FlatVoxelGrid, small ones through the map
+    EXPECT_EQ(voxel_grid.CheckIfIncluded(queries), ref);
+    std::vector<Eigen::Vector3d> few_queries(queries.begin(),
+                                             queries.begin() + 100);
+    EXPECT_EQ(voxel_grid.CheckIfIncluded(few_queries),
+              std::vector<bool>(ref.begin(), ref.begin() + 100));
+
+    geometry::FlatVoxelGrid flat_voxel_grid(voxel_grid);
+    EXPECT_EQ(flat_voxel_grid.Size(), voxel_grid.voxels_.size());
+    EXPECT_EQ(flat_voxel_grid.CheckIfIncluded(queries), ref);
+    std::vector<int64_t> indices = flat_voxel_grid.FindVoxels(queries);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        if (indices[i] < 0) continue;
+        Eigen::Vector3i grid_index = voxel_grid.GetVoxel(queries[i]);
+        ExpectEQ(flat_voxel_grid.grid_indices_[indices[i]], grid_index);
+        ExpectEQ(flat_voxel_grid.GetColor(indices[i]),
+                 voxel_grid.voxels_.at(grid_index).color_);
+    }
+    EXPECT_EQ(flat_voxel_grid.Find(Eigen::Vector3i(11, 0, 0)), -1);
+
+    auto voxel_grid_copy = flat_voxel_grid.ToVoxelGrid();
+    EXPECT_EQ(voxel_grid_copy->voxels_.size(), voxel_grid.voxels_.size());
+    for (const auto& it : voxel_grid.voxels_) {
+        ExpectEQ(voxel_grid_copy->voxels_.at(it.first).color_,
+                 it.second.color_);
+    }
+}
+
+TEST(VoxelGrid, CreateFromPointCloudAverageColor) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(10000);
+    pcd.colors_.resize(10000);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1),
+         0);
+    Rand(pcd.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 1);
+    double voxel_size = 0.1;
+    auto voxel_grid =
+            geometry::VoxelGrid::CreateFromPointCloud(pcd, voxel_size);
+
+    std::unordered_map<Eigen::Vector3i, geometry::AvgColorVoxel,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            ref;
+    for (size_t i = 0; i < pcd.points_.size(); ++i) {
+        Eigen::Vector3i voxel_index = voxel_grid->GetVoxel(pcd.points_[i]);
+        ref[voxel_index].Add(voxel_index, pcd.colors_[i]);
+    }
+    EXPECT_EQ(voxel_grid->voxels_.size(), ref.size());
+    for (const auto& it : ref) {
+        ASSERT_EQ(voxel_grid->voxels_.count(it.first), 1u);
+        EXPECT_EQ(voxel_grid->voxels_.at(it.first).color_,
+                  it.second.GetAverageColor());
+    }
+}
+
+TEST(VoxelGrid, CarveSilhouette) {
+    auto voxel_grid = geometry::VoxelGrid::CreateDense(
+            Eigen::Vector3d(-1, -1, 2), Eigen::Vector3d(0, 0, 0), 0.1, 2, 2,
+            2);
+    size_t num_voxels = voxel_grid->voxels_.size();
+
+    // Camera at the origin looking along +z; only the left half of the mask
+    // is set.
+    camera::PinholeCameraParameters camera;
+    camera.intrinsic_.SetIntrinsics(64, 64, 32, 32, 31.5, 31.5);
+    camera.extrinsic_ = Eigen::Matrix4d::Identity();
+    geometry::Image mask;
+    mask.Prepare(64, 64, 1, 4);
+    for (int v = 0; v < 64; ++v) {
+        for (int u = 0; u < 32; ++u) {
+            *mask.PointerAt<float>(u, v) = 1.0f;
+        }
+    }
+
+    std::vector<Eigen::Vector3i> expected_kept;
+    for (const auto& it : voxel_grid->voxels_) {
+        for (const Eigen::Vector3d& x :
+             voxel_grid->GetVoxelBoundingPoints(it.first)) {
+            double u = 32 * x(0) / x(2) + 31.5;
+            double v = 32 * x(1) / x(2) + 31.5;
+            bool within_boundary;
+            double d;
+            std::tie(within_boundary, d) = mask.FloatValueAt(u, v);
+            if (within_boundary && d > 0) {
+                expected_kept.push_back(it.first);
+                break;
+            }
+        }
+    }
+    ASSERT_GT(expected_kept.size(), 0u);
+    ASSERT_LT(expected_kept.size(), num_voxels);
+
+    voxel_grid->CarveSilhouette(mask, camera, false);
+    EXPECT_EQ(voxel_grid->voxels_.size(), expected_kept.size());
+    for (const Eigen::Vector3i& grid_index : expected_kept) {
+        EXPECT_EQ(voxel_grid->voxels_.count(grid_index), 1u);
+    }
+}
+
 TEST(VoxelGrid, Visualization) {
     auto voxel_grid = std::make_shared<geometry::VoxelGrid>();
     voxel_grid->origin_ = Eigen::Vector3d(0, 0, 0);
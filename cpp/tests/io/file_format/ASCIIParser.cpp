@@ -0,0 +1,188 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/file_format/ASCIIParser.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+static double Strtod(const std::string &str) {
+    return std::strtod(str.c_str(), nullptr);
+}
+
+TEST(ASCIIParser, ParseASCIIDouble) {
+    for (const std::string str :
+         {"1", "-2.5", "3.14159", "1e10", "1.5E-3", "+7.", ".5", "-0", "0.1",
+          "123456789012345678901234", "0.1234567890123456789012",
+          "9007199254740993", "1e-320", "1.7976931348623157e308", "1e400",
+          "inf", "-Infinity", "0x1p3"}) {
+        SCOPED_TRACE(str);
+        double value = 0;
+        const char *end = str.data() + str.size();
+        EXPECT_EQ(io::ParseASCIIDouble(str.data(), end, value), end);
+        EXPECT_EQ(value, Strtod(str));
+        EXPECT_EQ(std::signbit(value), std::signbit(Strtod(str)));
+    }
+
+    double value = 0;
+    const std::string nan = "nan";
+    EXPECT_NE(io::ParseASCIIDouble(nan.data(), nan.data() + 3, value),
+              nullptr);
+    EXPECT_TRUE(std::isnan(value));
+
+    // Blanks are skipped, parsing stops after the number.
+    const std::string line = " \t1.25e2x 3";
+    EXPECT_EQ(io::ParseASCIIDouble(line.data(), line.data() + line.size(),
+                                   value),
+              line.data() + 8);
+    EXPECT_EQ(value, 125);
+    const std::string exponent = "2e+";
+    EXPECT_EQ(io::ParseASCIIDouble(exponent.data(), exponent.data() + 3,
+                                   value),
+              exponent.data() + 1);
+    EXPECT_EQ(value, 2);
+
+    // The end of the range is respected.
+    const std::string digits = "12345";
+    EXPECT_EQ(io::ParseASCIIDouble(digits.data(), digits.data() + 2, value),
+              digits.data() + 2);
+    EXPECT_EQ(value, 12);
+
+    for (const std::string str : {"", "  ", "abc", ",1", "-", "."}) {
+        SCOPED_TRACE(str);
+        EXPECT_EQ(io::ParseASCIIDouble(str.data(), str.data() + str.size(),
+                                       value),
+                  nullptr);
+    }
+
+    // Round trip of random numbers matches strtod exactly.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(-1000, 1000);
+    char buffer[64];
+    for (int i = 0; i < 100000; ++i) {
+        double x = uniform(rng);
+        int size = snprintf(buffer, sizeof(buffer), i % 2 ? "%.17g" : "%.6f",
+                            x);
+        ASSERT_NE(io::ParseASCIIDouble(buffer, buffer + size, value), nullptr);
+        ASSERT_EQ(value, std::strtod(buffer, nullptr)) << buffer;
+    }
+}
+
+TEST(ASCIIParser, ParseASCIIInt) {
+    const std::string line = " 42 -7 +3 12.5";
+    const char *end = line.data() + line.size();
+    int value = 0;
+    const char *p = line.data();
+    std::vector<int> values;
+    for (int i = 0; i < 4; ++i) {
+        p = io::ParseASCIIInt(p, end, value);
+        ASSERT_NE(p, nullptr);
+        values.push_back(value);
+    }
+    EXPECT_EQ(values, std::vector<int>({42, -7, 3, 12}));
+    EXPECT_EQ(io::ParseASCIIInt(p, end, value), nullptr);
+}
+
+TEST(ASCIIParser, ParseASCIILines) {
+    // Enough lines for several chunks, with invalid lines in between and no
+    // line break at the end.
+    std::string text;
+    std::vector<double> expected;
+    char buffer[128];
+    for (int i = 0; i < 400000; ++i) {
+        if (i % 1000 == 7) {
+            text += "# comment\n";
+            continue;
+        }
+        if (i % 1000 == 8) {
+            text += "\r\n";
+            continue;
+        }
+        double x = i * 0.5, y = -i * 0.25, z = i * 1e-3;
+        int size = snprintf(buffer, sizeof(buffer), "%.10f %.10f %.10f\r\n",
+                            x, y, z);
+        text.append(buffer, size);
+        // The values as parsed by sscanf are the reference.
+        double values[3];
+        sscanf(buffer, "%lf %lf %lf", &values[0], &values[1], &values[2]);
+        expected.insert(expected.end(), values, values + 3);
+    }
+    text += "1 2 3";
+    expected.insert(expected.end(), {1, 2, 3});
+
+    auto parse_line = [](const char *begin, const char *end, double *values) {
+        return io::ParseASCIIDoubles(begin, end, 3, values);
+    };
+    std::vector<std::vector<double>> records;
+    int64_t last_num_bytes = 0;
+    int num_updates = 0;
+    bool increasing = true;
+    EXPECT_TRUE(io::ParseASCIILines(
+            text.data(), text.data() + text.size(), 3, parse_line, records,
+            [&](int64_t num_bytes) {
+                increasing = increasing && num_bytes > last_num_bytes;
+                last_num_bytes = num_bytes;
+                ++num_updates;
+                return true;
+            }));
+    EXPECT_TRUE(increasing);
+    EXPECT_GE(num_updates, 300);
+    EXPECT_LE(last_num_bytes, static_cast<int64_t>(text.size()));
+    EXPECT_GT(records.size(), 1);
+    const int64_t num_records = io::CountASCIIRecords(records, 3);
+    ASSERT_EQ(num_records * 3, static_cast<int64_t>(expected.size()));
+
+    std::vector<double> values(expected.size());
+    io::StoreASCIIRecords(records, 3, [&](int64_t i, const double *record) {
+        std::memcpy(values.data() + 3 * i, record, 3 * sizeof(double));
+    });
+    EXPECT_EQ(values, expected);
+
+    // Cancelling stops all chunks after the first update.
+    num_updates = 0;
+    EXPECT_FALSE(io::ParseASCIILines(text.data(), text.data() + text.size(),
+                                     3, parse_line, records,
+                                     [&](int64_t) {
+                                         ++num_updates;
+                                         return false;
+                                     }));
+    EXPECT_EQ(num_updates, 1);
+    EXPECT_LT(io::CountASCIIRecords(records, 3) * 3,
+              static_cast<int64_t>(expected.size()));
+}
+
+}  // namespace tests
+}  // namespace open3d
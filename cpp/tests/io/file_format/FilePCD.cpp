@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -55,9 +57,59 @@ TEST(FilePCD, DISABLED_ConvertRGBToFloat) { NotImplemented(); }
 
 TEST(FilePCD, DISABLED_WritePCDData) { NotImplemented(); }
 
-TEST(FilePCD, DISABLED_ReadPointCloudFromPCD) { NotImplemented(); }
-
-TEST(FilePCD, DISABLED_WritePointCloudToPCD) { NotImplemented(); }
+// Values that are exactly representable in the float32 and uint8 storage of
+// PCD files, so that a write/read round trip is lossless.
+static geometry::PointCloud CreateTestPointCloud(int num_points) {
+    geometry::PointCloud pcd;
+    for (int i = 0; i < num_points; i++) {
+        pcd.points_.push_back({i * 0.25, -i * 0.5, 1.0 + i});
+        pcd.normals_.push_back({0.0, i % 2 ? 1.0 : -1.0, 0.0});
+        pcd.colors_.push_back(
+                {(i % 256) / 255.0, ((i * 7) % 256) / 255.0, 1.0});
+    }
+    return pcd;
+}
+
+TEST(FilePCD, WriteReadPointCloud) {
+    // More points than one binary block, so that blocked IO is exercised.
+    const geometry::PointCloud pcd_gt = CreateTestPointCloud(100000);
+    for (bool write_ascii : {true, false}) {
+        for (bool compressed : {false, true}) {
+            const std::string file_name = "tmp.pcd";
+            EXPECT_TRUE(io::WritePointCloud(
+                    file_name, pcd_gt, {write_ascii, compressed}));
+            geometry::PointCloud pcd;
+            EXPECT_TRUE(io::ReadPointCloud(file_name, pcd));
+            ExpectEQ(pcd.points_, pcd_gt.points_);
+            ExpectEQ(pcd.normals_, pcd_gt.normals_);
+            ExpectEQ(pcd.colors_, pcd_gt.colors_);
+        }
+    }
+}
+
+TEST(FilePCD, ReadSelectedFields) {
+    const geometry::PointCloud pcd_gt = CreateTestPointCloud(1000);
+    for (bool write_ascii : {true, false}) {
+        for (bool compressed : {false, true}) {
+            const std::string file_name = "tmp.pcd";
+            EXPECT_TRUE(io::WritePointCloud(
+                    file_name, pcd_gt, {write_ascii, compressed}));
+            io::ReadPointCloudOption option;
+            option.read_normals = false;
+            geometry::PointCloud pcd;
+            EXPECT_TRUE(io::ReadPointCloud(file_name, pcd, option));
+            ExpectEQ(pcd.points_, pcd_gt.points_);
+            EXPECT_FALSE(pcd.HasNormals());
+            ExpectEQ(pcd.colors_, pcd_gt.colors_);
+
+            option.read_colors = false;
+            EXPECT_TRUE(io::ReadPointCloud(file_name, pcd, option));
+            ExpectEQ(pcd.points_, pcd_gt.points_);
+            EXPECT_FALSE(pcd.HasNormals());
+            EXPECT_FALSE(pcd.HasColors());
+        }
+    }
+}
 
 }  // namespace tests
 }  // namespace open3d
@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/Feature.h"
+
+#include "open3d/geometry/PointCloud.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -35,7 +38,36 @@ TEST(Feature, DISABLED_Dimension) { NotImplemented(); }
 
 TEST(Feature, DISABLED_Num) { NotImplemented(); }
 
-TEST(Feature, DISABLED_ComputeFPFHFeature) { NotImplemented(); }
+TEST(Feature, ComputeFPFHFeature) {
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 500; ++i) {
+        Eigen::Vector3d p = Eigen::Vector3d::Random().normalized();
+        pcd.points_.push_back(p);
+        pcd.normals_.push_back(p);
+    }
+    geometry::KDTreeSearchParamHybrid param(0.3, 30);
+
+    auto feature = pipelines::registration::ComputeFPFHFeature(pcd, param);
+    EXPECT_EQ(feature->Dimension(), 33);
+    EXPECT_EQ(feature->Num(), 500);
+    // Each of the three angle histograms of a point with neighbors sums to
+    // 100 in both the SPFH and the weighted FPFH.
+    for (int i = 0; i < 500; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            double sum = feature->data_.block<11, 1>(k * 11, i).sum();
+            EXPECT_NEAR(sum, 200.0, 1e-3);
+        }
+    }
+
+    std::vector<size_t> indices = {3, 499, 42, 3, 0};
+    auto subset = pipelines::registration::ComputeFPFHFeature(pcd, param,
+                                                              indices);
+    EXPECT_EQ(subset->Num(), 5);
+    for (size_t k = 0; k < indices.size(); ++k) {
+        ExpectEQ(subset->data_.col(k).eval(),
+                 feature->data_.col(indices[k]).eval());
+    }
+}
 
 TEST(Feature, DISABLED_KDTreeSearchParamKNN) { NotImplemented(); }
 
@@ -24,6 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/GlobalOptimization.h"
+
+#include <Eigen/Dense>
+
+#include "open3d/pipelines/registration/GlobalOptimizationConvergenceCriteria.h"
+#include "open3d/pipelines/registration/GlobalOptimizationMethod.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/utility/Eigen.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -33,8 +41,71 @@ TEST(GlobalOptimization, DISABLED_Constructor) { NotImplemented(); }
 
 TEST(GlobalOptimization, DISABLED_MemberData) { NotImplemented(); }
 
-TEST(GlobalOptimization, DISABLED_GlobalOptimizationLevenbergMarquardt) {
-    NotImplemented();
+// A loop of nodes with exact odometry and loop closure edges. All nodes but
+// the reference node start from perturbed poses.
+static std::tuple<pipelines::registration::PoseGraph,
+                  std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>>
+CreateLoopPoseGraph(int n_nodes) {
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses_gt;
+    pipelines::registration::PoseGraph pose_graph;
+    for (int i = 0; i < n_nodes; i++) {
+        const double angle = 2.0 * M_PI * i / n_nodes;
+        Eigen::Vector6d pose_vector;
+        pose_vector << 0.1 * std::sin(angle), 0.05, angle, std::cos(angle),
+                std::sin(angle), 0.01 * i;
+        poses_gt.push_back(utility::TransformVector6dToMatrix4d(pose_vector));
+        Eigen::Vector6d noise = Eigen::Vector6d::Zero();
+        if (i > 0) {
+            noise << 0.02, -0.01, 0.03, 0.05, -0.04, 0.02;
+            noise *= std::cos(3.0 * i);
+        }
+        pose_graph.nodes_.emplace_back(
+                utility::TransformVector6dToMatrix4d(noise) * poses_gt[i]);
+    }
+    const Eigen::Matrix6d information = Eigen::Matrix6d::Identity() * 1000.0;
+    auto add_edge = [&](int s, int t, bool uncertain) {
+        Eigen::Matrix4d transformation = poses_gt[t].inverse() * poses_gt[s];
+        pose_graph.edges_.emplace_back(s, t, transformation, information,
+                                       uncertain);
+    };
+    for (int i = 0; i + 1 < n_nodes; i++) {
+        add_edge(i, i + 1, false);
+    }
+    for (int i = 0; i + 5 < n_nodes; i += 3) {
+        add_edge(i, i + 5, true);
+    }
+    add_edge(0, n_nodes - 1, true);
+    return std::make_tuple(pose_graph, poses_gt);
+}
+
+TEST(GlobalOptimization, GlobalOptimizationMethods) {
+    const int n_nodes = 40;
+    pipelines::registration::GlobalOptimizationOption option;
+    option.reference_node_ = 0;
+    const pipelines::registration::GlobalOptimizationLevenbergMarquardt lm;
+    const pipelines::registration::GlobalOptimizationGaussNewton gn;
+    for (const pipelines::registration::GlobalOptimizationMethod *method :
+         std::vector<const pipelines::registration::GlobalOptimizationMethod
+                             *>{&lm, &gn}) {
+        pipelines::registration::PoseGraph pose_graph;
+        std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses_gt;
+        std::tie(pose_graph, poses_gt) = CreateLoopPoseGraph(n_nodes);
+        const size_t n_edges = pose_graph.edges_.size();
+
+        pipelines::registration::GlobalOptimization(
+                pose_graph, *method,
+                pipelines::registration::
+                        GlobalOptimizationConvergenceCriteria(),
+                option);
+
+        // All edges are consistent, so none of them is pruned.
+        EXPECT_EQ(pose_graph.edges_.size(), n_edges);
+        ASSERT_EQ(pose_graph.nodes_.size(), (size_t)n_nodes);
+        for (int i = 0; i < n_nodes; i++) {
+            ExpectEQ(Eigen::Matrix4d(pose_graph.nodes_[i].pose_), poses_gt[i],
+                     1e-4);
+        }
+    }
 }
 
 TEST(GlobalOptimization, DISABLED_GlobalOptimizationConvergenceCriteria) {
@@ -24,6 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/Registration.h"
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/Feature.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -53,8 +57,46 @@ TEST(Registration, DISABLED_RegistrationRANSACBasedOnCorrespondence) {
     NotImplemented();
 }
 
-TEST(Registration, DISABLED_RegistrationRANSACBasedOnFeatureMatching) {
-    NotImplemented();
+TEST(Registration, RegistrationRANSACBasedOnFeatureMatching) {
+    // The first 300 source points are matched to their transformed copies by
+    // identical features, the remaining 200 target points are outliers.
+    const int num_matches = 300;
+    const int num_outliers = 200;
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.5, Eigen::Vector3d(1, 2, 3).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.3, -0.2, 1.0);
+
+    geometry::PointCloud source;
+    geometry::PointCloud target;
+    pipelines::registration::Feature source_feature;
+    pipelines::registration::Feature target_feature;
+    source_feature.Resize(8, num_matches);
+    target_feature.Resize(8, num_matches + num_outliers);
+    for (int i = 0; i < num_matches; ++i) {
+        source.points_.push_back(Eigen::Vector3d::Random());
+        target.points_.push_back(
+                (transformation * source.points_[i].homogeneous()).head<3>());
+        source_feature.data_.col(i) = Eigen::VectorXd::Random(8);
+        target_feature.data_.col(i) = source_feature.data_.col(i);
+    }
+    for (int i = num_matches; i < num_matches + num_outliers; ++i) {
+        target.points_.push_back(Eigen::Vector3d::Random());
+        target_feature.data_.col(i) = Eigen::VectorXd::Random(8) * 10;
+    }
+
+    for (bool mutual_filter : {false, true}) {
+        auto result = pipelines::registration::
+                RegistrationRANSACBasedOnFeatureMatching(
+                        source, target, source_feature, target_feature,
+                        mutual_filter, 0.01);
+        EXPECT_DOUBLE_EQ(result.fitness_, 1.0);
+        EXPECT_EQ(int(result.correspondence_set_.size()), num_matches);
+        EXPECT_NEAR(result.inlier_rmse_, 0.0, 1e-8);
+        ExpectEQ(Eigen::Matrix4d(result.transformation_), transformation,
+                 1e-8);
+    }
 }
 
 TEST(Registration, DISABLED_GetInformationMatrixFromPointClouds) {
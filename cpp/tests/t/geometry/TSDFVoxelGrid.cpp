@@ -34,6 +34,7 @@
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/pipelines/registration/Registration.h"
 #include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 #include "tests/UnitTest.h"
 
@@ -53,6 +54,7 @@ TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     for (auto backend : backends) {
@@ -115,6 +117,91 @@ TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
     }
 }
 
+TEST_P(TSDFVoxelGridPermuteDevices, Streaming) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.008;
+    std::unordered_map<std::string, core::Dtype> attr_dtype_map{
+            {"tsdf", core::Dtype::Float32},
+            {"weight", core::Dtype::UInt16},
+            {"color", core::Dtype::UInt16}};
+    t::geometry::TSDFVoxelGrid voxel_grid(attr_dtype_map, voxel_size, 0.04f,
+                                          16, 1000, device);
+    t::geometry::TSDFVoxelGrid voxel_grid_streaming(
+            attr_dtype_map, voxel_size, 0.04f, 16, 1000, device);
+
+    // Each frame observes a bit more than 1000 blocks.
+    const int64_t max_resident_blocks = 1050;
+    std::string store_path =
+            std::string(TEST_DATA_DIR) + "/test_tsdf_block_store.bin";
+    voxel_grid_streaming.EnableStreaming(store_path, max_resident_blocks);
+    EXPECT_TRUE(voxel_grid_streaming.IsStreamingEnabled());
+
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    auto trajectory = io::CreatePinholeCameraTrajectoryFromFile(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log");
+
+    // Go back to the first frame in the end to page evicted blocks back in.
+    std::vector<size_t> frames(trajectory->parameters_.size());
+    std::iota(frames.begin(), frames.end(), 0);
+    frames.push_back(0);
+    for (size_t i : frames) {
+        t::geometry::Image depth =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/depth/{:05d}.png",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+        t::geometry::Image color =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+        core::Tensor extrinsic_t = core::eigen_converter::EigenMatrixToTensor(
+                trajectory->parameters_[i].extrinsic_);
+
+        voxel_grid.Integrate(depth, color, intrinsic_t, extrinsic_t);
+        voxel_grid_streaming.Integrate(depth, color, intrinsic_t, extrinsic_t);
+
+        auto stats = voxel_grid_streaming.GetStreamingStatistics();
+        EXPECT_LE(stats.num_resident_blocks_, max_resident_blocks);
+        EXPECT_EQ(stats.num_resident_blocks_ + stats.num_evicted_blocks_,
+                  voxel_grid.GetBlockHashmap()->Size());
+    }
+
+    auto stats = voxel_grid_streaming.GetStreamingStatistics();
+    EXPECT_GT(stats.num_evicted_blocks_, 0);
+    EXPECT_GT(stats.num_blocks_paged_in_, 0);
+    EXPECT_EQ(stats.num_blocks_paged_out_ - stats.num_blocks_paged_in_,
+              stats.num_evicted_blocks_);
+    EXPECT_EQ(stats.resident_bytes_ + stats.evicted_bytes_,
+              voxel_grid.GetBlockHashmap()->Size() *
+                      voxel_grid.GetBlockHashmap()->GetValueBytesize());
+
+    // With all blocks paged back in, the map matches the one built in memory.
+    voxel_grid_streaming.DisableStreaming();
+    EXPECT_FALSE(voxel_grid_streaming.IsStreamingEnabled());
+    EXPECT_FALSE(utility::filesystem::FileExists(store_path));
+    EXPECT_EQ(voxel_grid_streaming.GetBlockHashmap()->Size(),
+              voxel_grid.GetBlockHashmap()->Size());
+
+    auto pcd = voxel_grid.ExtractSurfacePoints().ToLegacyPointCloud();
+    auto pcd_streaming =
+            voxel_grid_streaming.ExtractSurfacePoints().ToLegacyPointCloud();
+    EXPECT_EQ(pcd.points_.size(), pcd_streaming.points_.size());
+    auto result = pipelines::registration::EvaluateRegistration(
+            pcd, pcd_streaming, voxel_size);
+    EXPECT_NEAR(result.fitness_, 1.0, 1e-5);
+    EXPECT_NEAR(result.inlier_rmse_, 0, 1e-5);
+}
+
 TEST_P(TSDFVoxelGridPermuteDevices, DISABLED_Raycast) {
     core::Device device = GetParam();
     std::vector<core::HashmapBackend> backends;
@@ -123,6 +210,7 @@ TEST_P(TSDFVoxelGridPermuteDevices, DISABLED_Raycast) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     for (auto backend : backends) {
@@ -0,0 +1,229 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PLYChunkReader.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+template <typename T>
+static void AppendValue(std::string &out, T value, bool big_endian = false) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    if (big_endian) {
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    out.append(bytes, sizeof(T));
+}
+
+static void WriteFile(const std::string &filename, const std::string &data) {
+    std::ofstream(filename, std::ios::binary).write(data.data(), data.size());
+}
+
+TEST(PLYChunkReader, ReadChunks) {
+    const std::string filename = "test_chunk_reader.ply";
+    const int64_t num_points = 10000;
+
+    // A fixed-size element before the vertices and a list element after.
+    std::string data =
+            "ply\n"
+            "format binary_little_endian 1.0\n"
+            "comment test\n"
+            "element camera 1\n"
+            "property float view_x\n"
+            "property uchar id\n"
+            "element vertex 10000\n"
+            "property float x\n"
+            "property float y\n"
+            "property float z\n"
+            "property uchar red\n"
+            "property uchar green\n"
+            "property uchar blue\n"
+            "property double intensity\n"
+            "element face 1\n"
+            "property list uchar int vertex_indices\n"
+            "end_header\n";
+    AppendValue<float>(data, 1.5f);
+    AppendValue<uint8_t>(data, 7);
+    std::vector<float> points;
+    std::vector<uint8_t> colors;
+    std::vector<double> intensities;
+    for (int64_t i = 0; i < num_points; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            points.push_back(static_cast<float>(i * 3 + j) * 0.25f);
+            AppendValue<float>(data, points.back());
+        }
+        for (int j = 0; j < 3; ++j) {
+            colors.push_back(static_cast<uint8_t>(i * 10 + j));
+            AppendValue<uint8_t>(data, colors.back());
+        }
+        intensities.push_back(static_cast<double>(i) / 3.0);
+        AppendValue<double>(data, intensities.back());
+    }
+    AppendValue<uint8_t>(data, 3);
+    for (int32_t i = 0; i < 3; ++i) {
+        AppendValue<int32_t>(data, i);
+    }
+    WriteFile(filename, data);
+
+    t::io::PLYChunkReader reader;
+    ASSERT_TRUE(reader.Open(filename, 6000));
+    EXPECT_EQ(reader.GetNumPoints(), num_points);
+
+    std::vector<int64_t> chunk_lengths;
+    std::vector<float> read_points;
+    std::vector<uint8_t> read_colors;
+    std::vector<double> read_intensities;
+    while (!reader.IsEOF()) {
+        t::geometry::PointCloud chunk = reader.NextChunk();
+        chunk_lengths.push_back(chunk.GetPoints().GetLength());
+        EXPECT_EQ(chunk.GetPointAttr("intensity").GetShape(),
+                  core::SizeVector({chunk_lengths.back(), 1}));
+        EXPECT_FALSE(chunk.HasPointAttr("x"));
+        EXPECT_FALSE(chunk.HasPointAttr("view_x"));
+        for (float v : chunk.GetPoints().ToFlatVector<float>()) {
+            read_points.push_back(v);
+        }
+        for (uint8_t v : chunk.GetPointColors().ToFlatVector<uint8_t>()) {
+            read_colors.push_back(v);
+        }
+        for (double v :
+             chunk.GetPointAttr("intensity").ToFlatVector<double>()) {
+            read_intensities.push_back(v);
+        }
+    }
+    EXPECT_EQ(chunk_lengths, std::vector<int64_t>({6000, 4000}));
+    EXPECT_EQ(reader.GetNumPointsRead(), num_points);
+    EXPECT_TRUE(reader.NextChunk().IsEmpty());
+    EXPECT_EQ(read_points, points);
+    EXPECT_EQ(read_colors, colors);
+    EXPECT_EQ(read_intensities, intensities);
+
+    std::remove(filename.c_str());
+}
+
+TEST(PLYChunkReader, BigEndian) {
+    const std::string filename = "test_chunk_reader_be.ply";
+    std::string data =
+            "ply\n"
+            "format binary_big_endian 1.0\n"
+            "element vertex 3\n"
+            "property double x\n"
+            "property double y\n"
+            "property double z\n"
+            "property short label\n"
+            "end_header\n";
+    std::vector<double> points;
+    std::vector<int16_t> labels;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            points.push_back(-1.0 - i * 3 - j);
+            AppendValue<double>(data, points.back(), true);
+        }
+        labels.push_back(static_cast<int16_t>(-300 * i));
+        AppendValue<int16_t>(data, labels.back(), true);
+    }
+    WriteFile(filename, data);
+
+    t::io::PLYChunkReader reader;
+    ASSERT_TRUE(reader.Open(filename));
+    t::geometry::PointCloud chunk = reader.NextChunk();
+    EXPECT_TRUE(reader.IsEOF());
+    EXPECT_EQ(chunk.GetPoints().GetShape(), core::SizeVector({3, 3}));
+    EXPECT_EQ(chunk.GetPoints().ToFlatVector<double>(), points);
+    EXPECT_EQ(chunk.GetPointAttr("label").GetShape(), core::SizeVector({3, 1}));
+    EXPECT_EQ(chunk.GetPointAttr("label").ToFlatVector<int16_t>(), labels);
+
+    std::remove(filename.c_str());
+}
+
+TEST(PLYChunkReader, Unsupported) {
+    const std::string filename = "test_chunk_reader_unsupported.ply";
+    t::io::PLYChunkReader reader;
+
+    EXPECT_FALSE(reader.Open(filename + ".missing"));
+
+    WriteFile(filename,
+              "ply\n"
+              "format ascii 1.0\n"
+              "element vertex 1\n"
+              "property float x\n"
+              "end_header\n"
+              "1.0\n");
+    EXPECT_FALSE(reader.Open(filename));
+    EXPECT_FALSE(reader.IsOpened());
+
+    WriteFile(filename,
+              "ply\n"
+              "format binary_little_endian 1.0\n"
+              "element vertex 1\n"
+              "property list uchar float x\n"
+              "end_header\n");
+    EXPECT_FALSE(reader.Open(filename));
+
+    std::remove(filename.c_str());
+}
+
+// Chunks of a real scan concatenate to the same cloud as ReadPointCloud().
+TEST(PLYChunkReader, MatchesReadPointCloud) {
+    const std::string filename = std::string(TEST_DATA_DIR) + "/fragment.ply";
+    t::geometry::PointCloud pcd;
+    ASSERT_TRUE(t::io::ReadPointCloud(filename, pcd,
+                                      {"auto", false, false, false}));
+
+    t::io::PLYChunkReader reader;
+    ASSERT_TRUE(reader.Open(filename, 50000));
+    EXPECT_EQ(reader.GetNumPoints(), pcd.GetPoints().GetLength());
+    int64_t offset = 0;
+    while (!reader.IsEOF()) {
+        t::geometry::PointCloud chunk = reader.NextChunk();
+        int64_t length = chunk.GetPoints().GetLength();
+        for (const std::string key :
+             {"points", "normals", "colors", "curvature"}) {
+            SCOPED_TRACE(key);
+            EXPECT_TRUE(chunk.GetPointAttr(key).AllClose(
+                    pcd.GetPointAttr(key).Slice(0, offset, offset + length),
+                    0, 0));
+        }
+        offset += length;
+    }
+    EXPECT_EQ(offset, pcd.GetPoints().GetLength());
+}
+
+}  // namespace tests
+}  // namespace open3d
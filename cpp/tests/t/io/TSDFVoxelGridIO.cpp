@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/TSDFVoxelGridIO.h"
+
+#include "core/CoreTest.h"
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/t/io/ImageIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class TSDFVoxelGridIOPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TSDFVoxelGridIO,
+                         TSDFVoxelGridIOPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(TSDFVoxelGridIOPermuteDevices, ReadWriteTSDFVoxelGrid) {
+    core::Device device = GetParam();
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          0.008f, 0.04f, 16, 1000, device);
+
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    auto trajectory = io::CreatePinholeCameraTrajectoryFromFile(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log");
+    core::Tensor extrinsic_t;
+    for (size_t i = 0; i < 3; ++i) {
+        t::geometry::Image depth =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/depth/{:05d}.png",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+        t::geometry::Image color =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+        extrinsic_t = core::eigen_converter::EigenMatrixToTensor(
+                trajectory->parameters_[i].extrinsic_);
+        voxel_grid.Integrate(depth, color, intrinsic_t, extrinsic_t);
+    }
+
+    std::string file_name =
+            std::string(TEST_DATA_DIR) + "/test_tsdf_voxel_grid.bin";
+    EXPECT_TRUE(t::io::WriteTSDFVoxelGrid(file_name, voxel_grid));
+
+    t::geometry::TSDFVoxelGrid voxel_grid_read;
+    EXPECT_TRUE(t::io::ReadTSDFVoxelGrid(file_name, voxel_grid_read, device));
+    std::remove(file_name.c_str());
+
+    EXPECT_EQ(voxel_grid_read.GetDevice(), device);
+    EXPECT_EQ(voxel_grid_read.GetVoxelSize(), voxel_grid.GetVoxelSize());
+    EXPECT_EQ(voxel_grid_read.GetSDFTrunc(), voxel_grid.GetSDFTrunc());
+    EXPECT_EQ(voxel_grid_read.GetBlockResolution(),
+              voxel_grid.GetBlockResolution());
+    EXPECT_EQ(voxel_grid_read.GetAttrDtypeMap(), voxel_grid.GetAttrDtypeMap());
+
+    // Every block is restored with identical voxels.
+    std::shared_ptr<core::Hashmap> hashmap = voxel_grid.GetBlockHashmap();
+    std::shared_ptr<core::Hashmap> hashmap_read =
+            voxel_grid_read.GetBlockHashmap();
+    ASSERT_EQ(hashmap_read->Size(), hashmap->Size());
+    core::Tensor addrs, addrs_read, masks_read;
+    hashmap->GetActiveIndices(addrs);
+    addrs = addrs.To(core::Dtype::Int64);
+    hashmap_read->Find(hashmap->GetKeyTensor().IndexGet({addrs}), addrs_read,
+                       masks_read);
+    EXPECT_TRUE(masks_read.All());
+    // Gathers the blocks as rows of bytes.
+    auto get_block_bytes = [](const core::Hashmap &hashmap,
+                              const core::Tensor &addrs) {
+        core::Tensor values = hashmap.GetValueBuffer()
+                                      .IndexGet({addrs.To(core::Dtype::Int64)})
+                                      .To(core::Device("CPU:0"));
+        core::SizeVector shape{values.GetLength(),
+                               hashmap.GetValueBytesize()};
+        return core::Tensor(shape, core::shape_util::DefaultStrides(shape),
+                            values.GetDataPtr(), core::Dtype::UInt8,
+                            values.GetBlob());
+    };
+    EXPECT_TRUE(get_block_bytes(*hashmap, addrs)
+                        .Eq(get_block_bytes(*hashmap_read, addrs_read))
+                        .All());
+
+    EXPECT_EQ(voxel_grid_read.ExtractSurfaceMesh().GetVertices().GetLength(),
+              voxel_grid.ExtractSurfaceMesh().GetVertices().GetLength());
+
+    // Ray casting works without integrating into the grid read from file.
+    using MaskCode = t::geometry::TSDFVoxelGrid::SurfaceMaskCode;
+    auto result = voxel_grid_read.RayCast(intrinsic_t, extrinsic_t, 640, 480,
+                                          1000.0f, 0.1f, 3.0f, 0.0f,
+                                          MaskCode::DepthMap);
+    int64_t num_valid = result[MaskCode::DepthMap]
+                                .Gt(0)
+                                .To(core::Dtype::Int64)
+                                .Sum({0, 1, 2})
+                                .Item<int64_t>();
+    EXPECT_GT(num_valid, 640 * 480 / 2);
+}
+
+TEST(TSDFVoxelGridIO, ReadInvalidFile) {
+    t::geometry::TSDFVoxelGrid voxel_grid;
+    EXPECT_FALSE(t::io::ReadTSDFVoxelGrid(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log", voxel_grid));
+    EXPECT_FALSE(t::io::ReadTSDFVoxelGrid(
+            std::string(TEST_DATA_DIR) + "/does_not_exist.bin", voxel_grid));
+}
+
+}  // namespace tests
+}  // namespace open3d
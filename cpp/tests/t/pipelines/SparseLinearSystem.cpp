@@ -0,0 +1,216 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/SparseLinearSystem.h"
+
+#include <random>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/FillInLinearSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+using t::pipelines::kernel::SparseLinearSystem;
+
+static core::Tensor RandomTensor(const core::SizeVector& shape,
+                                 float min_val,
+                                 float max_val,
+                                 std::mt19937& rng) {
+    std::uniform_real_distribution<float> dist(min_val, max_val);
+    std::vector<float> vals(shape.NumElements());
+    for (float& v : vals) {
+        v = dist(rng);
+    }
+    return core::Tensor(vals, shape, core::Dtype::Float32);
+}
+
+static core::Tensor RandomIndices(const core::SizeVector& shape,
+                                  int max_val,
+                                  std::mt19937& rng) {
+    std::uniform_int_distribution<int> dist(0, max_val - 1);
+    std::vector<int> vals(shape.NumElements());
+    for (int& v : vals) {
+        v = dist(rng);
+    }
+    return core::Tensor(vals, shape, core::Dtype::Int32);
+}
+
+static core::Tensor RandomUnitVectors(int64_t n, std::mt19937& rng) {
+    core::Tensor vs = RandomTensor({n, 3}, -1, 1, rng);
+    core::Tensor norms = (vs * vs).Sum({1}, true).Sqrt();
+    return (vs / norms).Contiguous();
+}
+
+static core::Tensor CSRToDense(const SparseLinearSystem& system) {
+    core::Tensor row_offsets, col_indices, values;
+    std::tie(row_offsets, col_indices, values) = system.GetAtACSR();
+
+    const int64_t n = system.GetNumVars();
+    std::vector<float> dense(n * n, 0);
+    const int64_t* row_offsets_ptr = row_offsets.GetDataPtr<int64_t>();
+    const int64_t* col_indices_ptr = col_indices.GetDataPtr<int64_t>();
+    const float* values_ptr = values.GetDataPtr<float>();
+    for (int64_t r = 0; r < n; ++r) {
+        for (int64_t k = row_offsets_ptr[r]; k < row_offsets_ptr[r + 1]; ++k) {
+            if (k > row_offsets_ptr[r]) {
+                EXPECT_LT(col_indices_ptr[k - 1], col_indices_ptr[k]);
+            }
+            dense[r * n + col_indices_ptr[k]] = values_ptr[k];
+        }
+    }
+    return core::Tensor(dense, {n, n}, core::Dtype::Float32);
+}
+
+TEST(SparseLinearSystem, SLACAlignmentTerm) {
+    const int n_frags = 3;
+    const int n_grids = 20;
+    const int64_t n_corres = 500;
+    const int64_t n_vars = 6 * n_frags + 3 * n_grids;
+    std::mt19937 rng(0);
+
+    core::Tensor Ti_Cps = RandomTensor({n_corres, 3}, -1, 1, rng);
+    core::Tensor Tj_Cqs =
+            Ti_Cps + RandomTensor({n_corres, 3}, -0.01, 0.01, rng);
+    core::Tensor Cnormal_ps = RandomUnitVectors(n_corres, rng);
+    core::Tensor Ri_Cnormal_ps = RandomUnitVectors(n_corres, rng);
+    core::Tensor RjT_Ri_Cnormal_ps = RandomUnitVectors(n_corres, rng);
+    // Duplicated grid indices exercise the merging of shared blocks.
+    core::Tensor cgrid_idx_ps = RandomIndices({n_corres, 8}, n_grids, rng);
+    core::Tensor cgrid_idx_qs = RandomIndices({n_corres, 8}, n_grids, rng);
+    core::Tensor cgrid_ratio_ps = RandomTensor({n_corres, 8}, 0, 0.25, rng);
+    core::Tensor cgrid_ratio_qs = RandomTensor({n_corres, 8}, 0, 0.25, rng);
+
+    for (int j : {1, 2}) {
+        core::Tensor AtA =
+                core::Tensor::Zeros({n_vars, n_vars}, core::Dtype::Float32);
+        core::Tensor Atb =
+                core::Tensor::Zeros({n_vars, 1}, core::Dtype::Float32);
+        core::Tensor residual = core::Tensor::Zeros({1}, core::Dtype::Float32);
+        t::pipelines::kernel::FillInSLACAlignmentTerm(
+                AtA, Atb, residual, Ti_Cps, Tj_Cqs, Cnormal_ps, Ri_Cnormal_ps,
+                RjT_Ri_Cnormal_ps, cgrid_idx_ps, cgrid_idx_qs, cgrid_ratio_ps,
+                cgrid_ratio_qs, 0, j, n_frags, 0.05);
+
+        SparseLinearSystem system(n_vars);
+        core::Tensor residual_sparse =
+                core::Tensor::Zeros({1}, core::Dtype::Float32);
+        t::pipelines::kernel::FillInSLACAlignmentTerm(
+                system, residual_sparse, Ti_Cps, Tj_Cqs, Cnormal_ps,
+                Ri_Cnormal_ps, RjT_Ri_Cnormal_ps, cgrid_idx_ps, cgrid_idx_qs,
+                cgrid_ratio_ps, cgrid_ratio_qs, 0, j, n_frags, 0.05);
+
+        EXPECT_GT(system.GetNumStoredBlocks(), 0);
+        EXPECT_TRUE(CSRToDense(system).AllClose(AtA, 1e-4, 1e-5));
+        EXPECT_TRUE(system.GetAtb().AllClose(Atb, 1e-4, 1e-5));
+        EXPECT_NEAR(residual_sparse[0].Item<float>(),
+                    residual[0].Item<float>(),
+                    1e-4 * residual[0].Item<float>());
+    }
+}
+
+TEST(SparseLinearSystem, SLACRegularizerTerm) {
+    const int n_frags = 2;
+    const int n_grids = 50;
+    const int64_t n_vars = 6 * n_frags + 3 * n_grids;
+    std::mt19937 rng(1);
+
+    core::Tensor grid_idx =
+            core::Tensor::Arange(0, n_grids, 1, core::Dtype::Int32);
+    core::Tensor grid_nbs_idx = RandomIndices({n_grids, 6}, n_grids, rng);
+    std::vector<uint8_t> mask(n_grids * 6);
+    std::bernoulli_distribution coin(0.8);
+    for (int k = 0; k < n_grids * 6; ++k) {
+        // Self loops carry no regularization.
+        mask[k] = coin(rng) &&
+                  grid_nbs_idx[k / 6][k % 6].Item<int>() != k / 6;
+    }
+    core::Tensor grid_nbs_mask =
+            core::Tensor(mask, {n_grids, 6}, core::Dtype::UInt8)
+                    .To(core::Dtype::Bool);
+    core::Tensor positions_init = RandomTensor({n_grids, 3}, -1, 1, rng);
+    core::Tensor positions_curr =
+            positions_init + RandomTensor({n_grids, 3}, -0.05, 0.05, rng);
+
+    core::Tensor AtA =
+            core::Tensor::Zeros({n_vars, n_vars}, core::Dtype::Float32);
+    core::Tensor Atb = core::Tensor::Zeros({n_vars, 1}, core::Dtype::Float32);
+    core::Tensor residual = core::Tensor::Zeros({1}, core::Dtype::Float32);
+    t::pipelines::kernel::FillInSLACRegularizerTerm(
+            AtA, Atb, residual, grid_idx, grid_nbs_idx, grid_nbs_mask,
+            positions_init, positions_curr, 2.0, n_frags, 0);
+
+    SparseLinearSystem system(n_vars);
+    core::Tensor residual_sparse =
+            core::Tensor::Zeros({1}, core::Dtype::Float32);
+    t::pipelines::kernel::FillInSLACRegularizerTerm(
+            system, residual_sparse, grid_idx, grid_nbs_idx, grid_nbs_mask,
+            positions_init, positions_curr, 2.0, n_frags, 0);
+
+    EXPECT_TRUE(CSRToDense(system).AllClose(AtA, 1e-4, 1e-5));
+    EXPECT_TRUE(system.GetAtb().AllClose(Atb, 1e-4, 1e-5));
+    EXPECT_NEAR(residual_sparse[0].Item<float>(), residual[0].Item<float>(),
+                1e-4 * residual[0].Item<float>());
+}
+
+TEST(SparseLinearSystem, Solve) {
+    const int64_t n_blocks = 200;
+    const int64_t n_vars = 3 * n_blocks;
+    std::mt19937 rng(2);
+
+    // A chain of blocks, made diagonally dominant to be positive definite.
+    SparseLinearSystem system(n_vars);
+    SparseLinearSystem::BlockMap blocks;
+    std::uniform_real_distribution<double> dist(-1, 1);
+    for (int64_t b = 0; b + 1 < n_blocks; ++b) {
+        auto& block = blocks[b * n_blocks + b + 1];
+        for (double& v : block) {
+            v = dist(rng);
+        }
+    }
+    system.AddBlocks(blocks);
+    system.AddDiagonal(0, n_vars, 10.0);
+    EXPECT_EQ(system.GetNumStoredBlocks(), 2 * n_blocks - 1);
+
+    core::Tensor A = CSRToDense(system);
+    EXPECT_TRUE(A.AllClose(A.T()));
+    core::Tensor b = RandomTensor({n_vars, 1}, -1, 1, rng);
+
+    core::Tensor x_pcg = system.SolvePCG(b, 1000, 1e-8);
+    core::Tensor x_chol = system.SolveCholesky(b);
+    EXPECT_EQ(x_pcg.GetShape(), b.GetShape());
+    EXPECT_TRUE(A.Matmul(x_pcg).AllClose(b, 1e-4, 1e-4));
+    EXPECT_TRUE(A.Matmul(x_chol).AllClose(b, 1e-4, 1e-4));
+    EXPECT_TRUE(x_pcg.AllClose(x_chol, 1e-4, 1e-4));
+
+    EXPECT_ANY_THROW(SparseLinearSystem(10));
+    EXPECT_ANY_THROW(system.SolvePCG(core::Tensor::Zeros(
+            {n_vars + 3, 1}, core::Dtype::Float32)));
+}
+
+}  // namespace tests
+}  // namespace open3d
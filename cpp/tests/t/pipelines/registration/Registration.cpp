@@ -26,10 +26,15 @@
 
 #include "open3d/t/pipelines/registration/Registration.h"
 
+#include <random>
+
 #include "core/CoreTest.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/pipelines/registration/Registration.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/pipelines/kernel/ComputeTransform.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -278,5 +283,191 @@ TEST_P(RegistrationPermuteDevices, RegistrationICPPointToPlane) {
     EXPECT_NEAR(reg_p2plane_t.inlier_rmse_, reg_p2plane_l.inlier_rmse_, 0.0005);
 }
 
+TEST_P(RegistrationPermuteDevices, RegistrationTarget) {
+    core::Device device = GetParam();
+    const int64_t num_points = 2000;
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    std::vector<float> target_vec(num_points * 3);
+    for (float &v : target_vec) {
+        v = uniform(rng);
+    }
+    core::Tensor target_points(target_vec, {num_points, 3},
+                               core::Dtype::Float32, device);
+    t::geometry::PointCloud target(target_points);
+    t::geometry::PointCloud source(
+            target_points.Add(core::Tensor::Init<float>({0.01f, 0.0f, 0.005f},
+                                                        device)));
+
+    const std::vector<double> voxel_sizes{0.1, 0.05, -1};
+    const std::vector<double> max_correspondence_dists{0.2, 0.1, 0.05};
+    const std::vector<t::pipelines::registration::ICPConvergenceCriteria>
+            criterias(3, t::pipelines::registration::ICPConvergenceCriteria(
+                                 1e-6, 1e-6, 10));
+
+    t::pipelines::registration::RegistrationTarget target_prebuilt(
+            target, voxel_sizes);
+    EXPECT_EQ(target_prebuilt.GetNumScales(), 3);
+    EXPECT_EQ(target_prebuilt.GetVoxelSizes(), voxel_sizes);
+    EXPECT_EQ(target_prebuilt.GetPointCloud(2).GetPoints().GetLength(),
+              num_points);
+    EXPECT_LT(target_prebuilt.GetPointCloud(0).GetPoints().GetLength(),
+              target_prebuilt.GetPointCloud(1).GetPoints().GetLength());
+    EXPECT_ANY_THROW(target_prebuilt.GetPointCloud(3));
+
+    t::pipelines::registration::RegistrationResult ref_result =
+            t::pipelines::registration::RegistrationMultiScaleICP(
+                    source, target, voxel_sizes, criterias,
+                    max_correspondence_dists);
+
+    // The prebuilt target gives the same result on every call.
+    for (int k = 0; k < 2; ++k) {
+        t::pipelines::registration::RegistrationResult result =
+                t::pipelines::registration::RegistrationMultiScaleICP(
+                        source, target_prebuilt, criterias,
+                        max_correspondence_dists);
+        EXPECT_TRUE(result.transformation_.AllClose(ref_result.transformation_,
+                                                    1e-5, 1e-6));
+        EXPECT_DOUBLE_EQ(result.fitness_, ref_result.fitness_);
+        EXPECT_DOUBLE_EQ(result.inlier_rmse_, ref_result.inlier_rmse_);
+        EXPECT_EQ(result.correspondence_set_.first.GetLength(),
+                  ref_result.correspondence_set_.first.GetLength());
+    }
+
+    for (double max_correspondence_dist : {0.02, 0.1}) {
+        t::pipelines::registration::RegistrationResult ref_evaluation =
+                t::pipelines::registration::EvaluateRegistration(
+                        source, target, max_correspondence_dist);
+        t::pipelines::registration::RegistrationResult evaluation =
+                t::pipelines::registration::EvaluateRegistration(
+                        source, target_prebuilt, max_correspondence_dist);
+        EXPECT_DOUBLE_EQ(evaluation.fitness_, ref_evaluation.fitness_);
+        EXPECT_DOUBLE_EQ(evaluation.inlier_rmse_, ref_evaluation.inlier_rmse_);
+    }
+
+    EXPECT_ANY_THROW(t::pipelines::registration::RegistrationMultiScaleICP(
+            source, target_prebuilt, {criterias[0]},
+            {max_correspondence_dists[0]}));
+    EXPECT_ANY_THROW(t::pipelines::registration::RegistrationTarget(
+            target, {0.05, 0.1}));
+}
+
+TEST(Registration, SearchAndComputeTransformation) {
+    const int64_t num_points = 2000;
+    const double max_correspondence_dist = 0.02;
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    std::vector<float> target_vec(num_points * 3);
+    std::vector<float> normals_vec(num_points * 3);
+    std::vector<float> source_vec(num_points * 3);
+    for (int64_t i = 0; i < num_points; ++i) {
+        float norm = 0;
+        for (int d = 0; d < 3; ++d) {
+            target_vec[3 * i + d] = uniform(rng);
+            normals_vec[3 * i + d] = uniform(rng) - 0.5f;
+            norm += normals_vec[3 * i + d] * normals_vec[3 * i + d];
+            source_vec[3 * i + d] =
+                    target_vec[3 * i + d] + 0.04f * (uniform(rng) - 0.5f);
+        }
+        for (int d = 0; d < 3; ++d) {
+            normals_vec[3 * i + d] /= std::sqrt(norm);
+        }
+    }
+    core::Tensor source_points(source_vec, {num_points, 3},
+                               core::Dtype::Float32);
+    core::Tensor target_points(target_vec, {num_points, 3},
+                               core::Dtype::Float32);
+    core::Tensor target_normals(normals_vec, {num_points, 3},
+                                core::Dtype::Float32);
+
+    // Reference: search the correspondences first, then reduce.
+    core::nns::NearestNeighborSearch target_nns(target_points);
+    target_nns.HybridIndex(max_correspondence_dist);
+    core::Tensor indices, distances;
+    std::tie(indices, distances) =
+            target_nns.HybridSearch(source_points, max_correspondence_dist, 1);
+    core::Tensor valid = indices.Ne(-1).Reshape({-1});
+    t::pipelines::registration::CorrespondenceSet corres;
+    corres.first = core::Tensor::Arange(0, num_points, 1, core::Dtype::Int64)
+                           .IndexGet({valid});
+    corres.second = indices.IndexGet({valid}).Reshape({-1});
+    const int64_t ref_num_correspondences = corres.first.GetLength();
+    const double ref_squared_error =
+            static_cast<double>(distances.Sum({0, 1}).Item<float>());
+    ASSERT_GT(ref_num_correspondences, num_points / 2);
+    ASSERT_LT(ref_num_correspondences, num_points);
+
+    core::nns::NanoFlannIndex target_index(target_points);
+    int64_t num_correspondences;
+    double squared_error;
+
+    core::Tensor ref_pose = t::pipelines::kernel::ComputePosePointToPlane(
+            source_points, target_points, target_normals, corres);
+    core::Tensor pose = t::pipelines::kernel::SearchAndComputePosePointToPlane(
+            source_points, target_points, target_normals, target_index,
+            max_correspondence_dist, num_correspondences, squared_error);
+    EXPECT_EQ(num_correspondences, ref_num_correspondences);
+    EXPECT_NEAR(squared_error, ref_squared_error, 1e-4);
+    EXPECT_TRUE(pose.AllClose(ref_pose, 1e-4, 1e-5));
+
+    core::Tensor ref_R, ref_t, R, t;
+    std::tie(ref_R, ref_t) = t::pipelines::kernel::ComputeRtPointToPoint(
+            source_points, target_points, corres);
+    std::tie(R, t) = t::pipelines::kernel::SearchAndComputeRtPointToPoint(
+            source_points, target_points, target_index,
+            max_correspondence_dist, num_correspondences, squared_error);
+    EXPECT_EQ(num_correspondences, ref_num_correspondences);
+    EXPECT_NEAR(squared_error, ref_squared_error, 1e-4);
+    EXPECT_TRUE(R.AllClose(ref_R, 1e-4, 1e-5));
+    EXPECT_TRUE(t.AllClose(ref_t, 1e-4, 1e-5));
+}
+
+TEST(Registration, SearchAndComputeRtPointToPointFarFromOrigin) {
+    const int64_t num_points = 2000;
+    const double max_correspondence_dist = 0.02;
+    const float shift[3] = {0.005f, -0.003f, 0.002f};
+
+    // Points close to the origin and 1 km away must give the same transform.
+    for (const float offset : {0.0f, 1000.0f}) {
+        std::mt19937 rng(0);
+        std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+        std::vector<float> target_vec(num_points * 3);
+        std::vector<float> source_vec(num_points * 3);
+        for (int64_t i = 0; i < num_points; ++i) {
+            for (int d = 0; d < 3; ++d) {
+                target_vec[3 * i + d] = offset + uniform(rng);
+                source_vec[3 * i + d] = target_vec[3 * i + d] + shift[d];
+            }
+        }
+        core::Tensor source_points(source_vec, {num_points, 3},
+                                   core::Dtype::Float32);
+        core::Tensor target_points(target_vec, {num_points, 3},
+                                   core::Dtype::Float32);
+        core::nns::NanoFlannIndex target_index(target_points);
+
+        core::Tensor R, t;
+        int64_t num_correspondences;
+        double squared_error;
+        std::tie(R, t) = t::pipelines::kernel::SearchAndComputeRtPointToPoint(
+                source_points, target_points, target_index,
+                max_correspondence_dist, num_correspondences, squared_error);
+        EXPECT_EQ(num_correspondences, num_points);
+        EXPECT_TRUE(R.AllClose(core::Tensor::Eye(3, core::Dtype::Float64,
+                                                 core::Device("CPU:0")),
+                               0, 1e-4));
+        // Check the translation at the center of the points, since far from
+        // the origin t also absorbs the small rotation error.
+        const double c = offset + 0.5;
+        core::Tensor center = core::Tensor::Init<double>({{c}, {c}, {c}});
+        core::Tensor moved = R.Matmul(center).Reshape({3}) + t;
+        EXPECT_TRUE(moved.AllClose(core::Tensor::Init<double>({c - shift[0],
+                                                               c - shift[1],
+                                                               c - shift[2]}),
+                                   0, 1e-4));
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -118,6 +118,102 @@ def test_integration(device):
     assert result.inlier_rmse < 1e-5
 
 
+@pytest.mark.parametrize("device", list_devices())
+def test_read_write(device, tmp_path):
+    volume = o3d.t.geometry.TSDFVoxelGrid(
+        {
+            'tsdf': o3d.core.Dtype.Float32,
+            'weight': o3d.core.Dtype.UInt16,
+            'color': o3d.core.Dtype.UInt16
+        },
+        voxel_size=0.008,
+        sdf_trunc=0.04,
+        block_resolution=16,
+        block_count=1000,
+        device=device)
+
+    intrinsic = o3d.camera.PinholeCameraIntrinsic(
+        o3d.camera.PinholeCameraIntrinsicParameters.PrimeSenseDefault)
+    intrinsic = o3d.core.Tensor(intrinsic.intrinsic_matrix,
+                                o3d.core.Dtype.Float32, device)
+
+    camera_poses = read_trajectory(test_data_path + "RGBD/odometry.log")
+    for i in range(2):
+        color = o3d.io.read_image(test_data_path +
+                                  "RGBD/color/{:05d}.jpg".format(i))
+        color = o3d.t.geometry.Image.from_legacy_image(color, device=device)
+        depth = o3d.io.read_image(test_data_path +
+                                  "RGBD/depth/{:05d}.png".format(i))
+        depth = o3d.t.geometry.Image.from_legacy_image(depth, device=device)
+        extrinsic = o3d.core.Tensor(np.linalg.inv(camera_poses[i].pose),
+                                    o3d.core.Dtype.Float32, device)
+        volume.integrate(depth, color, intrinsic, extrinsic, 1000.0, 3.0)
+
+    file_name = str(tmp_path / "tsdf_voxel_grid.bin")
+    assert o3d.t.io.write_tsdf_voxel_grid(file_name, volume)
+    volume_read = o3d.t.io.read_tsdf_voxel_grid(file_name, device)
+
+    assert volume_read.get_block_hashmap().size() == \
+        volume.get_block_hashmap().size()
+    pcd = volume.extract_surface_points()
+    pcd_read = volume_read.extract_surface_points()
+    np.testing.assert_allclose(
+        np.sort(pcd.point["points"].cpu().numpy(), axis=0),
+        np.sort(pcd_read.point["points"].cpu().numpy(), axis=0))
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_streaming(device, tmp_path):
+    volume = o3d.t.geometry.TSDFVoxelGrid(
+        {
+            'tsdf': o3d.core.Dtype.Float32,
+            'weight': o3d.core.Dtype.UInt16,
+            'color': o3d.core.Dtype.UInt16
+        },
+        voxel_size=0.008,
+        sdf_trunc=0.04,
+        block_resolution=16,
+        block_count=1000,
+        device=device)
+
+    # Each frame observes a bit more than 1000 blocks.
+    max_resident_blocks = 1050
+    store_path = str(tmp_path / "tsdf_block_store.bin")
+    volume.enable_streaming(store_path, max_resident_blocks)
+    assert volume.is_streaming_enabled()
+
+    intrinsic = o3d.camera.PinholeCameraIntrinsic(
+        o3d.camera.PinholeCameraIntrinsicParameters.PrimeSenseDefault)
+    intrinsic = o3d.core.Tensor(intrinsic.intrinsic_matrix,
+                                o3d.core.Dtype.Float32, device)
+
+    camera_poses = read_trajectory(test_data_path + "RGBD/odometry.log")
+    # Go back to the first frame in the end to page evicted blocks back in.
+    for i in list(range(len(camera_poses))) + [0]:
+        color = o3d.io.read_image(test_data_path +
+                                  "RGBD/color/{:05d}.jpg".format(i))
+        color = o3d.t.geometry.Image.from_legacy_image(color, device=device)
+        depth = o3d.io.read_image(test_data_path +
+                                  "RGBD/depth/{:05d}.png".format(i))
+        depth = o3d.t.geometry.Image.from_legacy_image(depth, device=device)
+        extrinsic = o3d.core.Tensor(np.linalg.inv(camera_poses[i].pose),
+                                    o3d.core.Dtype.Float32, device)
+        volume.integrate(depth, color, intrinsic, extrinsic, 1000.0, 3.0)
+
+        stats = volume.get_streaming_statistics()
+        assert stats.num_resident_blocks <= max_resident_blocks
+
+    stats = volume.get_streaming_statistics()
+    assert stats.num_evicted_blocks > 0
+    assert stats.num_blocks_paged_in > 0
+    num_blocks = stats.num_resident_blocks + stats.num_evicted_blocks
+
+    volume.disable_streaming()
+    assert not volume.is_streaming_enabled()
+    assert not os.path.exists(store_path)
+    assert volume.get_block_hashmap().size() == num_blocks
+
+
 @pytest.mark.skip(
     reason="raycasting is subject to changes and test data not up-to-date")
 def test_raycast(device):
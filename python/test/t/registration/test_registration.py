@@ -226,3 +226,44 @@ def test_test_registration_icp_point_to_plane(device):
                                reg_p2plane_legacy.inlier_rmse, 0.0001)
     np.testing.assert_allclose(reg_p2plane_t.fitness,
                                reg_p2plane_legacy.fitness, 0.0001)
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_registration_target(device):
+    np.random.seed(0)
+    target_np = np.random.rand(2000, 3).astype(np.float32)
+    target_t = o3d.t.geometry.PointCloud(o3c.Tensor(target_np, device=device))
+    source_t = o3d.t.geometry.PointCloud(
+        o3c.Tensor(target_np + np.array([0.01, 0, 0.005], dtype=np.float32),
+                   device=device))
+
+    voxel_sizes = o3d.utility.DoubleVector([0.1, 0.05, -1])
+    max_correspondence_distances = o3d.utility.DoubleVector([0.2, 0.1, 0.05])
+    criteria_list = [
+        o3d.t.pipelines.registration.ICPConvergenceCriteria(1e-6, 1e-6, 10)
+    ] * 3
+
+    target_prebuilt = o3d.t.pipelines.registration.RegistrationTarget(
+        target_t, voxel_sizes)
+    assert target_prebuilt.get_num_scales() == 3
+    assert len(target_prebuilt.get_point_cloud(2).point["points"]) == 2000
+
+    reg_ref = o3d.t.pipelines.registration.registration_multi_scale_icp(
+        source_t, target_t, voxel_sizes, criteria_list,
+        max_correspondence_distances)
+    for _ in range(2):
+        reg = o3d.t.pipelines.registration.registration_multi_scale_icp(
+            source_t, target_prebuilt, criteria_list,
+            max_correspondence_distances)
+        np.testing.assert_allclose(reg.transformation.numpy(),
+                                   reg_ref.transformation.numpy(), 1e-5, 1e-6)
+        np.testing.assert_allclose(reg.fitness, reg_ref.fitness, 1e-12)
+
+    evaluation = o3d.t.pipelines.registration.evaluate_registration(
+        source_t, target_prebuilt, 0.02)
+    evaluation_ref = o3d.t.pipelines.registration.evaluate_registration(
+        source_t, target_t, 0.02)
+    np.testing.assert_allclose(evaluation.fitness, evaluation_ref.fitness,
+                               1e-12)
+    np.testing.assert_allclose(evaluation.inlier_rmse,
+                               evaluation_ref.inlier_rmse, 1e-12)